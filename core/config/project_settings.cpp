@@ -35,8 +35,10 @@
 #include "core/io/config_file.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/marshalls.h"
+#include "core/io/resource.h"
 #include "core/io/resource_uid.h"
 #include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
@@ -894,6 +896,11 @@ Error ProjectSettings::setup(const String &p_path, const String &p_main_pack, bo
 
 	Compression::gzip_level = GLOBAL_GET("compression/formats/gzip/compression_level");
 
+	FileAccessCompressed::default_block_size = GLOBAL_GET("compression/compressed_files/block_size");
+	FileAccessCompressed::readahead_blocks = GLOBAL_GET("compression/compressed_files/readahead_blocks");
+
+	ResourceCache::set_retention_budget(uint64_t(int(GLOBAL_GET("memory/limits/resource_cache/retained_size_mb"))) * 1024 * 1024);
+
 	load_scene_groups_cache();
 
 	project_loaded = err == OK;
@@ -1797,6 +1804,10 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/zstd/window_log_size", PROPERTY_HINT_RANGE, "10,30,1"), Compression::zstd_window_log_size);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/zlib/compression_level", PROPERTY_HINT_RANGE, "-1,9,1"), Compression::zlib_level);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/gzip/compression_level", PROPERTY_HINT_RANGE, "-1,9,1"), Compression::gzip_level);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/compressed_files/block_size", PROPERTY_HINT_RANGE, "4096,16777216,1"), FileAccessCompressed::default_block_size);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/compressed_files/readahead_blocks", PROPERTY_HINT_RANGE, "0,64,1"), FileAccessCompressed::readahead_blocks);
+
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "memory/limits/resource_cache/retained_size_mb", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0);
 
 	GLOBAL_DEF("debug/settings/crash_handler/message",
 			String("Please include this when reporting the bug to the project developer."));
@@ -31,6 +31,9 @@
 #include "compression.h"
 
 #include "core/io/zip_io.h"
+#include "core/os/rw_lock.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 
 #include <thirdparty/misc/fastlz.h>
 
@@ -40,13 +43,161 @@
 #include <brotli/decode.h>
 #endif
 
-// Caches for zstd.
-static BinaryMutex mutex;
-static ZSTD_DCtx *current_zstd_d_ctx = nullptr;
-static bool current_zstd_long_distance_matching;
-static int current_zstd_window_log_size;
+// Zstd contexts are reused across calls, one set per thread so they never need locking.
+struct ZstdThreadContexts {
+	ZSTD_CCtx *c_ctx = nullptr;
+	ZSTD_DCtx *d_ctx = nullptr;
+	bool d_long_distance_matching = false;
+	int d_window_log_size = 0;
 
-int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode) {
+	ZSTD_CCtx *get_c_ctx() {
+		if (!c_ctx) {
+			c_ctx = ZSTD_createCCtx();
+		}
+		return c_ctx;
+	}
+
+	ZSTD_DCtx *get_d_ctx() {
+		if (!d_ctx || d_long_distance_matching != Compression::zstd_long_distance_matching || d_window_log_size != Compression::zstd_window_log_size) {
+			if (d_ctx) {
+				ZSTD_freeDCtx(d_ctx);
+			}
+
+			d_ctx = ZSTD_createDCtx();
+			if (Compression::zstd_long_distance_matching) {
+				ZSTD_DCtx_setParameter(d_ctx, ZSTD_d_windowLogMax, Compression::zstd_window_log_size);
+			}
+			d_long_distance_matching = Compression::zstd_long_distance_matching;
+			d_window_log_size = Compression::zstd_window_log_size;
+		}
+		return d_ctx;
+	}
+
+	~ZstdThreadContexts() {
+		if (c_ctx) {
+			ZSTD_freeCCtx(c_ctx);
+		}
+		if (d_ctx) {
+			ZSTD_freeDCtx(d_ctx);
+		}
+	}
+};
+
+static thread_local ZstdThreadContexts zstd_thread_contexts;
+
+// Dictionaries are digested once, the digested states are read-only and shared by all threads.
+struct ZstdDictionary {
+	Vector<uint8_t> data;
+	ZSTD_DDict *d_dict = nullptr;
+	HashMap<int, ZSTD_CDict *> c_dicts; // Per compression level.
+	BinaryMutex c_dicts_mutex;
+
+	ZSTD_CDict *get_c_dict(int p_level) {
+		MutexLock lock(c_dicts_mutex);
+		ZSTD_CDict **c_dict = c_dicts.getptr(p_level);
+		if (c_dict) {
+			return *c_dict;
+		}
+		ZSTD_CDict *new_c_dict = ZSTD_createCDict(data.ptr(), data.size(), p_level);
+		if (new_c_dict) {
+			c_dicts.insert(p_level, new_c_dict);
+		}
+		return new_c_dict;
+	}
+
+	~ZstdDictionary() {
+		if (d_dict) {
+			ZSTD_freeDDict(d_dict);
+		}
+		for (const KeyValue<int, ZSTD_CDict *> &E : c_dicts) {
+			ZSTD_freeCDict(E.value);
+		}
+	}
+};
+
+static struct ZstdDictionaries {
+	RWLock lock;
+	HashMap<uint32_t, ZstdDictionary *> dictionaries;
+
+	~ZstdDictionaries() {
+		for (const KeyValue<uint32_t, ZstdDictionary *> &E : dictionaries) {
+			memdelete(E.value);
+		}
+	}
+} zstd_dictionaries;
+
+static ZstdDictionary *_get_zstd_dictionary(uint32_t p_id) {
+	RWLockRead read_lock(zstd_dictionaries.lock);
+	ZstdDictionary **dictionary = zstd_dictionaries.dictionaries.getptr(p_id);
+	return dictionary ? *dictionary : nullptr;
+}
+
+uint32_t Compression::add_zstd_dictionary(const Vector<uint8_t> &p_dictionary) {
+	ERR_FAIL_COND_V_MSG(p_dictionary.size() < 8, 0, "Zstandard dictionaries must be at least 8 bytes long.");
+
+	uint32_t id = hash_murmur3_buffer(p_dictionary.ptr(), p_dictionary.size());
+	if (id == 0) {
+		id = 1; // Zero means no dictionary.
+	}
+
+	RWLockWrite write_lock(zstd_dictionaries.lock);
+	ZstdDictionary **existing = zstd_dictionaries.dictionaries.getptr(id);
+	if (existing) {
+		ERR_FAIL_COND_V_MSG((*existing)->data != p_dictionary, 0, "A different Zstandard dictionary with the same ID was already added.");
+		return id;
+	}
+
+	ZstdDictionary *dictionary = memnew(ZstdDictionary);
+	dictionary->data = p_dictionary;
+	dictionary->d_dict = ZSTD_createDDict(dictionary->data.ptr(), dictionary->data.size());
+	if (!dictionary->d_dict) {
+		memdelete(dictionary);
+		ERR_FAIL_V_MSG(0, "Invalid Zstandard dictionary.");
+	}
+	zstd_dictionaries.dictionaries.insert(id, dictionary);
+	return id;
+}
+
+bool Compression::has_zstd_dictionary(uint32_t p_id) {
+	return _get_zstd_dictionary(p_id) != nullptr;
+}
+
+Vector<uint8_t> Compression::build_zstd_dictionary(const Vector<Vector<uint8_t>> &p_samples, int64_t p_max_size) {
+	ERR_FAIL_COND_V(p_max_size < 8, Vector<uint8_t>());
+
+	// Builds a raw content dictionary, which Zstandard matches against as if it preceded every buffer.
+	// Files of the same type share most of their content near the start (headers, common properties),
+	// so the beginning of every distinct sample is taken, until the dictionary is full.
+	const int64_t chunk_size = CLAMP(p_max_size / MAX(1, p_samples.size()), 64, 4096);
+	Vector<uint8_t> dictionary;
+	HashSet<uint32_t> added_chunks;
+	for (const Vector<uint8_t> &sample : p_samples) {
+		const int64_t size = MIN(MIN(chunk_size, (int64_t)sample.size()), p_max_size - dictionary.size());
+		if (size <= 0) {
+			continue;
+		}
+		uint32_t chunk_hash = hash_murmur3_buffer(sample.ptr(), size);
+		if (added_chunks.has(chunk_hash)) {
+			continue;
+		}
+		added_chunks.insert(chunk_hash);
+
+		int64_t ofs = dictionary.size();
+		dictionary.resize(ofs + size);
+		memcpy(dictionary.ptrw() + ofs, sample.ptr(), size);
+	}
+
+	// Zstandard would try to parse a dictionary starting with its magic number as a trained one.
+	if (dictionary.size() >= 4 && (dictionary[0] | (dictionary[1] << 8) | (dictionary[2] << 16) | ((uint32_t)dictionary[3] << 24)) == ZSTD_MAGIC_DICTIONARY) {
+		dictionary.insert(0, 0);
+		if (dictionary.size() > p_max_size) {
+			dictionary.resize(p_max_size);
+		}
+	}
+	return dictionary;
+}
+
+int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode, uint32_t p_zstd_dictionary) {
 	switch (p_mode) {
 		case MODE_BROTLI: {
 			ERR_FAIL_V_MSG(-1, "Only brotli decompression is supported.");
@@ -90,15 +241,27 @@ int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_sr
 
 		} break;
 		case MODE_ZSTD: {
-			ZSTD_CCtx *cctx = ZSTD_createCCtx();
+			ZSTD_CCtx *cctx = zstd_thread_contexts.get_c_ctx();
+			ZSTD_CCtx_reset(cctx, ZSTD_reset_session_and_parameters);
 			ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, zstd_level);
 			if (zstd_long_distance_matching) {
 				ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, 1);
 				ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, zstd_window_log_size);
 			}
 			const int64_t max_dst_size = get_max_compressed_buffer_size(p_src_size, MODE_ZSTD);
-			const size_t ret = ZSTD_compressCCtx(cctx, p_dst, max_dst_size, p_src, p_src_size, zstd_level);
-			ZSTD_freeCCtx(cctx);
+
+			size_t ret;
+			if (p_zstd_dictionary != 0) {
+				ZstdDictionary *dictionary = _get_zstd_dictionary(p_zstd_dictionary);
+				ERR_FAIL_NULL_V_MSG(dictionary, -1, vformat("Zstandard dictionary %d was not added.", p_zstd_dictionary));
+
+				ZSTD_CDict *cdict = dictionary->get_c_dict(zstd_level);
+				ERR_FAIL_NULL_V(cdict, -1);
+				ret = ZSTD_compress_usingCDict(cctx, p_dst, max_dst_size, p_src, p_src_size, cdict);
+			} else {
+				ret = ZSTD_compressCCtx(cctx, p_dst, max_dst_size, p_src, p_src_size, zstd_level);
+			}
+			ERR_FAIL_COND_V_MSG(ZSTD_isError(ret), -1, vformat("Zstandard compression failed: \"%s\".", ZSTD_getErrorName(ret)));
 			return (int64_t)ret;
 		} break;
 	}
@@ -145,7 +308,7 @@ int64_t Compression::get_max_compressed_buffer_size(int64_t p_src_size, Mode p_m
 	ERR_FAIL_V(-1);
 }
 
-int64_t Compression::decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode) {
+int64_t Compression::decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode, uint32_t p_zstd_dictionary) {
 	switch (p_mode) {
 		case MODE_BROTLI: {
 #ifdef BROTLI_ENABLED
@@ -197,22 +360,16 @@ int64_t Compression::decompress(uint8_t *p_dst, int64_t p_dst_max_size, const ui
 			return total;
 		} break;
 		case MODE_ZSTD: {
-			MutexLock lock(mutex);
-
-			if (!current_zstd_d_ctx || current_zstd_long_distance_matching != zstd_long_distance_matching || current_zstd_window_log_size != zstd_window_log_size) {
-				if (current_zstd_d_ctx) {
-					ZSTD_freeDCtx(current_zstd_d_ctx);
-				}
+			ZSTD_DCtx *dctx = zstd_thread_contexts.get_d_ctx();
 
-				current_zstd_d_ctx = ZSTD_createDCtx();
-				if (zstd_long_distance_matching) {
-					ZSTD_DCtx_setParameter(current_zstd_d_ctx, ZSTD_d_windowLogMax, zstd_window_log_size);
-				}
-				current_zstd_long_distance_matching = zstd_long_distance_matching;
-				current_zstd_window_log_size = zstd_window_log_size;
+			size_t ret;
+			if (p_zstd_dictionary != 0) {
+				ZstdDictionary *dictionary = _get_zstd_dictionary(p_zstd_dictionary);
+				ERR_FAIL_NULL_V_MSG(dictionary, -1, vformat("Zstandard dictionary %d was not added.", p_zstd_dictionary));
+				ret = ZSTD_decompress_usingDDict(dctx, p_dst, p_dst_max_size, p_src, p_src_size, dictionary->d_dict);
+			} else {
+				ret = ZSTD_decompressDCtx(dctx, p_dst, p_dst_max_size, p_src, p_src_size);
 			}
-
-			size_t ret = ZSTD_decompressDCtx(current_zstd_d_ctx, p_dst, p_dst_max_size, p_src, p_src_size);
 			return (int64_t)ret;
 		} break;
 	}
@@ -52,8 +52,14 @@ public:
 		MODE_BROTLI
 	};
 
-	static int64_t compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD);
+	// Dictionaries for Zstandard, referenced by their ID in compress() and decompress(). They help
+	// most with many small buffers of similar content, such as resources compressed one by one.
+	static uint32_t add_zstd_dictionary(const Vector<uint8_t> &p_dictionary);
+	static bool has_zstd_dictionary(uint32_t p_id);
+	static Vector<uint8_t> build_zstd_dictionary(const Vector<Vector<uint8_t>> &p_samples, int64_t p_max_size = 112640);
+
+	static int64_t compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD, uint32_t p_zstd_dictionary = 0);
 	static int64_t get_max_compressed_buffer_size(int64_t p_src_size, Mode p_mode = MODE_ZSTD);
-	static int64_t decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD);
+	static int64_t decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD, uint32_t p_zstd_dictionary = 0);
 	static int decompress_dynamic(Vector<uint8_t> *p_dst_vect, int64_t p_max_dst_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode);
 };
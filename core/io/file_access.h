@@ -35,6 +35,7 @@
 #include "core/object/ref_counted.h"
 #include "core/os/memory.h"
 #include "core/string/ustring.h"
+#include "core/templates/span.h"
 #include "core/typedefs.h"
 #include "core/variant/type_info.h"
 
@@ -196,6 +197,9 @@ public:
 	String get_as_text() const;
 	virtual String get_as_utf8_string() const;
 
+	virtual Error map_read_only() { return ERR_UNAVAILABLE; } ///< map the whole file in memory for reading, the mapping is released when the file is closed
+	virtual Span<uint8_t> get_mapped_data() const { return Span<uint8_t>(); } ///< get the whole file contents if they are resident in memory, empty otherwise
+
 	/**
 
 	 * Use this for files WRITTEN in _big_ endian machines (ie, amiga/mac)
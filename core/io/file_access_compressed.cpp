@@ -32,17 +32,27 @@
 
 #include "core/math/math_funcs_binary.h"
 
-void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
+void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size, uint32_t p_zstd_dictionary) {
 	magic = p_magic.ascii().get_data();
 	magic = (magic + "    ").substr(0, 4);
 
 	cmode = p_mode;
-	block_size = p_block_size;
+	block_size = p_block_size > 0 ? p_block_size : default_block_size;
+	zstd_dictionary = p_mode == Compression::MODE_ZSTD ? p_zstd_dictionary : 0;
 }
 
 Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	f = p_base;
-	cmode = (Compression::Mode)f->get_32();
+	uint32_t stored_mode = f->get_32();
+	zstd_dictionary = 0;
+	if (stored_mode & HEADER_ZSTD_DICTIONARY_FLAG) {
+		zstd_dictionary = f->get_32();
+		if (!Compression::has_zstd_dictionary(zstd_dictionary)) {
+			f.unref();
+			ERR_FAIL_V_MSG(ERR_FILE_MISSING_DEPENDENCIES, vformat("Can't open compressed file '%s', it needs Zstandard dictionary %d which was not added.", p_base->get_path(), zstd_dictionary));
+		}
+	}
+	cmode = (Compression::Mode)(stored_mode & ~HEADER_ZSTD_DICTIONARY_FLAG);
 	block_size = f->get_32();
 	if (block_size == 0) {
 		f.unref();
@@ -64,17 +74,82 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	comp_buffer.resize(max_bs);
 	buffer.resize(block_size);
 	read_ptr = buffer.ptrw();
-	f->get_buffer(comp_buffer.ptrw(), read_blocks[0].csize);
 	at_end = false;
 	read_eof = false;
 	read_block_count = bc;
-	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
 
-	const int64_t ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
-	read_block = 0;
+	if (bc > 1 && readahead_blocks > 0 && WorkerThreadPool::get_singleton()) {
+		readahead.resize(MIN((uint32_t)readahead_blocks, bc - 1));
+		for (ReadaheadBlock &rab : readahead) {
+			rab.mode = cmode;
+			rab.zstd_dictionary = zstd_dictionary;
+			rab.comp_buffer.resize(max_bs);
+			rab.buffer.resize(block_size);
+		}
+	}
+
 	read_pos = 0;
+	return _load_block(0, true);
+}
+
+void FileAccessCompressed::_decompress_readahead_block(void *p_userdata) {
+	ReadaheadBlock *rab = (ReadaheadBlock *)p_userdata;
+	rab->result = Compression::decompress(rab->buffer.ptrw(), rab->buffer.size(), rab->comp_buffer.ptr(), rab->size, rab->mode, rab->zstd_dictionary);
+}
+
+void FileAccessCompressed::_wait_readahead_block(ReadaheadBlock &p_readahead) const {
+	if (p_readahead.task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(p_readahead.task_id);
+		p_readahead.task_id = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
+void FileAccessCompressed::_queue_readahead(uint32_t p_from_block) const {
+	const uint32_t to_block = MIN(p_from_block + readahead.size(), read_block_count);
+	for (uint32_t i = p_from_block; i < to_block; i++) {
+		// Each block has a fixed slot, so the whole window always fits.
+		ReadaheadBlock &rab = readahead[i % readahead.size()];
+		if (rab.block == i) {
+			continue; // Already queued.
+		}
+		_wait_readahead_block(rab);
+
+		// Reading stays on this thread, only decompression is offloaded.
+		rab.block = i;
+		rab.size = read_blocks[i].csize;
+		f->seek(read_blocks[i].offset);
+		f->get_buffer(rab.comp_buffer.ptrw(), rab.size);
+		rab.task_id = WorkerThreadPool::get_singleton()->add_native_task(&FileAccessCompressed::_decompress_readahead_block, &rab, false, "FileAccessCompressed readahead");
+	}
+}
 
-	return ret == -1 ? ERR_FILE_CORRUPT : OK;
+Error FileAccessCompressed::_load_block(uint32_t p_block, bool p_sequential) const {
+	read_block = p_block;
+	read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+	if (read_block_count == 1) {
+		read_block_size = read_total;
+	}
+
+	ReadaheadBlock *rab = readahead.is_empty() ? nullptr : &readahead[p_block % readahead.size()];
+	if (rab && rab->block == p_block) {
+		_wait_readahead_block(*rab);
+		rab->block = UINT32_MAX;
+		ERR_FAIL_COND_V_MSG(rab->result == -1, ERR_FILE_CORRUPT, "Compressed file is corrupt.");
+		// Take the decompressed block, and give back the previous buffer for later use.
+		SWAP(buffer, rab->buffer);
+		read_ptr = buffer.ptrw();
+	} else {
+		f->seek(read_blocks[p_block].offset);
+		f->get_buffer(comp_buffer.ptrw(), read_blocks[p_block].csize);
+		const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[p_block].csize, cmode, zstd_dictionary);
+		ERR_FAIL_COND_V_MSG(ret == -1, ERR_FILE_CORRUPT, "Compressed file is corrupt.");
+	}
+
+	// Only read ahead when reading through the file, random access would throw most of it away.
+	if (rab && p_sequential) {
+		_queue_readahead(p_block + 1);
+	}
+	return OK;
 }
 
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
@@ -123,10 +198,16 @@ void FileAccessCompressed::_close() {
 
 		CharString mgc = magic.utf8();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
+		if (zstd_dictionary != 0) {
+			f->store_32(cmode | HEADER_ZSTD_DICTIONARY_FLAG); //write compression mode 4
+			f->store_32(zstd_dictionary); //write dictionary ID 4
+		} else {
+			f->store_32(cmode); //write compression mode 4
+		}
 		f->store_32(block_size); //write block size 4
 		f->store_32(uint32_t(write_max)); //max amount of data written 4
 		uint32_t bc = (write_max / block_size) + 1;
+		uint64_t block_sizes_ofs = f->get_position();
 
 		for (uint32_t i = 0; i < bc; i++) {
 			f->store_32(0); //compressed sizes, will update later
@@ -145,20 +226,24 @@ void FileAccessCompressed::_close() {
 			uint32_t bl = i == (bc - 1) ? last_block_size : block_size;
 			uint8_t *bp = &write_ptr[i * block_size];
 
-			const int64_t compressed_size = Compression::compress(temp_cblock_ptr, bp, bl, cmode);
+			const int64_t compressed_size = Compression::compress(temp_cblock_ptr, bp, bl, cmode, zstd_dictionary);
 			ERR_FAIL_COND_MSG(compressed_size < 0, "FileAccessCompressed: Error compressing data.");
 
 			f->store_buffer(temp_cblock_ptr, (uint64_t)compressed_size);
 			block_sizes.push_back(compressed_size);
 		}
 
-		f->seek(16); //ok write block sizes
+		f->seek(block_sizes_ofs); //ok write block sizes
 		for (uint32_t i = 0; i < bc; i++) {
 			f->store_32(block_sizes[i]);
 		}
 		f->seek_end();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
 	} else {
+		for (ReadaheadBlock &rab : readahead) {
+			_wait_readahead_block(rab);
+		}
+		readahead.clear();
 		comp_buffer.clear();
 		read_blocks.clear();
 	}
@@ -203,12 +288,9 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 			read_eof = false;
 			uint32_t block_idx = p_position / block_size;
 			if (block_idx != read_block) {
-				read_block = block_idx;
-				f->seek(read_blocks[read_block].offset);
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+				// The block table gives the offset of every block, so only the target block is decompressed.
+				Error err = _load_block(block_idx, block_idx == read_block + 1);
+				ERR_FAIL_COND(err != OK);
 			}
 
 			read_pos = p_position % block_size;
@@ -293,10 +375,8 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		}
 
 		// Read the next block of compressed data.
-		f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-		const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-		ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-		read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+		Error err = _load_block(read_block, true);
+		ERR_FAIL_COND_V(err != OK, -1);
 		read_pos = 0;
 	}
 
@@ -32,10 +32,15 @@
 
 #include "core/io/compression.h"
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
 
 class FileAccessCompressed : public FileAccess {
 	GDSOFTCLASS(FileAccessCompressed, FileAccess);
+	// Set in the stored compression mode when the file header is followed by a Zstandard dictionary ID.
+	static constexpr uint32_t HEADER_ZSTD_DICTIONARY_FLAG = 1u << 31;
+
 	Compression::Mode cmode = Compression::MODE_ZSTD;
+	uint32_t zstd_dictionary = 0;
 	bool writing = false;
 	uint64_t write_pos = 0;
 	uint8_t *write_ptr = nullptr;
@@ -50,8 +55,21 @@ class FileAccessCompressed : public FileAccess {
 		uint64_t offset;
 	};
 
+	// A block decompressed ahead of time on the WorkerThreadPool, while the current one is being read.
+	struct ReadaheadBlock {
+		uint32_t block = UINT32_MAX;
+		uint32_t size = 0;
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		uint32_t zstd_dictionary = 0;
+		Vector<uint8_t> comp_buffer;
+		Vector<uint8_t> buffer;
+		int64_t result = -1;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
 	mutable Vector<uint8_t> comp_buffer;
-	uint8_t *read_ptr = nullptr;
+	mutable LocalVector<ReadaheadBlock> readahead;
+	mutable uint8_t *read_ptr = nullptr;
 	mutable uint32_t read_block = 0;
 	uint32_t read_block_count = 0;
 	mutable uint32_t read_block_size = 0;
@@ -65,8 +83,18 @@ class FileAccessCompressed : public FileAccess {
 
 	void _close();
 
+	static void _decompress_readahead_block(void *p_userdata);
+	void _wait_readahead_block(ReadaheadBlock &p_readahead) const;
+	void _queue_readahead(uint32_t p_from_block) const;
+	Error _load_block(uint32_t p_block, bool p_sequential) const;
+
 public:
-	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
+	// Block size used when writing, unless one is passed to configure().
+	static inline uint32_t default_block_size = 4096;
+	// Amount of blocks decompressed ahead of the one being read sequentially. Zero disables readahead.
+	static inline int readahead_blocks = 0;
+
+	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 0, uint32_t p_zstd_dictionary = 0);
 
 	Error open_after_magic(Ref<FileAccess> p_base);
 
@@ -32,6 +32,7 @@
 
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_patched.h"
+#include "core/io/marshalls.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/version.h"
@@ -47,6 +48,9 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 }
 
 void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_bundle, bool p_delta, const String &p_salt) {
+	// Files added one by one must take precedence over indexed packs the same way they would over any other pack.
+	_materialize_indexed_packs();
+
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -69,37 +73,43 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 		delta_patches[pmd5].push_back(pf);
 	} else if (!exists || p_replace_files) {
 		files[pmd5] = pf;
-		delta_patches[pmd5].clear();
+		delta_patches.erase(pmd5);
 	}
 
 	if (!exists) {
-		// Search for directory.
-		PackedDir *cd = root;
-
-		if (simplified_path.contains_char('/')) { // In a subdirectory.
-			Vector<String> ds = simplified_path.get_base_dir().split("/");
-
-			for (int j = 0; j < ds.size(); j++) {
-				if (!cd->subdirs.has(ds[j])) {
-					PackedDir *pd = memnew(PackedDir);
-					pd->name = ds[j];
-					pd->parent = cd;
-					cd->subdirs[pd->name] = pd;
-					cd = pd;
-				} else {
-					cd = cd->subdirs[ds[j]];
-				}
+		_add_to_tree(simplified_path);
+	}
+}
+
+void PackedData::_add_to_tree(const String &p_simplified_path) {
+	// Search for directory.
+	PackedDir *cd = root;
+
+	if (p_simplified_path.contains_char('/')) { // In a subdirectory.
+		Vector<String> ds = p_simplified_path.get_base_dir().split("/");
+
+		for (int j = 0; j < ds.size(); j++) {
+			if (!cd->subdirs.has(ds[j])) {
+				PackedDir *pd = memnew(PackedDir);
+				pd->name = ds[j];
+				pd->parent = cd;
+				cd->subdirs[pd->name] = pd;
+				cd = pd;
+			} else {
+				cd = cd->subdirs[ds[j]];
 			}
 		}
-		String filename = simplified_path.get_file();
-		// Don't add as a file if the path points to a directory.
-		if (!filename.is_empty()) {
-			cd->files.insert(filename);
-		}
+	}
+	String filename = p_simplified_path.get_file();
+	// Don't add as a file if the path points to a directory.
+	if (!filename.is_empty()) {
+		cd->files.insert(filename);
 	}
 }
 
 void PackedData::remove_path(const String &p_path) {
+	_materialize_indexed_packs();
+
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 	if (!files.has(pmd5)) {
@@ -133,6 +143,9 @@ void PackedData::add_pack_source(PackSource *p_source) {
 }
 
 uint8_t *PackedData::get_file_hash(const String &p_path) {
+	// The hash has to outlive this call, so it can't point into a file looked up through an index.
+	_materialize_indexed_packs();
+
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
@@ -144,6 +157,10 @@ uint8_t *PackedData::get_file_hash(const String &p_path) {
 }
 
 Vector<PackedData::PackedFile> PackedData::get_delta_patches(const String &p_path) const {
+	if (delta_patches.is_empty()) {
+		return Vector<PackedFile>();
+	}
+
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 	HashMap<PathMD5, Vector<PackedFile>, PathMD5>::ConstIterator E = delta_patches.find(pmd5);
@@ -155,6 +172,10 @@ Vector<PackedData::PackedFile> PackedData::get_delta_patches(const String &p_pat
 }
 
 bool PackedData::has_delta_patches(const String &p_path) const {
+	if (delta_patches.is_empty()) {
+		return false;
+	}
+
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 	HashMap<PathMD5, Vector<PackedFile>, PathMD5>::ConstIterator E = delta_patches.find(pmd5);
@@ -165,9 +186,10 @@ bool PackedData::has_delta_patches(const String &p_path) const {
 	return !E->value.is_empty();
 }
 
-HashSet<String> PackedData::get_file_paths() const {
+HashSet<String> PackedData::get_file_paths() {
+	PackedDir *tree_root = _get_root();
 	HashSet<String> file_paths;
-	_get_file_paths(root, root->name, file_paths);
+	_get_file_paths(tree_root, tree_root->name, file_paths);
 	return file_paths;
 }
 
@@ -181,7 +203,292 @@ void PackedData::_get_file_paths(PackedDir *p_dir, const String &p_parent_dir, H
 	}
 }
 
+PackedData::PackedDir *PackedData::_get_root() {
+	MutexLock lock(root_mutex);
+
+	// Indexed packs only add their files to the directory tree once it's actually browsed.
+	for (IndexedPack &ip : indexed_packs) {
+		if (ip.in_tree) {
+			continue;
+		}
+		uint64_t ofs = 4; // Skip the file count.
+		for (uint32_t i = 0; i < ip.file_count && ofs != 0; i++) {
+			String path;
+			ofs = _decode_indexed_record(ip, ofs, &path, nullptr);
+			if (ofs != 0) {
+				_add_to_tree(path);
+			}
+		}
+		ip.in_tree = true;
+	}
+
+	return root;
+}
+
+// Path index layout, little-endian, at the offset stored at PACK_HEADER_PATH_INDEX_POS:
+// - uint32_t: Entry count, equal to the directory's file count.
+// - uint32_t: Bucket count.
+// - uint32_t[bucket count]: Displacement of every bucket.
+// - {uint64_t path hash, uint64_t record offset}[entry count]: Slots. Record offsets are relative to the directory offset.
+//
+// A path hashing to `h` can only be stored in slot `hash64_murmur3_64(h, displacement[h % bucket count]) % entry count`.
+
+uint64_t PackedData::hash_index_path(const String &p_simplified_path) {
+	return hash64_murmur3_64(p_simplified_path.hash64(), HASH_MURMUR3_SEED);
+}
+
+bool PackedData::build_path_index(const Vector<String> &p_paths, Vector<uint8_t> &r_index) {
+	const uint32_t count = p_paths.size();
+	if (count == 0) {
+		return false;
+	}
+
+	LocalVector<uint64_t> hashes;
+	LocalVector<uint64_t> record_offsets;
+	hashes.resize(count);
+	record_offsets.resize(count);
+
+	uint64_t record_ofs = 4; // Skip the file count.
+	for (uint32_t i = 0; i < count; i++) {
+		const String &path = p_paths[i];
+		if (path.simplify_path().trim_prefix("res://") != path) {
+			return false; // Lookups compare against the stored path as is.
+		}
+		uint64_t path_len = path.utf8().length();
+		hashes[i] = hash_index_path(path);
+		record_offsets[i] = record_ofs;
+		record_ofs += 4 + path_len + (4 - path_len % 4) % 4 + 8 + 8 + 16 + 4; // Length, padded path, offset, size, MD5, flags.
+	}
+
+	const uint32_t bucket_count = MAX(1u, count / 4);
+	LocalVector<LocalVector<uint32_t>> buckets;
+	buckets.resize(bucket_count);
+	uint32_t max_bucket_size = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		LocalVector<uint32_t> &bucket = buckets[hashes[i] % bucket_count];
+		bucket.push_back(i);
+		max_bucket_size = MAX(max_bucket_size, bucket.size());
+	}
+
+	LocalVector<uint32_t> displacements;
+	displacements.resize_initialized(bucket_count);
+	LocalVector<int64_t> slot_entries;
+	slot_entries.resize(count);
+	for (int64_t &entry : slot_entries) {
+		entry = -1;
+	}
+
+	// Place the largest buckets first, while most slots are still free.
+	LocalVector<uint32_t> candidate_slots;
+	for (uint32_t bucket_size = max_bucket_size; bucket_size > 0; bucket_size--) {
+		for (uint32_t b = 0; b < bucket_count; b++) {
+			const LocalVector<uint32_t> &bucket = buckets[b];
+			if (bucket.size() != bucket_size) {
+				continue;
+			}
+
+			for (uint32_t i = 0; i < bucket_size; i++) {
+				for (uint32_t j = i + 1; j < bucket_size; j++) {
+					if (hashes[bucket[i]] == hashes[bucket[j]]) {
+						return false; // Duplicate path, or a hash collision; neither can be indexed.
+					}
+				}
+			}
+
+			candidate_slots.resize(bucket_size);
+			bool placed = false;
+			for (uint32_t displacement = 0; displacement < (1u << 24) && !placed; displacement++) {
+				placed = true;
+				for (uint32_t i = 0; i < bucket_size && placed; i++) {
+					uint32_t slot = hash64_murmur3_64(hashes[bucket[i]], displacement) % count;
+					if (slot_entries[slot] != -1) {
+						placed = false;
+					}
+					for (uint32_t j = 0; j < i && placed; j++) {
+						if (candidate_slots[j] == slot) {
+							placed = false;
+						}
+					}
+					candidate_slots[i] = slot;
+				}
+				if (placed) {
+					for (uint32_t i = 0; i < bucket_size; i++) {
+						slot_entries[candidate_slots[i]] = bucket[i];
+					}
+					displacements[b] = displacement;
+				}
+			}
+			if (!placed) {
+				return false;
+			}
+		}
+	}
+
+	r_index.resize(8 + uint64_t(bucket_count) * 4 + uint64_t(count) * 16);
+	uint8_t *w = r_index.ptrw();
+	w += encode_uint32(count, w);
+	w += encode_uint32(bucket_count, w);
+	for (uint32_t b = 0; b < bucket_count; b++) {
+		w += encode_uint32(displacements[b], w);
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		w += encode_uint64(hashes[slot_entries[i]], w);
+		w += encode_uint64(record_offsets[slot_entries[i]], w);
+	}
+	return true;
+}
+
+bool PackedData::add_indexed_pack(const String &p_pkg_path, PackSource *p_src, bool p_replace_files, const Ref<FileAccess> &p_mapped_pack, uint64_t p_file_base, uint64_t p_dir_offset, uint64_t p_index_offset) {
+	Span<uint8_t> data = p_mapped_pack->get_mapped_data();
+	if (p_dir_offset + 4 > data.size() || p_index_offset + 8 > data.size()) {
+		return false;
+	}
+
+	IndexedPack ip;
+	ip.pack = p_pkg_path;
+	ip.src = p_src;
+	ip.replace_files = p_replace_files;
+	ip.mapped_pack = p_mapped_pack;
+	ip.file_base = p_file_base;
+	ip.dir = data.ptr() + p_dir_offset;
+	ip.dir_size = data.size() - p_dir_offset;
+	ip.file_count = decode_uint32(ip.dir);
+
+	const uint8_t *index = data.ptr() + p_index_offset;
+	ip.bucket_count = decode_uint32(index + 4);
+	if (ip.file_count == 0 || decode_uint32(index) != ip.file_count || ip.bucket_count == 0) {
+		return false;
+	}
+	if (p_index_offset + 8 + uint64_t(ip.bucket_count) * 4 + uint64_t(ip.file_count) * 16 > data.size()) {
+		return false;
+	}
+	ip.displacements = index + 8;
+	ip.slots = ip.displacements + uint64_t(ip.bucket_count) * 4;
+
+	indexed_packs.push_back(ip);
+	return true;
+}
+
+uint64_t PackedData::_decode_indexed_record(const IndexedPack &p_pack, uint64_t p_ofs, String *r_path, PackedFile *r_file) const {
+	if (p_ofs + 4 > p_pack.dir_size) {
+		return 0;
+	}
+	uint32_t sl = decode_uint32(p_pack.dir + p_ofs);
+	uint64_t end = p_ofs + 4 + sl + 8 + 8 + 16 + 4;
+	if (end > p_pack.dir_size) {
+		return 0;
+	}
+
+	const uint8_t *r = p_pack.dir + p_ofs + 4;
+	if (r_path) {
+		*r_path = String::utf8((const char *)r, sl);
+	}
+	if (r_file) {
+		r += sl;
+		r_file->pack = p_pack.pack;
+		r_file->offset = p_pack.file_base + decode_uint64(r);
+		r_file->size = decode_uint64(r + 8);
+		memcpy(r_file->md5, r + 16, 16);
+		r_file->src = p_pack.src;
+		r_file->encrypted = decode_uint32(r + 32) & PACK_FILE_ENCRYPTED;
+		r_file->bundle = false;
+		r_file->delta = false;
+		r_file->salt = String();
+	}
+	return end;
+}
+
+static bool _utf8_path_equals(const uint8_t *p_utf8, uint32_t p_len, const String &p_path) {
+	// Stored paths are padded with zeros.
+	while (p_len > 0 && p_utf8[p_len - 1] == 0) {
+		p_len--;
+	}
+
+	if (uint32_t(p_path.length()) > p_len) {
+		return false; // A path never has more characters than its UTF-8 bytes.
+	}
+	const char32_t *c = p_path.get_data();
+	for (uint32_t i = 0; i < p_len; i++) {
+		if (p_utf8[i] >= 0x80) {
+			return String::utf8((const char *)p_utf8, p_len) == p_path;
+		}
+		if (char32_t(p_utf8[i]) != c[i]) {
+			return false;
+		}
+	}
+	return uint32_t(p_path.length()) == p_len;
+}
+
+bool PackedData::_find_indexed_file(const IndexedPack &p_pack, const String &p_simplified_path, uint64_t p_hash, PackedFile &r_file) const {
+	uint32_t displacement = decode_uint32(p_pack.displacements + (p_hash % p_pack.bucket_count) * 4);
+	const uint8_t *slot = p_pack.slots + (hash64_murmur3_64(p_hash, displacement) % p_pack.file_count) * 16;
+	if (decode_uint64(slot) != p_hash) {
+		return false;
+	}
+
+	uint64_t record_ofs = decode_uint64(slot + 8);
+	if (record_ofs + 4 > p_pack.dir_size) {
+		return false;
+	}
+	uint32_t sl = decode_uint32(p_pack.dir + record_ofs);
+	if (record_ofs + 4 + sl > p_pack.dir_size || !_utf8_path_equals(p_pack.dir + record_ofs + 4, sl, p_simplified_path)) {
+		return false;
+	}
+
+	return _decode_indexed_record(p_pack, record_ofs, nullptr, &r_file) != 0;
+}
+
+void PackedData::_materialize_indexed_packs() {
+	if (indexed_packs.is_empty()) {
+		return;
+	}
+
+	MutexLock lock(root_mutex);
+
+	LocalVector<IndexedPack> packs = std::move(indexed_packs);
+	indexed_packs.clear();
+
+	for (const IndexedPack &ip : packs) {
+		uint64_t ofs = 4; // Skip the file count.
+		for (uint32_t i = 0; i < ip.file_count; i++) {
+			String path;
+			PackedFile pf;
+			ofs = _decode_indexed_record(ip, ofs, &path, &pf);
+			ERR_FAIL_COND_MSG(ofs == 0, vformat("Corrupted directory in pack \"%s\".", ip.pack));
+			add_path(ip.pack, path, pf.offset, pf.size, pf.md5, ip.src, ip.replace_files, pf.encrypted);
+		}
+	}
+}
+
+PackedData::PackedFile *PackedData::_find_file(const String &p_path, PackedFile &r_indexed_file) {
+	if (files.is_empty() && indexed_packs.is_empty()) {
+		return nullptr;
+	}
+
+	String simplified_path = _get_simplified_path(p_path);
+	PackedFile *found = nullptr;
+	if (!files.is_empty()) {
+		HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(PathMD5(simplified_path.md5_buffer()));
+		if (E) {
+			found = &E->value;
+		}
+	}
+
+	if (!indexed_packs.is_empty()) {
+		// Same precedence as if the indexed packs had been added file by file, in order.
+		uint64_t hash = hash_index_path(simplified_path);
+		for (const IndexedPack &ip : indexed_packs) {
+			if ((!found || ip.replace_files) && _find_indexed_file(ip, simplified_path, hash, r_indexed_file)) {
+				found = &r_indexed_file;
+			}
+		}
+	}
+
+	return found;
+}
+
 void PackedData::clear() {
+	indexed_packs.clear();
 	files.clear();
 	delta_patches.clear();
 	_free_packed_dirs(root);
@@ -301,6 +608,11 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	bool sparse_bundle = (pack_flags & PACK_SPARSE_BUNDLE);
 	String salt;
 
+	// Files of sparse bundles live outside of the pack, so there's nothing worth mapping.
+	if (!sparse_bundle && f->map_read_only() == OK) {
+		mapped_packs[p_path] = f;
+	}
+
 	uint64_t file_base = f->get_64();
 	if ((version == PACK_FORMAT_VERSION_V4) || (version == PACK_FORMAT_VERSION_V3) || (version == PACK_FORMAT_VERSION_V2 && rel_filebase)) {
 		file_base += pck_start_pos;
@@ -309,6 +621,15 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	if (version == PACK_FORMAT_VERSION_V3 || version == PACK_FORMAT_VERSION_V4) {
 		// V3/V4: Read directory offset and skip reserved part of the header.
 		uint64_t dir_offset = f->get_64() + pck_start_pos;
+		if (version == PACK_FORMAT_VERSION_V4 && (pack_flags & PACK_PATH_INDEX) && !enc_directory && !sparse_bundle && mapped_packs.has(p_path)) {
+			// V4: Mount without reading the directory, files are looked up through the path index.
+			f->seek(pck_start_pos + PACK_HEADER_PATH_INDEX_POS);
+			uint64_t index_offset = f->get_64() + pck_start_pos;
+			if (PackedData::get_singleton()->add_indexed_pack(p_path, this, p_replace_files, f, file_base, dir_offset, index_offset)) {
+				return true;
+			}
+			WARN_PRINT(vformat("Invalid path index in pack \"%s\", reading its directory instead.", p_path));
+		}
 		if (sparse_bundle && enc_directory && version == PACK_FORMAT_VERSION_V4) {
 			// V4: Read encrypted directory salt.
 			Vector<uint8_t> salt_data = f->get_buffer(32);
@@ -374,7 +695,15 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 }
 
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file, const Vector<uint8_t> &p_decryption_key) {
-	Ref<FileAccess> file(memnew(FileAccessPack(p_path, *p_file, p_decryption_key)));
+	Ref<FileAccess> mapped_pack;
+	if (!p_file->encrypted && !p_file->bundle) {
+		const Ref<FileAccess> *mapped = mapped_packs.getptr(p_file->pack);
+		if (mapped) {
+			mapped_pack = *mapped;
+		}
+	}
+
+	Ref<FileAccess> file(memnew(FileAccessPack(p_path, *p_file, p_decryption_key, mapped_pack)));
 
 	if (PackedData::get_singleton()->has_delta_patches(p_path)) {
 		Ref<FileAccessPatched> file_patched;
@@ -436,12 +765,12 @@ bool FileAccessPack::is_open() const {
 	if (f.is_valid()) {
 		return f->is_open();
 	} else {
-		return false;
+		return mapped_data != nullptr;
 	}
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -449,7 +778,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (f.is_valid()) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -470,7 +801,7 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(f.is_null() && !mapped_data, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -483,21 +814,33 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
+	const uint64_t read_pos = pos;
 	pos += to_read;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+
+	if (mapped_data) {
+		memcpy(p_dst, mapped_data + read_pos, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+Span<uint8_t> FileAccessPack::get_mapped_data() const {
+	return Span<uint8_t>(mapped_data, mapped_data ? pf.size : 0);
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -521,11 +864,26 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped_data = nullptr;
+	mapped_pack = Ref<FileAccess>();
 }
 
-FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Vector<uint8_t> &p_decryption_key) {
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Vector<uint8_t> &p_decryption_key, const Ref<FileAccess> &p_mapped_pack) {
 	path = p_path;
 	pf = p_file;
+	pos = 0;
+	eof = false;
+
+	if (p_mapped_pack.is_valid()) {
+		Span<uint8_t> pack_data = p_mapped_pack->get_mapped_data();
+		if (pf.offset <= pack_data.size() && pf.size <= pack_data.size() - pf.offset) {
+			mapped_pack = p_mapped_pack;
+			mapped_data = pack_data.ptr() + pf.offset;
+			off = pf.offset;
+			return;
+		}
+	}
+
 	if (pf.bundle) {
 		String simplified_path = p_path.simplify_path();
 		String path_to_load = simplified_path;
@@ -577,8 +935,6 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -667,7 +1023,7 @@ PackedData::PackedDir *DirAccessPack::_find_dir(const String &p_dir) {
 	PackedData::PackedDir *pd;
 
 	if (absolute) {
-		pd = PackedData::get_singleton()->root;
+		pd = PackedData::get_singleton()->_get_root();
 	} else {
 		pd = current;
 	}
@@ -746,5 +1102,5 @@ String DirAccessPack::get_filesystem_type() const {
 }
 
 DirAccessPack::DirAccessPack() {
-	current = PackedData::get_singleton()->root;
+	current = PackedData::get_singleton()->_get_root();
 }
@@ -33,9 +33,11 @@
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_uid.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
@@ -51,8 +53,14 @@ enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0,
 	PACK_REL_FILEBASE = 1 << 1,
 	PACK_SPARSE_BUNDLE = 1 << 2,
+	PACK_PATH_INDEX = 1 << 3,
 };
 
+// Positions of header fields, relative to the start of the pack.
+#define PACK_HEADER_FLAGS_POS 20
+// V4: 64-bit offset of the path index, stored in the reserved part of the header when PACK_PATH_INDEX is set.
+#define PACK_HEADER_PATH_INDEX_POS 72
+
 enum PackFileFlags {
 	PACK_FILE_ENCRYPTED = 1 << 0,
 	PACK_FILE_REMOVAL = 1 << 1,
@@ -107,26 +115,52 @@ private:
 		}
 	};
 
+	// A pack mounted without reading its directory, whose files are looked up through the
+	// perfect hash path index stored in the pack. See `build_path_index()` for the layout.
+	struct IndexedPack {
+		String pack;
+		PackSource *src = nullptr;
+		bool replace_files = false;
+		bool in_tree = false;
+
+		Ref<FileAccess> mapped_pack; // Keeps the mapping alive.
+		uint64_t file_base = 0;
+		const uint8_t *dir = nullptr;
+		uint64_t dir_size = 0;
+		uint32_t file_count = 0;
+		uint32_t bucket_count = 0;
+		const uint8_t *displacements = nullptr;
+		const uint8_t *slots = nullptr;
+	};
+
 	HashMap<PathMD5, PackedFile, PathMD5> files;
 	HashMap<PathMD5, Vector<PackedFile>, PathMD5> delta_patches;
+	LocalVector<IndexedPack> indexed_packs;
 
 	Vector<PackSource *> sources;
 
 	PackedDir *root = nullptr;
+	BinaryMutex root_mutex;
 
 	static inline PackedData *singleton = nullptr;
 	bool disabled = false;
 
 	void _free_packed_dirs(PackedDir *p_dir);
 	void _get_file_paths(PackedDir *p_dir, const String &p_parent_dir, HashSet<String> &r_paths) const;
+	void _add_to_tree(const String &p_simplified_path);
+	PackedDir *_get_root();
 
-	_FORCE_INLINE_ PathMD5 _get_simplified_path(const String &p_path) {
+	uint64_t _decode_indexed_record(const IndexedPack &p_pack, uint64_t p_ofs, String *r_path, PackedFile *r_file) const;
+	bool _find_indexed_file(const IndexedPack &p_pack, const String &p_simplified_path, uint64_t p_hash, PackedFile &r_file) const;
+	void _materialize_indexed_packs();
+	PackedFile *_find_file(const String &p_path, PackedFile &r_indexed_file);
+
+	_FORCE_INLINE_ String _get_simplified_path(const String &p_path) {
 		String simplified_path = p_path;
 		if (simplified_path.begins_with("uid://")) {
 			simplified_path = ResourceUID::uid_to_path(simplified_path);
 		}
-		simplified_path = simplified_path.simplify_path().trim_prefix("res://");
-		return PathMD5(simplified_path.md5_buffer());
+		return simplified_path.simplify_path().trim_prefix("res://");
 	}
 
 public:
@@ -136,7 +170,11 @@ public:
 	uint8_t *get_file_hash(const String &p_path);
 	Vector<PackedFile> get_delta_patches(const String &p_path) const;
 	bool has_delta_patches(const String &p_path) const;
-	HashSet<String> get_file_paths() const;
+	HashSet<String> get_file_paths();
+
+	static uint64_t hash_index_path(const String &p_simplified_path);
+	static bool build_path_index(const Vector<String> &p_paths, Vector<uint8_t> &r_index);
+	bool add_indexed_pack(const String &p_pkg_path, PackSource *p_src, bool p_replace_files, const Ref<FileAccess> &p_mapped_pack, uint64_t p_file_base, uint64_t p_dir_offset, uint64_t p_index_offset); // for PackSource
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -166,6 +204,9 @@ public:
 };
 
 class PackedSourcePCK : public PackSource {
+	// Packs kept mapped in memory, so their files can be read without their own file handle.
+	HashMap<String, Ref<FileAccess>> mapped_packs;
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) override;
@@ -189,6 +230,11 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+
+	// Set instead of `f` when the file is read straight from a memory-mapped pack.
+	const uint8_t *mapped_data = nullptr;
+	Ref<FileAccess> mapped_pack; // Keeps the mapping alive.
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual uint64_t _get_access_time(const String &p_file) override { return 0; }
@@ -215,6 +261,7 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_mapped_data() const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -228,31 +275,34 @@ public:
 
 	virtual void close() override;
 
-	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>());
+	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>(), const Ref<FileAccess> &p_mapped_pack = Ref<FileAccess>());
 };
 
 int64_t PackedData::get_size(const String &p_path) {
-	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(_get_simplified_path(p_path));
-	if (!E) {
+	PackedFile indexed_file;
+	PackedFile *pf = _find_file(p_path, indexed_file);
+	if (!pf) {
 		return -1; // File not found.
 	}
-	if (E->value.offset == 0) {
+	if (pf->offset == 0) {
 		return -1; // File was erased.
 	}
-	return E->value.size;
+	return pf->size;
 }
 
 Ref<FileAccess> PackedData::try_open_path(const String &p_path, const Vector<uint8_t> &p_decryption_key) {
-	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(_get_simplified_path(p_path));
-	if (!E) {
+	PackedFile indexed_file;
+	PackedFile *pf = _find_file(p_path, indexed_file);
+	if (!pf) {
 		return nullptr; // Not found.
 	}
 
-	return E->value.src->get_file(p_path, &E->value, p_decryption_key);
+	return pf->src->get_file(p_path, pf, p_decryption_key);
 }
 
 bool PackedData::has_path(const String &p_path) {
-	return files.has(_get_simplified_path(p_path));
+	PackedFile indexed_file;
+	return _find_file(p_path, indexed_file) != nullptr;
 }
 
 bool PackedData::has_directory(const String &p_path) {
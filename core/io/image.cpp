@@ -3716,6 +3716,10 @@ int64_t Image::get_data_size() const {
 	return data.size();
 }
 
+uint64_t Image::get_estimated_memory_usage() const {
+	return sizeof(Image) + data.size();
+}
+
 void Image::adjust_bcs(float p_brightness, float p_contrast, float p_saturation) {
 	ERR_FAIL_COND_MSG(is_compressed(), "Cannot adjust_bcs in compressed image formats.");
 
@@ -456,6 +456,7 @@ public:
 	const uint8_t *ptr() const;
 	uint8_t *ptrw();
 	int64_t get_data_size() const;
+	virtual uint64_t get_estimated_memory_usage() const override;
 
 	void adjust_bcs(float p_brightness, float p_contrast, float p_saturation);
 
@@ -40,3 +40,36 @@ Ref<NetSocket> NetSocket::create() {
 	ERR_PRINT("Unable to create network socket, platform not supported");
 	return nullptr;
 }
+
+Error NetSocket::recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received) {
+	r_received = 0;
+	const bool blocking = is_blocking_enabled();
+	while (r_received < p_count) {
+		if (blocking && r_received > 0 && poll(POLL_TYPE_IN, 0) != OK) {
+			break; // Don't block waiting for the next datagram.
+		}
+		Datagram &datagram = p_datagrams[r_received];
+		Error err = recvfrom(datagram.buffer, datagram.size, datagram.read, datagram.ip, datagram.port);
+		if (err != OK) {
+			// Non-blocking sockets end the batch with ERR_BUSY once drained.
+			// Report what we got so far, other errors will show up again on the next call.
+			return r_received ? OK : err;
+		}
+		r_received++;
+	}
+	return OK;
+}
+
+Error NetSocket::sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent) {
+	r_sent = 0;
+	while (r_sent < p_count) {
+		const Datagram &datagram = p_datagrams[r_sent];
+		int sent = 0;
+		Error err = sendto(datagram.buffer, datagram.size, sent, datagram.ip, datagram.port);
+		if (err != OK) {
+			return r_sent ? OK : err;
+		}
+		r_sent++;
+	}
+	return OK;
+}
@@ -94,6 +94,15 @@ public:
 		}
 	};
 
+	// A datagram for batched UDP I/O.
+	struct Datagram {
+		uint8_t *buffer = nullptr;
+		int size = 0; // Buffer capacity when receiving, data length when sending.
+		int read = 0; // Bytes received.
+		IPAddress ip;
+		uint16_t port = 0;
+	};
+
 	virtual Error open(Family p_family, Type p_type, IP::Type &r_ip_type) = 0;
 	virtual void close() = 0;
 	virtual Error bind(Address p_addr) = 0;
@@ -106,12 +115,18 @@ public:
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port) = 0;
 	virtual Ref<NetSocket> accept(Address &r_addr) = 0;
 
+	// Receive or send several datagrams, with as few system calls as the platform allows.
+	// Only the first datagram is waited for on blocking sockets. Errors after the first datagram end the batch early.
+	virtual Error recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received);
+	virtual Error sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent);
+
 	virtual bool is_open() const = 0;
 	virtual int get_available_bytes() const = 0;
 	virtual Error get_socket_address(Address *r_addr) const = 0;
 
 	virtual Error set_broadcasting_enabled(bool p_enabled) = 0; // Returns OK if the socket option has been set successfully.
 	virtual void set_blocking_enabled(bool p_enabled) = 0;
+	virtual bool is_blocking_enabled() const = 0;
 	virtual void set_ipv6_only_enabled(bool p_enabled) = 0;
 	virtual void set_tcp_no_delay_enabled(bool p_enabled) = 0;
 	virtual void set_reuse_address_enabled(bool p_enabled) = 0;
@@ -291,20 +291,18 @@ Error PacketPeerUDP::_poll() {
 		return OK; // Handled by UDPServer.
 	}
 
-	Error err;
-	int read;
-	IPAddress ip;
-	uint16_t port;
+	if (recv_buffer.is_empty()) {
+		recv_buffer.resize(PACKET_BUFFER_SIZE * RECV_BATCH_SIZE);
+	}
+	NetSocket::Datagram datagrams[RECV_BATCH_SIZE];
+	for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+		datagrams[i].buffer = recv_buffer.ptr() + i * PACKET_BUFFER_SIZE;
+		datagrams[i].size = PACKET_BUFFER_SIZE;
+	}
 
 	while (true) {
-		if (connected) {
-			err = _sock->recv(recv_buffer, sizeof(recv_buffer), read);
-			ip = peer_addr;
-			port = peer_port;
-		} else {
-			err = _sock->recvfrom(recv_buffer, sizeof(recv_buffer), read, ip, port);
-		}
-
+		int received = 0;
+		Error err = _sock->recvfrom_batch(datagrams, RECV_BATCH_SIZE, received);
 		if (err != OK) {
 			if (err == ERR_BUSY) {
 				break;
@@ -312,12 +310,22 @@ Error PacketPeerUDP::_poll() {
 			return FAILED;
 		}
 
-		err = store_packet(ip, port, recv_buffer, read);
+		for (int i = 0; i < received; i++) {
+			const NetSocket::Datagram &datagram = datagrams[i];
+			if (connected) {
+				err = store_packet(peer_addr, peer_port, datagram.buffer, datagram.read);
+			} else {
+				err = store_packet(datagram.ip, datagram.port, datagram.buffer, datagram.read);
+			}
 #ifdef TOOLS_ENABLED
-		if (err != OK) {
-			WARN_PRINT("Buffer full, dropping packets!");
-		}
+			if (err != OK) {
+				WARN_PRINT("Buffer full, dropping packets!");
+			}
 #endif
+		}
+		if (received < RECV_BATCH_SIZE) {
+			break; // Drained.
+		}
 	}
 
 	return OK;
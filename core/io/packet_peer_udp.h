@@ -33,6 +33,7 @@
 #include "core/io/ip_address.h"
 #include "core/io/net_socket.h"
 #include "core/io/packet_peer.h"
+#include "core/templates/local_vector.h"
 
 class UDPServer;
 
@@ -40,12 +41,18 @@ class PacketPeerUDP : public PacketPeer {
 	GDCLASS(PacketPeerUDP, PacketPeer);
 
 protected:
+	// Every batch slot must fit the largest UDP datagram: a batched receive fills slots in
+	// arrival order and silently truncates whatever doesn't fit, so smaller slots with a
+	// single large fallback can't be made lossless. The price is 512 KiB per listening
+	// socket, allocated on the first poll. ENet gets away with 4 KiB slots because its MTU
+	// is capped, arbitrary PacketPeerUDP traffic isn't.
 	enum {
-		PACKET_BUFFER_SIZE = 65536
+		PACKET_BUFFER_SIZE = 65536,
+		RECV_BATCH_SIZE = 8,
 	};
 
 	RingBuffer<uint8_t> rb;
-	uint8_t recv_buffer[PACKET_BUFFER_SIZE];
+	LocalVector<uint8_t> recv_buffer; // Room for RECV_BATCH_SIZE packets, allocated on first poll.
 	uint8_t packet_buffer[PACKET_BUFFER_SIZE];
 	IPAddress packet_ip;
 	int packet_port = 0;
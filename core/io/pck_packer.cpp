@@ -97,7 +97,7 @@ Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const Stri
 	file->store_32(GODOT_VERSION_MINOR);
 	file->store_32(GODOT_VERSION_PATCH);
 
-	uint32_t pack_flags = PACK_REL_FILEBASE;
+	pack_flags = PACK_REL_FILEBASE;
 	if (enc_dir) {
 		pack_flags |= PACK_DIR_ENCRYPTED;
 	}
@@ -277,6 +277,31 @@ Error PCKPacker::flush(bool p_verbose) {
 		fae.unref();
 	}
 
+	// Write the path index, so the pack can be mounted without reading the directory.
+	// Lookups go straight to the directory, so it can't be used if it's encrypted.
+	// Removals have to be applied to the packs loaded before, so they need the directory too.
+	Vector<String> paths;
+	if (!enc_dir) {
+		for (const File &pf : files) {
+			if (pf.removal) {
+				paths.clear();
+				break;
+			}
+			paths.push_back(pf.path);
+		}
+	}
+	Vector<uint8_t> path_index;
+	if (!paths.is_empty() && PackedData::build_path_index(paths, path_index)) {
+		uint64_t index_offset = file->get_position();
+		file->store_buffer(path_index);
+
+		pack_flags |= PACK_PATH_INDEX;
+		file->seek(PACK_HEADER_FLAGS_POS);
+		file->store_32(pack_flags);
+		file->seek(PACK_HEADER_PATH_INDEX_POS);
+		file->store_64(index_offset);
+	}
+
 	file.unref();
 	return OK;
 }
@@ -42,6 +42,7 @@ class PCKPacker : public RefCounted {
 
 	Vector<uint8_t> key;
 	bool enc_dir = false;
+	uint32_t pack_flags = 0;
 
 	uint64_t file_base = 0;
 	uint64_t file_base_ofs = 0;
@@ -627,6 +627,98 @@ RID Resource::get_rid() const {
 	return ret;
 }
 
+uint64_t Resource::get_estimated_memory_usage() const {
+	// Resources holding large buffers override this; everything else is charged a flat cost.
+	return sizeof(Resource);
+}
+
+static uint64_t _get_variant_estimated_memory_usage(const Variant &p_value, int p_depth) {
+	uint64_t size = sizeof(Variant);
+	switch (p_value.get_type()) {
+		case Variant::STRING: {
+			size += (p_value.operator String().length() + 1) * sizeof(char32_t);
+		} break;
+		// Bigger math types live in pooled allocations outside of the Variant.
+		case Variant::TRANSFORM2D: {
+			size += sizeof(Transform2D);
+		} break;
+		case Variant::AABB: {
+			size += sizeof(AABB);
+		} break;
+		case Variant::BASIS: {
+			size += sizeof(Basis);
+		} break;
+		case Variant::TRANSFORM3D: {
+			size += sizeof(Transform3D);
+		} break;
+		case Variant::PROJECTION: {
+			size += sizeof(Projection);
+		} break;
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			if (p_depth <= 0) {
+				size += array.size() * sizeof(Variant);
+				break;
+			}
+			for (const Variant &E : array) {
+				size += _get_variant_estimated_memory_usage(E, p_depth - 1);
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary dictionary = p_value;
+			if (p_depth <= 0) {
+				size += dictionary.size() * sizeof(Variant) * 2;
+				break;
+			}
+			for (const KeyValue<Variant, Variant> &kv : dictionary) {
+				size += _get_variant_estimated_memory_usage(kv.key, p_depth - 1);
+				size += _get_variant_estimated_memory_usage(kv.value, p_depth - 1);
+			}
+		} break;
+		case Variant::PACKED_BYTE_ARRAY: {
+			size += p_value.operator PackedByteArray().size();
+		} break;
+		case Variant::PACKED_INT32_ARRAY: {
+			size += p_value.operator PackedInt32Array().size() * sizeof(int32_t);
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			size += p_value.operator PackedInt64Array().size() * sizeof(int64_t);
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			size += p_value.operator PackedFloat32Array().size() * sizeof(float);
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			size += p_value.operator PackedFloat64Array().size() * sizeof(double);
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			for (const String &E : p_value.operator PackedStringArray()) {
+				size += sizeof(String) + (E.length() + 1) * sizeof(char32_t);
+			}
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			size += p_value.operator PackedVector2Array().size() * sizeof(Vector2);
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			size += p_value.operator PackedVector3Array().size() * sizeof(Vector3);
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			size += p_value.operator PackedColorArray().size() * sizeof(Color);
+		} break;
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			size += p_value.operator PackedVector4Array().size() * sizeof(Vector4);
+		} break;
+		default: {
+			// Stored inline, or a reference to an object accounted for by its owner.
+		} break;
+	}
+	return size;
+}
+
+uint64_t Resource::get_variant_estimated_memory_usage(const Variant &p_value) {
+	// Containers can reference themselves, so stop descending at some point.
+	return _get_variant_estimated_memory_usage(p_value, 8);
+}
+
 #ifdef TOOLS_ENABLED
 
 uint32_t Resource::hash_edited_version_for_preview() const {
@@ -811,7 +903,16 @@ Mutex ResourceCache::lock;
 RWLock ResourceCache::path_cache_lock;
 #endif
 
+LRUCache<String, ResourceCache::RetainedResource> ResourceCache::retained(INT32_MAX);
+uint64_t ResourceCache::retained_size = 0;
+uint64_t ResourceCache::retention_budget = 0;
+uint64_t ResourceCache::hit_count = 0;
+uint64_t ResourceCache::miss_count = 0;
+uint64_t ResourceCache::eviction_count = 0;
+
 void ResourceCache::clear() {
+	clear_retained();
+
 	if (!resources.is_empty()) {
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			ERR_PRINT(vformat("%d resources still in use at exit.", resources.size()));
@@ -897,3 +998,111 @@ int ResourceCache::get_cached_resource_count() {
 	MutexLock mutex_lock(lock);
 	return resources.size();
 }
+
+void ResourceCache::_trim_retained(LocalVector<Ref<Resource>> &r_released) {
+	while (retained_size > retention_budget) {
+		const LRUCache<String, RetainedResource>::Pair *oldest = retained.get_least_recent();
+		if (!oldest) {
+			break;
+		}
+		retained_size -= oldest->data.size;
+		r_released.push_back(oldest->data.resource);
+		eviction_count++;
+		const String path = oldest->key;
+		retained.erase(path);
+	}
+}
+
+void ResourceCache::_retain(const String &p_path, const Ref<Resource> &p_resource) {
+	if (retention_budget == 0 || p_resource.is_null()) {
+		return;
+	}
+
+	const uint64_t size = p_resource->get_estimated_memory_usage();
+
+	// Released resources are freed once the lock is gone, as that can cascade into freeing many others.
+	LocalVector<Ref<Resource>> released;
+	{
+		MutexLock mutex_lock(lock);
+
+		const RetainedResource *existing = retained.getptr(p_path);
+		if (existing) {
+			retained_size -= existing->size;
+			if (existing->resource != p_resource) {
+				released.push_back(existing->resource);
+			}
+		}
+
+		RetainedResource rr;
+		rr.resource = p_resource;
+		rr.size = size;
+		retained.insert(p_path, rr);
+		retained_size += size;
+
+		_trim_retained(released);
+	}
+}
+
+Ref<Resource> ResourceCache::_get_ref_for_load(const String &p_path) {
+	Ref<Resource> ref = get_ref(p_path);
+	{
+		MutexLock mutex_lock(lock);
+		if (ref.is_valid()) {
+			hit_count++;
+		} else {
+			miss_count++;
+		}
+	}
+	if (ref.is_valid()) {
+		_retain(p_path, ref);
+	}
+	return ref;
+}
+
+void ResourceCache::set_retention_budget(uint64_t p_bytes) {
+	LocalVector<Ref<Resource>> released;
+	{
+		MutexLock mutex_lock(lock);
+		retention_budget = p_bytes;
+		_trim_retained(released);
+	}
+}
+
+uint64_t ResourceCache::get_retention_budget() {
+	MutexLock mutex_lock(lock);
+	return retention_budget;
+}
+
+uint64_t ResourceCache::get_retained_size() {
+	MutexLock mutex_lock(lock);
+	return retained_size;
+}
+
+void ResourceCache::clear_retained() {
+	LocalVector<Ref<Resource>> released;
+	{
+		MutexLock mutex_lock(lock);
+		released.reserve(retained.get_size());
+		while (const LRUCache<String, RetainedResource>::Pair *oldest = retained.get_least_recent()) {
+			released.push_back(oldest->data.resource);
+			const String path = oldest->key;
+			retained.erase(path);
+		}
+		retained_size = 0;
+	}
+}
+
+uint64_t ResourceCache::get_hit_count() {
+	MutexLock mutex_lock(lock);
+	return hit_count;
+}
+
+uint64_t ResourceCache::get_miss_count() {
+	MutexLock mutex_lock(lock);
+	return miss_count;
+}
+
+uint64_t ResourceCache::get_eviction_count() {
+	MutexLock mutex_lock(lock);
+	return eviction_count;
+}
@@ -33,6 +33,7 @@
 #include "core/io/resource_uid.h" // IWYU pragma: export. Make available to all resources.
 #include "core/object/gdvirtual.gen.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/lru.h"
 #include "core/templates/self_list.h"
 
 class Node;
@@ -182,6 +183,8 @@ public:
 	void set_as_translation_remapped(bool p_remapped);
 
 	virtual RID get_rid() const; // Some resources may offer conversion to RID.
+	virtual uint64_t get_estimated_memory_usage() const; // Used to budget the resources retained by ResourceCache.
+	static uint64_t get_variant_estimated_memory_usage(const Variant &p_value); // Data owned by the value, referenced objects are not included.
 
 	// Helps keep IDs the same when loading/saving scenes. An empty ID clears the entry, and an empty ID is returned when not found.
 	static void set_resource_id_for_path(const String &p_referrer_path, const String &p_resource_path, const String &p_id);
@@ -207,9 +210,34 @@ class ResourceCache {
 	static void clear();
 	friend void register_core_types();
 
+	// Strong references to recently used resources, so they survive being released until the budget runs out.
+	struct RetainedResource {
+		Ref<Resource> resource;
+		uint64_t size = 0;
+	};
+	static LRUCache<String, RetainedResource> retained;
+	static uint64_t retained_size;
+	static uint64_t retention_budget;
+	static uint64_t hit_count;
+	static uint64_t miss_count;
+	static uint64_t eviction_count;
+
+	static void _trim_retained(LocalVector<Ref<Resource>> &r_released);
+	static void _retain(const String &p_path, const Ref<Resource> &p_resource);
+	static Ref<Resource> _get_ref_for_load(const String &p_path);
+
 public:
 	static bool has(const String &p_path);
 	static Ref<Resource> get_ref(const String &p_path);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+
+	static void set_retention_budget(uint64_t p_bytes);
+	static uint64_t get_retention_budget();
+	static uint64_t get_retained_size();
+	static void clear_retained();
+
+	static uint64_t get_hit_count();
+	static uint64_t get_miss_count();
+	static uint64_t get_eviction_count();
 };
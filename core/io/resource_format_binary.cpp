@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/missing_resource.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
@@ -101,11 +102,11 @@ enum {
 	FORMAT_VERSION_NO_NODEPATH_PROPERTY = 3,
 };
 
-void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
+void ResourceLoaderBinary::_advance_padding(Ref<FileAccess> &p_f, uint32_t p_len) {
 	uint32_t extra = 4 - (p_len % 4);
 	if (extra < 4) {
 		for (uint32_t i = 0; i < extra; i++) {
-			f->get_8(); //pad to 32
+			p_f->get_8(); //pad to 32
 		}
 	}
 }
@@ -138,25 +139,25 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	return OK;
 }
 
-StringName ResourceLoaderBinary::_get_string() {
-	uint32_t id = f->get_32();
+StringName ResourceLoaderBinary::_get_string(Ref<FileAccess> &p_f, Vector<char> &r_str_buf) const {
+	uint32_t id = p_f->get_32();
 	if (id & 0x80000000) {
 		uint32_t len = id & 0x7FFFFFFF;
-		if ((int)len > str_buf.size()) {
-			str_buf.resize(len);
+		if ((int)len > r_str_buf.size()) {
+			r_str_buf.resize(len);
 		}
 		if (len == 0) {
 			return StringName();
 		}
-		f->get_buffer((uint8_t *)&str_buf[0], len);
-		return String::utf8(&str_buf[0], len);
+		p_f->get_buffer((uint8_t *)&r_str_buf[0], len);
+		return String::utf8(&r_str_buf[0], len);
 	}
 
 	return string_map[id];
 }
 
-Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
-	uint32_t prop_type = f->get_32();
+Error ResourceLoaderBinary::parse_variant(Ref<FileAccess> &p_f, Vector<char> &r_str_buf, Variant &r_v, int p_resource_index) {
+	uint32_t prop_type = p_f->get_32();
 	print_bl("find property of type: " + itos(prop_type));
 
 	switch (prop_type) {
@@ -164,185 +165,185 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			r_v = Variant();
 		} break;
 		case VARIANT_BOOL: {
-			r_v = bool(f->get_32());
+			r_v = bool(p_f->get_32());
 		} break;
 		case VARIANT_INT: {
-			r_v = int(f->get_32());
+			r_v = int(p_f->get_32());
 		} break;
 		case VARIANT_INT64: {
-			r_v = int64_t(f->get_64());
+			r_v = int64_t(p_f->get_64());
 		} break;
 		case VARIANT_FLOAT: {
-			r_v = f->get_real();
+			r_v = p_f->get_real();
 		} break;
 		case VARIANT_DOUBLE: {
-			r_v = f->get_double();
+			r_v = p_f->get_double();
 		} break;
 		case VARIANT_STRING: {
-			r_v = get_unicode_string();
+			r_v = get_unicode_string(p_f, r_str_buf);
 		} break;
 		case VARIANT_VECTOR2: {
 			Vector2 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
+			v.x = p_f->get_real();
+			v.y = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_VECTOR2I: {
 			Vector2i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
+			v.x = p_f->get_32();
+			v.y = p_f->get_32();
 			r_v = v;
 
 		} break;
 		case VARIANT_RECT2: {
 			Rect2 v;
-			v.position.x = f->get_real();
-			v.position.y = f->get_real();
-			v.size.x = f->get_real();
-			v.size.y = f->get_real();
+			v.position.x = p_f->get_real();
+			v.position.y = p_f->get_real();
+			v.size.x = p_f->get_real();
+			v.size.y = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_RECT2I: {
 			Rect2i v;
-			v.position.x = f->get_32();
-			v.position.y = f->get_32();
-			v.size.x = f->get_32();
-			v.size.y = f->get_32();
+			v.position.x = p_f->get_32();
+			v.position.y = p_f->get_32();
+			v.size.x = p_f->get_32();
+			v.size.y = p_f->get_32();
 			r_v = v;
 
 		} break;
 		case VARIANT_VECTOR3: {
 			Vector3 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
+			v.x = p_f->get_real();
+			v.y = p_f->get_real();
+			v.z = p_f->get_real();
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR3I: {
 			Vector3i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
-			v.z = f->get_32();
+			v.x = p_f->get_32();
+			v.y = p_f->get_32();
+			v.z = p_f->get_32();
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR4: {
 			Vector4 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
-			v.w = f->get_real();
+			v.x = p_f->get_real();
+			v.y = p_f->get_real();
+			v.z = p_f->get_real();
+			v.w = p_f->get_real();
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR4I: {
 			Vector4i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
-			v.z = f->get_32();
-			v.w = f->get_32();
+			v.x = p_f->get_32();
+			v.y = p_f->get_32();
+			v.z = p_f->get_32();
+			v.w = p_f->get_32();
 			r_v = v;
 		} break;
 		case VARIANT_PLANE: {
 			Plane v;
-			v.normal.x = f->get_real();
-			v.normal.y = f->get_real();
-			v.normal.z = f->get_real();
-			v.d = f->get_real();
+			v.normal.x = p_f->get_real();
+			v.normal.y = p_f->get_real();
+			v.normal.z = p_f->get_real();
+			v.d = p_f->get_real();
 			r_v = v;
 		} break;
 		case VARIANT_QUATERNION: {
 			Quaternion v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
-			v.w = f->get_real();
+			v.x = p_f->get_real();
+			v.y = p_f->get_real();
+			v.z = p_f->get_real();
+			v.w = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_AABB: {
 			AABB v;
-			v.position.x = f->get_real();
-			v.position.y = f->get_real();
-			v.position.z = f->get_real();
-			v.size.x = f->get_real();
-			v.size.y = f->get_real();
-			v.size.z = f->get_real();
+			v.position.x = p_f->get_real();
+			v.position.y = p_f->get_real();
+			v.position.z = p_f->get_real();
+			v.size.x = p_f->get_real();
+			v.size.y = p_f->get_real();
+			v.size.z = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_TRANSFORM2D: {
 			Transform2D v;
-			v.columns[0].x = f->get_real();
-			v.columns[0].y = f->get_real();
-			v.columns[1].x = f->get_real();
-			v.columns[1].y = f->get_real();
-			v.columns[2].x = f->get_real();
-			v.columns[2].y = f->get_real();
+			v.columns[0].x = p_f->get_real();
+			v.columns[0].y = p_f->get_real();
+			v.columns[1].x = p_f->get_real();
+			v.columns[1].y = p_f->get_real();
+			v.columns[2].x = p_f->get_real();
+			v.columns[2].y = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_BASIS: {
 			Basis v;
-			v.rows[0].x = f->get_real();
-			v.rows[0].y = f->get_real();
-			v.rows[0].z = f->get_real();
-			v.rows[1].x = f->get_real();
-			v.rows[1].y = f->get_real();
-			v.rows[1].z = f->get_real();
-			v.rows[2].x = f->get_real();
-			v.rows[2].y = f->get_real();
-			v.rows[2].z = f->get_real();
+			v.rows[0].x = p_f->get_real();
+			v.rows[0].y = p_f->get_real();
+			v.rows[0].z = p_f->get_real();
+			v.rows[1].x = p_f->get_real();
+			v.rows[1].y = p_f->get_real();
+			v.rows[1].z = p_f->get_real();
+			v.rows[2].x = p_f->get_real();
+			v.rows[2].y = p_f->get_real();
+			v.rows[2].z = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_TRANSFORM3D: {
 			Transform3D v;
-			v.basis.rows[0].x = f->get_real();
-			v.basis.rows[0].y = f->get_real();
-			v.basis.rows[0].z = f->get_real();
-			v.basis.rows[1].x = f->get_real();
-			v.basis.rows[1].y = f->get_real();
-			v.basis.rows[1].z = f->get_real();
-			v.basis.rows[2].x = f->get_real();
-			v.basis.rows[2].y = f->get_real();
-			v.basis.rows[2].z = f->get_real();
-			v.origin.x = f->get_real();
-			v.origin.y = f->get_real();
-			v.origin.z = f->get_real();
+			v.basis.rows[0].x = p_f->get_real();
+			v.basis.rows[0].y = p_f->get_real();
+			v.basis.rows[0].z = p_f->get_real();
+			v.basis.rows[1].x = p_f->get_real();
+			v.basis.rows[1].y = p_f->get_real();
+			v.basis.rows[1].z = p_f->get_real();
+			v.basis.rows[2].x = p_f->get_real();
+			v.basis.rows[2].y = p_f->get_real();
+			v.basis.rows[2].z = p_f->get_real();
+			v.origin.x = p_f->get_real();
+			v.origin.y = p_f->get_real();
+			v.origin.z = p_f->get_real();
 			r_v = v;
 		} break;
 		case VARIANT_PROJECTION: {
 			Projection v;
-			v.columns[0].x = f->get_real();
-			v.columns[0].y = f->get_real();
-			v.columns[0].z = f->get_real();
-			v.columns[0].w = f->get_real();
-			v.columns[1].x = f->get_real();
-			v.columns[1].y = f->get_real();
-			v.columns[1].z = f->get_real();
-			v.columns[1].w = f->get_real();
-			v.columns[2].x = f->get_real();
-			v.columns[2].y = f->get_real();
-			v.columns[2].z = f->get_real();
-			v.columns[2].w = f->get_real();
-			v.columns[3].x = f->get_real();
-			v.columns[3].y = f->get_real();
-			v.columns[3].z = f->get_real();
-			v.columns[3].w = f->get_real();
+			v.columns[0].x = p_f->get_real();
+			v.columns[0].y = p_f->get_real();
+			v.columns[0].z = p_f->get_real();
+			v.columns[0].w = p_f->get_real();
+			v.columns[1].x = p_f->get_real();
+			v.columns[1].y = p_f->get_real();
+			v.columns[1].z = p_f->get_real();
+			v.columns[1].w = p_f->get_real();
+			v.columns[2].x = p_f->get_real();
+			v.columns[2].y = p_f->get_real();
+			v.columns[2].z = p_f->get_real();
+			v.columns[2].w = p_f->get_real();
+			v.columns[3].x = p_f->get_real();
+			v.columns[3].y = p_f->get_real();
+			v.columns[3].z = p_f->get_real();
+			v.columns[3].w = p_f->get_real();
 			r_v = v;
 		} break;
 		case VARIANT_COLOR: {
 			Color v; // Colors should always be in single-precision.
-			v.r = f->get_float();
-			v.g = f->get_float();
-			v.b = f->get_float();
-			v.a = f->get_float();
+			v.r = p_f->get_float();
+			v.g = p_f->get_float();
+			v.b = p_f->get_float();
+			v.a = p_f->get_float();
 			r_v = v;
 
 		} break;
 		case VARIANT_STRING_NAME: {
-			r_v = StringName(get_unicode_string());
+			r_v = StringName(get_unicode_string(p_f, r_str_buf));
 		} break;
 
 		case VARIANT_NODE_PATH: {
@@ -350,8 +351,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<StringName> subnames;
 			bool absolute;
 
-			int name_count = f->get_16();
-			uint32_t subname_count = f->get_16();
+			int name_count = p_f->get_16();
+			uint32_t subname_count = p_f->get_16();
 			absolute = subname_count & 0x8000;
 			subname_count &= 0x7FFF;
 			if (ver_format < FORMAT_VERSION_NO_NODEPATH_PROPERTY) {
@@ -359,10 +360,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			}
 
 			for (int i = 0; i < name_count; i++) {
-				names.push_back(_get_string());
+				names.push_back(_get_string(p_f, r_str_buf));
 			}
 			for (uint32_t i = 0; i < subname_count; i++) {
-				subnames.push_back(_get_string());
+				subnames.push_back(_get_string(p_f, r_str_buf));
 			}
 
 			NodePath np = NodePath(names, subnames, absolute);
@@ -371,10 +372,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 
 		} break;
 		case VARIANT_RID: {
-			r_v = f->get_32();
+			r_v = p_f->get_32();
 		} break;
 		case VARIANT_OBJECT: {
-			uint32_t objtype = f->get_32();
+			uint32_t objtype = p_f->get_32();
 
 			switch (objtype) {
 				case OBJECT_EMPTY: {
@@ -382,7 +383,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 
 				} break;
 				case OBJECT_INTERNAL_RESOURCE: {
-					uint32_t index = f->get_32();
+					uint32_t index = p_f->get_32();
 					String path;
 
 					if (using_named_scene_ids) { // New format.
@@ -392,19 +393,20 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						path += res_path + "::" + itos(index);
 					}
 
-					//always use internal cache for loading internal resources
-					if (!internal_index_cache.has(path)) {
+					//always use internal cache for loading internal resources, but only those loaded before this one
+					const Ref<Resource> *cached = (using_named_scene_ids && (int)index >= p_resource_index) ? nullptr : internal_index_cache.getptr(path);
+					if (!cached) {
 						WARN_PRINT(vformat("Couldn't load resource (no cache): %s.", path));
 						r_v = Variant();
 					} else {
-						r_v = internal_index_cache[path];
+						r_v = *cached;
 					}
 				} break;
 				case OBJECT_EXTERNAL_RESOURCE: {
 					//old file format, still around for compatibility
 
-					String exttype = get_unicode_string();
-					String path = get_unicode_string();
+					String exttype = get_unicode_string(p_f, r_str_buf);
+					String path = get_unicode_string(p_f, r_str_buf);
 
 					if (!path.contains("://") && path.is_relative_path()) {
 						// path is relative to file being loaded, so convert to a resource path
@@ -425,28 +427,15 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 				} break;
 				case OBJECT_EXTERNAL_RESOURCE_INDEX: {
 					//new file format, just refers to an index in the external list
-					int erindex = f->get_32();
+					int erindex = p_f->get_32();
 
 					if (erindex < 0 || erindex >= external_resources.size()) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
 					} else {
-						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
-						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
-							Error err;
-							Ref<Resource> res = ResourceLoader::_load_complete(*load_token.ptr(), &err);
-							if (res.is_null()) {
-								if (!ResourceLoader::is_cleaning_tasks()) {
-									if (!ResourceLoader::get_abort_on_missing_resources()) {
-										ResourceLoader::notify_dependency_error(local_path, external_resources[erindex].path, external_resources[erindex].type);
-									} else {
-										error = ERR_FILE_MISSING_DEPENDENCIES;
-										ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", external_resources[erindex].path));
-									}
-								}
-							} else {
-								r_v = res;
-							}
+						Error err = _get_external_resource(erindex, r_v);
+						if (err != OK) {
+							return err;
 						}
 					}
 				} break;
@@ -463,28 +452,28 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 
 		case VARIANT_DICTIONARY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 			Dictionary d; //last bit means shared
 			len &= 0x7FFFFFFF;
 			for (uint32_t i = 0; i < len; i++) {
 				Variant key;
-				Error err = parse_variant(key);
+				Error err = parse_variant(p_f, r_str_buf, key, p_resource_index);
 				ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, "Error when trying to parse Variant.");
 				Variant value;
-				err = parse_variant(value);
+				err = parse_variant(p_f, r_str_buf, value, p_resource_index);
 				ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, "Error when trying to parse Variant.");
 				d[key] = value;
 			}
 			r_v = d;
 		} break;
 		case VARIANT_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 			Array a; //last bit means shared
 			len &= 0x7FFFFFFF;
 			a.resize(len);
 			for (uint32_t i = 0; i < len; i++) {
 				Variant val;
-				Error err = parse_variant(val);
+				Error err = parse_variant(p_f, r_str_buf, val, p_resource_index);
 				ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, "Error when trying to parse Variant.");
 				a[i] = val;
 			}
@@ -492,115 +481,115 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 
 		} break;
 		case VARIANT_PACKED_BYTE_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<uint8_t> array;
 			array.resize(len);
 			uint8_t *w = array.ptrw();
-			f->get_buffer(w, len);
-			_advance_padding(len);
+			p_f->get_buffer(w, len);
+			_advance_padding(p_f, len);
 
 			r_v = array;
 
 		} break;
 		case VARIANT_PACKED_INT32_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<int32_t> array;
 			array.resize(len);
 			int32_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
+			p_f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
 
 			r_v = array;
 		} break;
 		case VARIANT_PACKED_INT64_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<int64_t> array;
 			array.resize(len);
 			int64_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
+			p_f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
 
 			r_v = array;
 		} break;
 		case VARIANT_PACKED_FLOAT32_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<float> array;
 			array.resize(len);
 			float *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(float));
+			p_f->get_buffer((uint8_t *)w, len * sizeof(float));
 
 			r_v = array;
 		} break;
 		case VARIANT_PACKED_FLOAT64_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<double> array;
 			array.resize(len);
 			double *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(double));
+			p_f->get_buffer((uint8_t *)w, len * sizeof(double));
 
 			r_v = array;
 		} break;
 		case VARIANT_PACKED_STRING_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 			Vector<String> array;
 			array.resize(len);
 			String *w = array.ptrw();
 			for (uint32_t i = 0; i < len; i++) {
-				w[i] = get_unicode_string();
+				w[i] = get_unicode_string(p_f, r_str_buf);
 			}
 
 			r_v = array;
 
 		} break;
 		case VARIANT_PACKED_VECTOR2_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<Vector2> array;
 			array.resize(len);
 			Vector2 *w = array.ptrw();
 			static_assert(sizeof(Vector2) == 2 * sizeof(real_t));
-			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 2);
+			const Error err = read_reals(reinterpret_cast<real_t *>(w), p_f, len * 2);
 			ERR_FAIL_COND_V(err != OK, err);
 
 			r_v = array;
 
 		} break;
 		case VARIANT_PACKED_VECTOR3_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<Vector3> array;
 			array.resize(len);
 			Vector3 *w = array.ptrw();
 			static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
-			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 3);
+			const Error err = read_reals(reinterpret_cast<real_t *>(w), p_f, len * 3);
 			ERR_FAIL_COND_V(err != OK, err);
 
 			r_v = array;
 
 		} break;
 		case VARIANT_PACKED_COLOR_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<Color> array;
 			array.resize(len);
 			Color *w = array.ptrw();
 			// Colors always use `float` even with double-precision support enabled
 			static_assert(sizeof(Color) == 4 * sizeof(float));
-			f->get_buffer((uint8_t *)w, len * sizeof(float) * 4);
+			p_f->get_buffer((uint8_t *)w, len * sizeof(float) * 4);
 
 			r_v = array;
 		} break;
 		case VARIANT_PACKED_VECTOR4_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<Vector4> array;
 			array.resize(len);
 			Vector4 *w = array.ptrw();
 			static_assert(sizeof(Vector4) == 4 * sizeof(real_t));
-			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 4);
+			const Error err = read_reals(reinterpret_cast<real_t *>(w), p_f, len * 4);
 			ERR_FAIL_COND_V(err != OK, err);
 
 			r_v = array;
@@ -614,6 +603,37 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 	return OK; //never reach anyway
 }
 
+Error ResourceLoaderBinary::_get_external_resource(int p_index, Variant &r_v) {
+	// Only the first use completes the load, so that sub-resources parsed on worker threads never modify the list.
+	if (!external_resources[p_index].resolved) {
+		ExtResource &er = external_resources.write[p_index];
+		er.resolved = true;
+		if (er.load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
+			Error err;
+			er.resource = ResourceLoader::_load_complete(*er.load_token.ptr(), &err);
+			if (er.resource.is_null()) {
+				if (!ResourceLoader::is_cleaning_tasks()) {
+					if (!ResourceLoader::get_abort_on_missing_resources()) {
+						ResourceLoader::notify_dependency_error(local_path, er.path, er.type);
+					} else {
+						er.error = ERR_FILE_MISSING_DEPENDENCIES;
+					}
+				}
+			}
+		}
+	}
+
+	const ExtResource &er = external_resources[p_index];
+	if (er.error != OK) {
+		error = er.error;
+		ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", er.path));
+	}
+	if (er.resource.is_valid()) {
+		r_v = er.resource;
+	}
+	return OK;
+}
+
 Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
@@ -647,195 +667,328 @@ Error ResourceLoaderBinary::load() {
 		}
 	}
 
+	if (use_sub_threads && using_named_scene_ids && internal_resources.size() > 2 && WorkerThreadPool::get_singleton()) {
+		return _load_internal_resources_threaded();
+	}
+
 	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+		InternalResourceLoad irl;
+		error = _begin_internal_resource(i, irl);
+		if (error) {
+			return error;
+		}
+		if (irl.res.is_null()) {
+			continue; // Already loaded.
+		}
 
-		//maybe it is loaded already
-		String path;
-		String id;
+		error = _parse_internal_resource(f, str_buf, irl);
+		if (error) {
+			return error;
+		}
 
-		if (!main) {
-			path = internal_resources[i].path;
+		if (_finish_internal_resource(i, irl)) {
+			return OK;
+		}
+	}
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	return ERR_FILE_EOF;
+}
 
-				internal_resources.write[i].path = path; // Update path.
-			}
+Error ResourceLoaderBinary::_begin_internal_resource(int p_index, InternalResourceLoad &r_load) {
+	bool main = p_index == (internal_resources.size() - 1);
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
-				}
-			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+	//maybe it is loaded already
+	String path;
+	String id;
+
+	if (!main) {
+		path = internal_resources[p_index].path;
+
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
+
+			internal_resources.write[p_index].path = path; // Update path.
+		}
+
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				error = OK;
+				internal_index_cache[path] = cached;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
+	}
 
-		uint64_t offset = internal_resources[i].offset;
+	uint64_t offset = internal_resources[p_index].offset;
 
-		f->seek(offset);
+	f->seek(offset);
 
-		String t = get_unicode_string();
+	String t = get_unicode_string();
 
-		Ref<Resource> res;
-		Resource *r = nullptr;
+	Ref<Resource> res;
+	Resource *r = nullptr;
 
-		Ref<MissingResource> missing_resource;
+	Ref<MissingResource> missing_resource;
 
-		if (main) {
-			res = ResourceLoader::get_resource_ref_override(local_path);
-			r = res.ptr();
-		}
-		if (!r) {
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-				//use the existing one
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached->get_class() == t) {
-					cached->reset_state();
-					res = cached;
-				}
+	if (main) {
+		res = ResourceLoader::get_resource_ref_override(local_path);
+		r = res.ptr();
+	}
+	if (!r) {
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+			//use the existing one
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached->get_class() == t) {
+				cached->reset_state();
+				res = cached;
 			}
+		}
 
-			if (res.is_null()) {
-				//did not replace
-
-				Object *obj = ClassDB::instantiate(t);
-				if (!obj) {
-					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						//create a missing resource
-						missing_resource = memnew(MissingResource);
-						missing_resource->set_original_class(t);
-						missing_resource->set_recording_properties(true);
-						obj = missing_resource.ptr();
-					} else {
-						error = ERR_FILE_CORRUPT;
-						ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
-					}
-				}
-
-				r = Object::cast_to<Resource>(obj);
-				if (!r) {
-					String obj_class = obj->get_class();
+		if (res.is_null()) {
+			//did not replace
+
+			Object *obj = ClassDB::instantiate(t);
+			if (!obj) {
+				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+					//create a missing resource
+					missing_resource = memnew(MissingResource);
+					missing_resource->set_original_class(t);
+					missing_resource->set_recording_properties(true);
+					obj = missing_resource.ptr();
+				} else {
 					error = ERR_FILE_CORRUPT;
-					memdelete(obj); //bye
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
+					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
 				}
+			}
 
-				res = Ref<Resource>(r);
+			r = Object::cast_to<Resource>(obj);
+			if (!r) {
+				String obj_class = obj->get_class();
+				error = ERR_FILE_CORRUPT;
+				memdelete(obj); //bye
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
 			}
+
+			res = Ref<Resource>(r);
 		}
+	}
 
-		if (r) {
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
-				} else {
-					r->set_path_cache(path);
-				}
+	if (r) {
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+			} else {
+				r->set_path_cache(path);
 			}
-			r->set_scene_unique_id(id);
 		}
+		r->set_scene_unique_id(id);
+	}
+
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
+
+	r_load.index = p_index;
+	r_load.res = res;
+	r_load.missing_resource = missing_resource;
+	return OK;
+}
+
+Error ResourceLoaderBinary::_parse_internal_resource(Ref<FileAccess> &p_f, Vector<char> &r_str_buf, InternalResourceLoad &r_load) {
+	int pc = p_f->get_32();
+	r_load.properties.resize(pc);
 
-		if (!main) {
-			internal_index_cache[path] = res;
+	for (int j = 0; j < pc; j++) {
+		Pair<StringName, Variant> &property = r_load.properties[j];
+		property.first = _get_string(p_f, r_str_buf);
+
+		if (property.first == StringName()) {
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
 		}
 
-		int pc = f->get_32();
+		Error err = parse_variant(p_f, r_str_buf, property.second, r_load.index);
+		if (err) {
+			return err;
+		}
+	}
 
-		//set properties
+	return OK;
+}
 
-		Dictionary missing_resource_properties;
+void ResourceLoaderBinary::_parse_internal_resource_task(InternalResourceLoad *p_load) {
+	p_load->error = _parse_internal_resource(p_load->f, p_load->str_buf, *p_load);
+	p_load->f.unref();
+}
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+bool ResourceLoaderBinary::_finish_internal_resource(int p_index, InternalResourceLoad &p_load) {
+	bool main = p_index == (internal_resources.size() - 1);
+	Ref<Resource> &res = p_load.res;
+	Ref<MissingResource> &missing_resource = p_load.missing_resource;
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+	//set properties
 
-			Variant value;
+	Dictionary missing_resource_properties;
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+	for (Pair<StringName, Variant> &property : p_load.properties) {
+		const StringName &name = property.first;
+		Variant &value = property.second;
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource.is_null() && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && missing_resource.is_null() && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
+		}
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
 				}
 			}
+		}
 
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
+		if (value.get_type() == Variant::DICTIONARY) {
+			Dictionary set_dict = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+				Dictionary get_dict = get_value;
+				if (!set_dict.is_same_typed(get_dict)) {
+					value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+							get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
 				}
 			}
-
-			if (set_valid) {
-				res->set(name, value);
-			}
 		}
 
-		if (missing_resource.is_valid()) {
-			missing_resource->set_recording_properties(false);
+		if (set_valid) {
+			res->set(name, value);
 		}
+	}
+	p_load.properties.clear();
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
-		}
+	if (missing_resource.is_valid()) {
+		missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
 
 #ifdef TOOLS_ENABLED
-		res->set_edited(false);
+	res->set_edited(false);
 #endif
 
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+	if (progress) {
+		*progress = (p_index + 1) / float(internal_resources.size());
+	}
+
+	resource_cache.push_back(res);
+
+	if (main) {
+		f.unref();
+		resource = res;
+		resource->set_as_translation_remapped(translation_remapped);
+		error = OK;
+	}
+	return main;
+}
+
+Error ResourceLoaderBinary::_load_internal_resources_threaded() {
+	// Complete the external loads first, since tasks can only look them up.
+	for (int i = 0; i < external_resources.size(); i++) {
+		Variant unused;
+		error = _get_external_resource(i, unused);
+		if (error) {
+			return error;
+		}
+	}
+
+	// Instance every resource in order, so references between them resolve while parsing.
+	LocalVector<InternalResourceLoad> loads;
+	loads.resize(internal_resources.size());
+	LocalVector<uint64_t> data_offsets;
+	for (int i = 0; i < internal_resources.size(); i++) {
+		error = _begin_internal_resource(i, loads[i]);
+		if (error) {
+			return error;
 		}
+		data_offsets.push_back(loads[i].res.is_valid() ? f->get_position() : 0);
+	}
 
-		resource_cache.push_back(res);
+	// The data of each resource runs until the next one starts, or the end of the file.
+	Vector<uint64_t> starts;
+	for (const IntResource &ir : internal_resources) {
+		starts.push_back(ir.offset);
+	}
+	starts.push_back(f->get_length());
+	starts.sort();
 
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
+	Span<uint8_t> mapped = f->get_mapped_data();
+	for (uint32_t i = 0; i < loads.size(); i++) {
+		if (loads[i].res.is_null()) {
+			continue;
+		}
+
+		uint64_t begin = data_offsets[i];
+		int next = starts.bsearch(begin, false);
+		ERR_FAIL_INDEX_V(next, starts.size(), ERR_FILE_CORRUPT);
+		uint64_t size = starts[next] - begin;
+
+		Ref<FileAccessMemory> fm;
+		fm.instantiate();
+		if (mapped.size() >= begin + size) {
+			fm->open_custom(mapped.ptr() + begin, size);
+		} else {
+			Vector<uint8_t> &data = loads[i].data;
+			data.resize(size);
+			f->seek(begin);
+			ERR_FAIL_COND_V(f->get_buffer(data.ptrw(), size) != size, ERR_FILE_CORRUPT);
+			fm->open_custom(data.ptr(), size);
+		}
+		fm->set_big_endian(f->is_big_endian());
+		fm->real_is_double = f->real_is_double;
+		loads[i].f = fm;
+	}
+
+	for (InternalResourceLoad &irl : loads) {
+		if (irl.f.is_valid()) {
+			irl.task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &ResourceLoaderBinary::_parse_internal_resource_task, &irl, true, SNAME("ResourceLoaderBinary"));
+		}
+	}
+	for (InternalResourceLoad &irl : loads) {
+		if (irl.task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(irl.task_id);
+		}
+	}
+
+	for (uint32_t i = 0; i < loads.size(); i++) {
+		if (loads[i].res.is_null()) {
+			continue;
+		}
+		if (loads[i].error) {
+			error = loads[i].error;
+			return error;
+		}
+		if (_finish_internal_resource(i, loads[i])) {
 			return OK;
 		}
 	}
@@ -861,16 +1014,20 @@ static String get_ustring(Ref<FileAccess> f) {
 	return String::utf8(&str_buf[0], len);
 }
 
-String ResourceLoaderBinary::get_unicode_string() {
-	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
+String ResourceLoaderBinary::get_unicode_string(Ref<FileAccess> &p_f, Vector<char> &r_str_buf) {
+	int len = p_f->get_32();
+	if (len > r_str_buf.size()) {
+		r_str_buf.resize(len);
 	}
 	if (len == 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
-	return String::utf8(&str_buf[0], len);
+	p_f->get_buffer((uint8_t *)&r_str_buf[0], len);
+	return String::utf8(&r_str_buf[0], len);
+}
+
+String ResourceLoaderBinary::get_unicode_string() {
+	return get_unicode_string(f, str_buf);
 }
 
 void ResourceLoaderBinary::get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes) {
@@ -33,8 +33,12 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 
+class MissingResource;
+
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
 	String local_path;
@@ -54,13 +58,16 @@ class ResourceLoaderBinary {
 
 	Vector<StringName> string_map;
 
-	StringName _get_string();
+	StringName _get_string(Ref<FileAccess> &p_f, Vector<char> &r_str_buf) const;
 
 	struct ExtResource {
 		String path;
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		Ref<Resource> resource;
+		Error error = OK;
+		bool resolved = false;
 	};
 
 	bool using_named_scene_ids = false;
@@ -78,8 +85,23 @@ class ResourceLoaderBinary {
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
+	// An internal resource being loaded; its properties are parsed before being set.
+	struct InternalResourceLoad {
+		int index = 0;
+		Ref<Resource> res;
+		Ref<MissingResource> missing_resource;
+		LocalVector<Pair<StringName, Variant>> properties;
+		// Only used by threaded loading, which parses each resource from memory.
+		Ref<FileAccess> f;
+		Vector<uint8_t> data;
+		Vector<char> str_buf;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+		Error error = OK;
+	};
+
+	static String get_unicode_string(Ref<FileAccess> &p_f, Vector<char> &r_str_buf);
 	String get_unicode_string();
-	void _advance_padding(uint32_t p_len);
+	static void _advance_padding(Ref<FileAccess> &p_f, uint32_t p_len);
 
 	HashMap<String, String> remaps;
 	Error error = OK;
@@ -89,7 +111,14 @@ class ResourceLoaderBinary {
 
 	friend class ResourceFormatLoaderBinary;
 
-	Error parse_variant(Variant &r_v);
+	Error parse_variant(Ref<FileAccess> &p_f, Vector<char> &r_str_buf, Variant &r_v, int p_resource_index);
+	Error _get_external_resource(int p_index, Variant &r_v);
+
+	Error _begin_internal_resource(int p_index, InternalResourceLoad &r_load);
+	Error _parse_internal_resource(Ref<FileAccess> &p_f, Vector<char> &r_str_buf, InternalResourceLoad &r_load);
+	void _parse_internal_resource_task(InternalResourceLoad *p_load);
+	bool _finish_internal_resource(int p_index, InternalResourceLoad &p_load);
+	Error _load_internal_resources_threaded();
 
 	HashMap<String, Ref<Resource>> dependency_cache;
 
@@ -451,6 +451,7 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 			if (pending_unlock) {
 				ResourceCache::lock.unlock();
 			}
+			ResourceCache::_retain(load_task.local_path, load_task.resource);
 		} else {
 			load_task.resource->set_path_cache(load_task.local_path);
 		}
@@ -616,7 +617,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task.cache_mode = p_cache_mode;
 			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE;
 			if (p_cache_mode == CACHE_MODE_REUSE) {
-				Ref<Resource> existing = ResourceCache::get_ref(local_path);
+				Ref<Resource> existing = ResourceCache::_get_ref_for_load(local_path);
 				if (existing.is_valid()) {
 					//referencing is fine
 					load_task.resource = existing;
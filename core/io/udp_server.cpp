@@ -50,40 +50,51 @@ Error UDPServer::poll() {
 	if (!_sock->is_open()) {
 		return ERR_UNCONFIGURED;
 	}
-	Error err;
-	int read;
-	IPAddress ip;
-	uint16_t port;
+	if (recv_buffer.is_empty()) {
+		recv_buffer.resize(PACKET_BUFFER_SIZE * RECV_BATCH_SIZE);
+	}
+	NetSocket::Datagram datagrams[RECV_BATCH_SIZE];
+	for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+		datagrams[i].buffer = recv_buffer.ptr() + i * PACKET_BUFFER_SIZE;
+		datagrams[i].size = PACKET_BUFFER_SIZE;
+	}
 	while (true) {
-		err = _sock->recvfrom(recv_buffer, sizeof(recv_buffer), read, ip, port);
+		int received = 0;
+		Error err = _sock->recvfrom_batch(datagrams, RECV_BATCH_SIZE, received);
 		if (err != OK) {
 			if (err == ERR_BUSY) {
 				break;
 			}
 			return FAILED;
 		}
-		Peer p;
-		p.ip = ip;
-		p.port = port;
-		List<Peer>::Element *E = peers.find(p);
-		if (!E) {
-			E = pending.find(p);
-		}
-		if (E) {
-			E->get().peer->store_packet(ip, port, recv_buffer, read);
-		} else {
-			if (pending.size() >= max_pending_connections) {
-				// Drop connection.
-				continue;
+		for (int i = 0; i < received; i++) {
+			const NetSocket::Datagram &datagram = datagrams[i];
+			Peer p;
+			p.ip = datagram.ip;
+			p.port = datagram.port;
+			List<Peer>::Element *E = peers.find(p);
+			if (!E) {
+				E = pending.find(p);
+			}
+			if (E) {
+				E->get().peer->store_packet(datagram.ip, datagram.port, datagram.buffer, datagram.read);
+			} else {
+				if (pending.size() >= max_pending_connections) {
+					// Drop connection.
+					continue;
+				}
+				// It's a new peer, add it to the pending list.
+				Peer peer;
+				peer.ip = datagram.ip;
+				peer.port = datagram.port;
+				peer.peer = memnew(PacketPeerUDP);
+				peer.peer->connect_shared_socket(_sock, datagram.ip, datagram.port, this);
+				peer.peer->store_packet(datagram.ip, datagram.port, datagram.buffer, datagram.read);
+				pending.push_back(peer);
 			}
-			// It's a new peer, add it to the pending list.
-			Peer peer;
-			peer.ip = ip;
-			peer.port = port;
-			peer.peer = memnew(PacketPeerUDP);
-			peer.peer->connect_shared_socket(_sock, ip, port, this);
-			peer.peer->store_packet(ip, port, recv_buffer, read);
-			pending.push_back(peer);
+		}
+		if (received < RECV_BATCH_SIZE) {
+			break; // Drained.
 		}
 	}
 	return OK;
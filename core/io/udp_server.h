@@ -37,8 +37,14 @@ class UDPServer : public RefCounted {
 	GDCLASS(UDPServer, RefCounted);
 
 protected:
+	// Every batch slot must fit the largest UDP datagram: a batched receive fills slots in
+	// arrival order and silently truncates whatever doesn't fit, so smaller slots with a
+	// single large fallback can't be made lossless. The price is 512 KiB per listening
+	// socket, allocated on the first poll. ENet gets away with 4 KiB slots because its MTU
+	// is capped, arbitrary PacketPeerUDP traffic isn't.
 	enum {
-		PACKET_BUFFER_SIZE = 65536
+		PACKET_BUFFER_SIZE = 65536,
+		RECV_BATCH_SIZE = 8,
 	};
 
 	struct Peer {
@@ -50,7 +56,7 @@ protected:
 			return (ip == p_other.ip && port == p_other.port);
 		}
 	};
-	uint8_t recv_buffer[PACKET_BUFFER_SIZE];
+	LocalVector<uint8_t> recv_buffer; // Room for RECV_BATCH_SIZE packets, allocated on first poll.
 
 	List<Peer> peers;
 	List<Peer> pending;
@@ -34,6 +34,7 @@
 #include "core/io/resource_loader.h"
 #include "core/object/script_language.h"
 #include "core/templates/sort_array.h"
+#include "core/variant/variant_internal.h"
 #include "core/version.h"
 
 #define ERR_FAIL_NO_CLASS(m_type, m_class) ERR_FAIL_NULL_MSG(m_type, vformat("Cannot get class \"%s\".", m_class))
@@ -711,6 +712,20 @@ Object *ClassDB::instantiate_without_postinitialization_with_refcount(const Stri
 	return _instantiate_internal(p_class, true, false, true, true);
 }
 
+Object *(*ClassDB::get_native_creation_func(const StringName &p_class))(bool) {
+	Locker::Lock lock(Locker::STATE_READ);
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!_can_instantiate(ti) || ti->gdextension || ti->is_runtime) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR || ti->api == API_EDITOR_EXTENSION) {
+		return nullptr;
+	}
+#endif
+	return ti->creation_func;
+}
+
 #ifdef TOOLS_ENABLED
 ObjectGDExtension *ClassDB::get_placeholder_extension(const StringName &p_class) {
 	ObjectGDExtension *placeholder_extension = placeholder_extensions.getptr(p_class);
@@ -1733,6 +1748,147 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+PropertyAccessor ClassDB::get_property_accessor(const StringName &p_class, const Vector<StringName> &p_names) {
+	PropertyAccessor accessor;
+	accessor.class_name = p_class;
+	accessor.names = p_names;
+	if (p_names.is_empty()) {
+		return accessor;
+	}
+
+	// Extension instances handle their properties first, so they always take the generic path.
+	ClassInfo *type = classes.getptr(p_class);
+	if (!type || type->gdextension) {
+		return accessor;
+	}
+
+	const PropertySetGet *psg = nullptr;
+	for (ClassInfo *check = type; check && !psg; check = check->inherits_ptr) {
+		psg = check->property_setget.getptr(p_names[0]);
+	}
+	if (!psg) {
+		return accessor;
+	}
+
+	// Only setters and getters with the plain signature of a property can be called directly.
+	const int index_args = psg->index >= 0 ? 1 : 0;
+	if (psg->index >= 0) {
+		accessor.index = psg->index;
+	}
+
+	MethodBind *setter = psg->_setptr;
+	if (setter && !setter->is_vararg() && setter->get_argument_count() == index_args + 1 && (!index_args || setter->get_argument_type(0) == Variant::INT)) {
+		accessor.setter = setter;
+		accessor.setter_type = setter->get_argument_type(index_args);
+	}
+
+	MethodBind *getter = psg->_getptr;
+	if (getter && !getter->is_vararg() && getter->has_return() && getter->get_argument_count() == index_args && (!index_args || getter->get_argument_type(0) == Variant::INT)) {
+		accessor.getter = getter;
+		accessor.getter_type = getter->get_argument_type(-1);
+	}
+
+	return accessor;
+}
+
+PropertyAccessor ClassDB::get_property_accessor(const StringName &p_class, const StringName &p_property) {
+	Vector<StringName> names;
+	names.push_back(p_property);
+	return get_property_accessor(p_class, names);
+}
+
+bool PropertyAccessor::is_compatible(const Object *p_object) const {
+#ifdef TOOLS_ENABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return false; // Let Object::set() mark the object as edited.
+	}
+#endif
+	return p_object && p_object->get_class_name() == class_name && !p_object->get_script_instance();
+}
+
+bool PropertyAccessor::_call_setter(Object *p_object, const Variant &p_value) const {
+	const Variant index_arg = index;
+	const Variant *args[2] = { &index_arg, &p_value };
+	const Variant **argptrs = index >= 0 ? args : args + 1;
+
+	// Objects are excluded, validated calls don't check their class.
+	if (setter_type == Variant::NIL || (setter_type == p_value.get_type() && setter_type != Variant::OBJECT)) {
+		setter->validated_call(p_object, argptrs, nullptr);
+		return true;
+	}
+
+	Callable::CallError ce;
+	setter->call(p_object, argptrs, index >= 0 ? 2 : 1, ce);
+	return ce.error == Callable::CallError::CALL_OK;
+}
+
+Variant PropertyAccessor::_call_getter(const Object *p_object) const {
+	const Variant index_arg = index;
+	const Variant *args[1] = { &index_arg };
+
+	Variant ret;
+	VariantInternal::initialize(&ret, getter_type);
+	getter->validated_call(const_cast<Object *>(p_object), index >= 0 ? args : nullptr, &ret);
+	return ret;
+}
+
+void PropertyAccessor::set(Object *p_object, const Variant &p_value, bool *r_valid) const {
+	ERR_FAIL_NULL(p_object);
+
+	if (!setter || (names.size() > 1 && !getter) || !is_compatible(p_object)) {
+		p_object->set_indexed(names, p_value, r_valid);
+		return;
+	}
+
+	if (names.size() == 1) {
+		const bool valid = _call_setter(p_object, p_value);
+		if (r_valid) {
+			*r_valid = valid;
+		}
+		return;
+	}
+
+	// Same as Object::set_indexed(): change the nested value and write the whole property back.
+	LocalVector<Variant> value_stack;
+	value_stack.push_back(_call_getter(p_object));
+
+	bool valid = true;
+	for (int i = 1; i < names.size() - 1 && valid; i++) {
+		value_stack.push_back(value_stack[i - 1].get_named(names[i], valid));
+	}
+
+	value_stack.push_back(p_value);
+	for (int i = names.size() - 1; i > 0 && valid; i--) {
+		value_stack[i - 1].set_named(names[i], value_stack[i], valid);
+	}
+
+	if (valid) {
+		valid = _call_setter(p_object, value_stack[0]);
+	}
+	if (r_valid) {
+		*r_valid = valid;
+	}
+}
+
+Variant PropertyAccessor::get(const Object *p_object, bool *r_valid) const {
+	ERR_FAIL_NULL_V(p_object, Variant());
+
+	if (!getter || !is_compatible(p_object)) {
+		return p_object->get_indexed(names, r_valid);
+	}
+
+	Variant value = _call_getter(p_object);
+	bool valid = true;
+	for (int i = 1; i < names.size() && valid; i++) {
+		value = value.get_named(names[i], valid);
+	}
+
+	if (r_valid) {
+		*r_valid = valid;
+	}
+	return value;
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -94,6 +94,36 @@ MethodDefinition D_METHOD(const char *p_name, const VarArgs... p_args) {
 
 #endif // DEBUG_ENABLED
 
+// A native property resolved once for a class, so it can be read and written repeatedly
+// by calling its setter and getter directly, without the per-call lookups of Object::set()/get().
+// Objects of another class, or whose script or extension may handle the property, and calls
+// made in the editor, go through Object::set_indexed()/get_indexed() instead.
+class PropertyAccessor {
+	friend class ClassDB;
+
+	StringName class_name;
+	Vector<StringName> names; // The property, followed by its subnames.
+	MethodBind *setter = nullptr;
+	MethodBind *getter = nullptr;
+	int index = -1;
+	Variant::Type setter_type = Variant::NIL;
+	Variant::Type getter_type = Variant::NIL;
+
+	bool _call_setter(Object *p_object, const Variant &p_value) const; // Returns false if the value couldn't be converted.
+	Variant _call_getter(const Object *p_object) const;
+
+public:
+	bool has_setter() const { return setter; }
+	bool has_getter() const { return getter; }
+	bool is_compatible(const Object *p_object) const;
+
+	const StringName &get_class_name() const { return class_name; }
+	const Vector<StringName> &get_names() const { return names; }
+
+	void set(Object *p_object, const Variant &p_value, bool *r_valid = nullptr) const;
+	Variant get(const Object *p_object, bool *r_valid = nullptr) const;
+};
+
 class ClassDB {
 	friend class Object;
 	friend class GDType;
@@ -346,6 +376,8 @@ public:
 	static Object *instantiate_no_placeholders(const StringName &p_class);
 	static Object *instantiate_without_postinitialization(const StringName &p_class);
 	static Object *instantiate_without_postinitialization_with_refcount(const StringName &p_class);
+	// Returns the constructor of a native class when calling it is all instantiate() would do, so callers can cache it.
+	static Object *(*get_native_creation_func(const StringName &p_class))(bool);
 	static void set_object_extension_instance(Object *p_object, const StringName &p_class, GDExtensionClassInstancePtr p_instance);
 
 	static APIType get_api_type(const StringName &p_class);
@@ -478,6 +510,8 @@ public:
 	static int get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static Variant::Type get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static StringName get_property_setter(const StringName &p_class, const StringName &p_property);
+	static PropertyAccessor get_property_accessor(const StringName &p_class, const Vector<StringName> &p_names);
+	static PropertyAccessor get_property_accessor(const StringName &p_class, const StringName &p_property);
 	static StringName get_property_getter(const StringName &p_class, const StringName &p_property);
 
 	static bool has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance = false);
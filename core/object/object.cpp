@@ -2382,10 +2382,11 @@ void postinitialize_handler(Object *p_object) {
 void ObjectDB::debug_objects(DebugFunc p_func, void *p_user_data) {
 	spin_lock.lock();
 
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object, p_user_data);
-			count--;
+	for (uint32_t i = 0; i < slot_max; i++) {
+		const ObjectSlot &slot = _get_slot(i);
+		Object *object = slot.object.load(std::memory_order_acquire);
+		if (object && slot.id.load(std::memory_order_acquire)) {
+			p_func(object, p_user_data);
 		}
 	}
 	spin_lock.unlock();
@@ -2438,45 +2439,112 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 #endif
 
 SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::slot_chunks[OBJECTDB_SLOT_CHUNK_MAX] = {};
 uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+uint32_t *ObjectDB::free_slots = nullptr;
+uint32_t ObjectDB::free_slot_count = 0;
+SafeNumeric<uint32_t> ObjectDB::generation(1);
+SafeNumeric<uint32_t> ObjectDB::object_count;
+SafeNumeric<uint64_t> ObjectDB::validator_counter;
+
+ObjectDB::SlotCacheGuard::~SlotCacheGuard() {
+	// Give the slots back, unless ObjectDB was cleaned up since they were taken.
+	if (cache && *cache) {
+		if ((*cache)->count > 0) {
+			ObjectDB::_release_cached_slots(**cache, (*cache)->count);
+		}
+		*cache = nullptr;
+	}
+}
+
+ObjectDB::SlotCache *ObjectDB::_get_slot_cache() {
+	static thread_local SlotCache cache;
+	static thread_local SlotCache *cache_ptr = nullptr;
+	static thread_local bool initialized = false;
+	if (unlikely(!initialized)) {
+		initialized = true;
+		static thread_local SlotCacheGuard guard;
+		guard.cache = &cache_ptr;
+		cache_ptr = &cache;
+	}
+	return cache_ptr;
+}
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	return object_count.get();
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
+void ObjectDB::_refill_slot_cache(SlotCache &r_cache) {
 	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+	const uint32_t current_generation = generation.get();
+	if (r_cache.generation != current_generation) {
+		r_cache.count = 0;
+		r_cache.generation = current_generation;
+	}
+
+	while (r_cache.count < OBJECTDB_THREAD_CACHE_SIZE / 2) {
+		r_cache.slots[r_cache.count++] = _take_free_slot();
+	}
+
+	spin_lock.unlock();
+}
+
+uint32_t ObjectDB::_take_free_slot() {
+	if (unlikely(free_slot_count == 0)) {
+		CRASH_COND(slot_max == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+
+		ObjectSlot *chunk = memnew_arr(ObjectSlot, OBJECTDB_SLOT_CHUNK_SIZE);
+		slot_chunks[slot_max >> OBJECTDB_SLOT_CHUNK_BITS].store(chunk, std::memory_order_release);
+
+		free_slots = (uint32_t *)memrealloc(free_slots, sizeof(uint32_t) * (slot_max + OBJECTDB_SLOT_CHUNK_SIZE));
+		// Pushed in reverse, so the lowest slots are handed out first.
+		for (uint32_t i = 0; i < OBJECTDB_SLOT_CHUNK_SIZE; i++) {
+			free_slots[free_slot_count++] = slot_max + OBJECTDB_SLOT_CHUNK_SIZE - 1 - i;
+		}
+		slot_max += OBJECTDB_SLOT_CHUNK_SIZE;
+	}
+	return free_slots[--free_slot_count];
+}
+
+void ObjectDB::_release_cached_slots(SlotCache &r_cache, uint32_t p_count) {
+	spin_lock.lock();
+
+	if (r_cache.generation == generation.get()) {
+		for (uint32_t i = 0; i < p_count; i++) {
+			free_slots[free_slot_count++] = r_cache.slots[--r_cache.count];
 		}
-		slot_max = new_slot_max;
+	} else {
+		r_cache.count = 0;
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+	spin_lock.unlock();
+}
+
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	SlotCache *cache = _get_slot_cache();
+	uint32_t slot;
+	if (likely(cache)) {
+		if (unlikely(cache->count == 0 || cache->generation != generation.get())) {
+			_refill_slot_cache(*cache);
+		}
+		slot = cache->slots[--cache->count];
+	} else {
+		// The thread is exiting and its cache is gone.
+		spin_lock.lock();
+		slot = _take_free_slot();
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
+
+	ObjectSlot &object_slot = _get_slot(slot);
+	ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
+
+	uint64_t validator = validator_counter.increment() & OBJECTDB_VALIDATOR_MASK;
+	if (unlikely(validator == 0)) {
+		validator = validator_counter.increment() & OBJECTDB_VALIDATOR_MASK;
 	}
-	object_slots[slot].validator = validator_counter;
 
-	uint64_t id = validator_counter;
+	uint64_t id = validator;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -2484,9 +2552,11 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
+	// The object is published before the ID, so a lookup that matches the ID finds it.
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.id.store(id, std::memory_order_release);
 
-	spin_lock.unlock();
+	object_count.increment();
 
 	return ObjectID(id);
 }
@@ -2495,33 +2565,43 @@ void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
 
-	spin_lock.lock();
+	ObjectSlot *chunk = slot_chunks[slot >> OBJECTDB_SLOT_CHUNK_BITS].load(std::memory_order_acquire);
+	if (unlikely(!chunk)) {
+		return; // Freed after ObjectDB was cleaned up, it was reported as leaked.
+	}
+	ObjectSlot &object_slot = chunk[slot & (OBJECTDB_SLOT_CHUNK_SIZE - 1)];
 
 #ifdef DEBUG_ENABLED
+	ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
+	ERR_FAIL_COND(object_slot.id.load(std::memory_order_relaxed) != t);
+#endif
+
+	//invalidate, so checks against it fail
+	object_slot.id.store(0, std::memory_order_release);
+	object_slot.object.store(nullptr, std::memory_order_release);
 
-	if (object_slots[slot].object != p_object) {
+	object_count.decrement();
+
+	SlotCache *cache = _get_slot_cache();
+	if (unlikely(!cache)) {
+		// The thread is exiting and its cache is gone.
+		spin_lock.lock();
+		if (likely(free_slots)) {
+			free_slots[free_slot_count++] = slot;
+		}
 		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+		return;
 	}
-	{
-		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
-		}
+	const uint32_t current_generation = generation.get();
+	if (unlikely(cache->generation != current_generation)) {
+		// Taken before the last cleanup, start over with this one.
+		cache->count = 0;
+		cache->generation = current_generation;
 	}
-
-#endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
-
-	spin_lock.unlock();
+	if (unlikely(cache->count == OBJECTDB_THREAD_CACHE_SIZE)) {
+		_release_cached_slots(*cache, OBJECTDB_THREAD_CACHE_SIZE / 2);
+	}
+	cache->slots[cache->count++] = slot;
 }
 
 void ObjectDB::setup() {
@@ -2531,8 +2611,9 @@ void ObjectDB::setup() {
 void ObjectDB::cleanup() {
 	spin_lock.lock();
 
-	if (slot_count > 0) {
-		WARN_PRINT(vformat("%d ObjectDB %s leaked at exit (run with `--verbose` for details).", slot_count, slot_count == 1 ? "instance was" : "instances were"));
+	const uint32_t leaked_count = object_count.get();
+	if (leaked_count > 0) {
+		WARN_PRINT(vformat("%d ObjectDB %s leaked at exit (run with `--verbose` for details).", leaked_count, leaked_count == 1 ? "instance was" : "instances were"));
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			// Ensure calling the native classes because if a leaked instance has a script
 			// that overrides any of those methods, it'd not be OK to call them at this point,
@@ -2541,9 +2622,10 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, count = leaked_count; i < slot_max && count != 0; i++) {
+				const ObjectSlot &slot = _get_slot(i);
+				if (slot.id.load(std::memory_order_acquire)) {
+					Object *obj = slot.object.load(std::memory_order_acquire);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2556,7 +2638,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Reference count: " + itos((static_cast<RefCounted *>(obj))->get_reference_count());
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = slot.id.load(std::memory_order_acquire);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2567,9 +2649,17 @@ void ObjectDB::cleanup() {
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < slot_max; i += OBJECTDB_SLOT_CHUNK_SIZE) {
+		memdelete_arr(slot_chunks[i >> OBJECTDB_SLOT_CHUNK_BITS].exchange(nullptr));
+	}
+	if (free_slots) {
+		memfree(free_slots);
+		free_slots = nullptr;
 	}
+	slot_max = 0;
+	free_slot_count = 0;
+	object_count.set(0);
+	generation.increment();
 
 	spin_lock.unlock();
 }
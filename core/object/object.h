@@ -879,23 +879,55 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
+// Slots live in fixed-size chunks that never move, so lookups can read them without locking.
+#define OBJECTDB_SLOT_CHUNK_BITS 12
+#define OBJECTDB_SLOT_CHUNK_SIZE (uint32_t(1) << OBJECTDB_SLOT_CHUNK_BITS)
+#define OBJECTDB_SLOT_CHUNK_MAX (uint32_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_CHUNK_BITS))
+#define OBJECTDB_THREAD_CACHE_SIZE 64
+
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		std::atomic<uint64_t> id = 0; // The ObjectID of the object in the slot, 0 when free.
+		std::atomic<Object *> object = nullptr;
+	};
+
+	// Free slots owned by a thread, so creating and freeing objects doesn't take the lock.
+	// Trivially destructible, so it can still be read by destructors that run after the guard's.
+	struct SlotCache {
+		uint32_t slots[OBJECTDB_THREAD_CACHE_SIZE];
+		uint32_t count;
+		uint32_t generation;
+	};
+	static_assert(std::is_trivially_destructible_v<SlotCache>);
+
+	// Gives the cached slots back when the thread exits. Objects created or freed by thread_local
+	// or static destructors that run later then find no cache, and use the shared free list.
+	struct SlotCacheGuard {
+		SlotCache **cache = nullptr;
+
+		~SlotCacheGuard();
 	};
 
-	static SpinLock spin_lock;
-	static uint32_t slot_count;
+	static SpinLock spin_lock; // Only guards growing the slots and the shared free list.
+	static std::atomic<ObjectSlot *> slot_chunks[OBJECTDB_SLOT_CHUNK_MAX];
 	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	static uint32_t *free_slots;
+	static uint32_t free_slot_count;
+	static SafeNumeric<uint32_t> generation; // Changes on cleanup, so slots cached by threads from before are dropped.
+	static SafeNumeric<uint32_t> object_count;
+	static SafeNumeric<uint64_t> validator_counter;
+	static SlotCache *_get_slot_cache();
 
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
 
+	static void _refill_slot_cache(SlotCache &r_cache);
+	static void _release_cached_slots(SlotCache &r_cache, uint32_t p_count);
+	static uint32_t _take_free_slot(); // Call with the lock held.
+	_ALWAYS_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return slot_chunks[p_slot >> OBJECTDB_SLOT_CHUNK_BITS].load(std::memory_order_acquire)[p_slot & (OBJECTDB_SLOT_CHUNK_SIZE - 1)];
+	}
+
 	static ObjectID add_instance(Object *p_object);
 	static void remove_instance(Object *p_object);
 
@@ -907,22 +939,26 @@ public:
 
 	_ALWAYS_INLINE_ static Object *get_instance(ObjectID p_instance_id) {
 		uint64_t id = p_instance_id;
-		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
-
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
+		if (unlikely(id == 0)) {
+			return nullptr;
+		}
 
-		spin_lock.lock();
+		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
+		ObjectSlot *chunk = slot_chunks[slot >> OBJECTDB_SLOT_CHUNK_BITS].load(std::memory_order_acquire);
 
-		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		ERR_FAIL_NULL_V(chunk, nullptr); // This should never happen unless RID is corrupted.
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		ObjectSlot &object_slot = chunk[slot & (OBJECTDB_SLOT_CHUNK_SIZE - 1)];
+		if (unlikely(object_slot.id.load(std::memory_order_acquire) != id)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed and given to another object in the meantime.
+		if (unlikely(object_slot.id.load(std::memory_order_acquire) != id)) {
+			return nullptr;
+		}
 
 		return object;
 	}
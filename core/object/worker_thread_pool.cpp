@@ -189,7 +189,13 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 	while (true) {
 		Task *task_to_process = nullptr;
-		{
+
+		if (thread_data->pool->use_work_stealing) {
+			// Fast path: no need to touch the shared mutex as long as there is local or stealable work.
+			task_to_process = thread_data->pool->_pop_or_steal_task(thread_data);
+		}
+
+		if (!task_to_process) {
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
 			MutexLock lock(thread_data->pool->task_mutex);
@@ -202,17 +208,27 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 				thread_data->signaled = false;
 
-				if (!thread_data->pool->task_queue.first()) {
-					// There wasn't a task available yet.
-					// Let's wait for the next notification, then recheck.
-					thread_data->cond_var.wait(lock);
-					continue;
+				if (thread_data->pool->task_queue.first()) {
+					// Got a task to process! Remove it from the queue, then break into the task handling section.
+					task_to_process = thread_data->pool->task_queue.first()->self();
+					thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
+					if (thread_data->pool->use_work_stealing) {
+						thread_data->pool->_steal_half_from_task_queue(thread_data);
+					}
+					break;
+				}
+
+				if (thread_data->pool->use_work_stealing) {
+					// Checked with the lock held, so a task pushed before a notification can't be missed.
+					task_to_process = thread_data->pool->_pop_or_steal_task(thread_data);
+					if (task_to_process) {
+						break;
+					}
 				}
 
-				// Got a task to process! Remove it from the queue, then break into the task handling section.
-				task_to_process = thread_data->pool->task_queue.first()->self();
-				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
-				break;
+				// There wasn't a task available yet.
+				// Let's wait for the next notification, then recheck.
+				thread_data->cond_var.wait(lock);
 			}
 		}
 
@@ -246,10 +262,15 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
 
+	// Tasks posted from a pool thread go to its own deque, so other threads can steal them without the mutex.
+	ThreadData *deque_owner = (use_work_stealing && !p_pump_task) ? caller_pool_thread : nullptr;
+
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			if (!deque_owner || !deque_owner->deque.push(p_tasks[i])) {
+				task_queue.add_last(&p_tasks[i]->task_elem);
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
@@ -340,6 +361,69 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_pop_or_steal_task(ThreadData *p_thread_data) {
+	Task *task = nullptr;
+	if (p_thread_data->deque.pop(task)) {
+		return task;
+	}
+
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count; i++) {
+		ThreadData &victim = threads[(p_thread_data->index + i) % thread_count];
+		uint32_t available = victim.deque.size();
+		if (available == 0 || !victim.deque.steal(task)) {
+			continue;
+		}
+
+		// Take half of what's left, so the victim isn't visited again for every single task.
+		// Only the owner pushes to its own deque, so the free room can only grow meanwhile.
+		uint32_t room = p_thread_data->deque.get_capacity() - p_thread_data->deque.size();
+		uint32_t to_steal = MIN(available / 2, room);
+		for (uint32_t j = 0; j < to_steal; j++) {
+			Task *extra = nullptr;
+			if (!victim.deque.steal(extra)) {
+				break;
+			}
+			p_thread_data->deque.push(extra);
+		}
+		return task;
+	}
+
+	return nullptr;
+}
+
+void WorkerThreadPool::_steal_half_from_task_queue(ThreadData *p_thread_data) {
+	// Task mutex must be locked. Other threads can still steal from the moved tasks, so this
+	// only saves them from having to go through the shared queue one task at a time.
+	uint32_t room = p_thread_data->deque.get_capacity() - p_thread_data->deque.size();
+	uint32_t queued = 0;
+	for (SelfList<Task> *E = task_queue.first(); E && queued < room * 2; E = E->next()) {
+		queued++;
+	}
+	uint32_t to_move = queued / 2;
+	for (uint32_t i = 0; i < to_move; i++) {
+		Task *task = task_queue.first()->self();
+		if (task->is_pump_task) {
+			// Pump tasks must stay in the shared queue, see _wait_collaboratively().
+			break;
+		}
+		task_queue.remove(task_queue.first());
+		p_thread_data->deque.push(task);
+	}
+}
+
+bool WorkerThreadPool::_has_stealable_tasks() const {
+	if (!use_work_stealing) {
+		return false;
+	}
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (!threads[i].deque.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
@@ -518,7 +602,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || _has_stealable_tasks()) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -546,6 +630,11 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 			}
 
+			if (!task_to_process && use_work_stealing) {
+				// Deques never hold pump tasks, so anything found there is fine to process here.
+				task_to_process = _pop_or_steal_task(p_caller_pool_thread);
+			}
+
 			if (!task_to_process) {
 				p_caller_pool_thread->awaited_task = p_task;
 
@@ -589,7 +678,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_stealable_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -808,10 +897,11 @@ void WorkerThreadPool::thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {
 }
 #endif
 
-void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio) {
+void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio, bool p_use_work_stealing) {
 	ERR_FAIL_COND(threads.size() > 0);
 
 	runlevel = RUNLEVEL_NORMAL;
+	use_work_stealing = p_use_work_stealing;
 
 	if (p_thread_count < 0) {
 		p_thread_count = OS::get_singleton()->get_default_thread_pool_size();
@@ -819,7 +909,7 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 
 	max_low_priority_threads = CLAMP(p_thread_count * p_low_priority_task_ratio, 1, p_thread_count - 1);
 
-	print_verbose(vformat("WorkerThreadPool: %d threads, %d max low-priority.", p_thread_count, max_low_priority_threads));
+	print_verbose(vformat("WorkerThreadPool: %d threads, %d max low-priority%s.", p_thread_count, max_low_priority_threads, use_work_stealing ? ", work-stealing" : ""));
 
 #ifdef THREADS_ENABLED
 	// Reserve 5 threads in case we need separate threads for 1) 2D physics 2) 3D physics 3) rendering 4) GPU texture compression, 5) all other tasks.
@@ -39,6 +39,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
+#include "core/templates/work_stealing_deque.h"
 #include "core/variant/callable.h"
 
 class WorkerThreadPool : public Object {
@@ -100,6 +101,7 @@ private:
 
 	static const uint32_t TASKS_PAGE_SIZE = 1024;
 	static const uint32_t GROUPS_PAGE_SIZE = 256;
+	static const uint32_t WORK_STEALING_DEQUE_SIZE = 256;
 
 	PagedAllocator<Task, false, TASKS_PAGE_SIZE> task_allocator;
 	PagedAllocator<Group, false, GROUPS_PAGE_SIZE> group_allocator;
@@ -123,6 +125,7 @@ private:
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
+		WorkStealingDeque<Task *, WORK_STEALING_DEQUE_SIZE> deque; // Only used in work-stealing mode.
 
 		ThreadData() :
 				signaled(false),
@@ -169,6 +172,12 @@ private:
 	uint32_t low_priority_threads_used = 0;
 	uint32_t notify_index = 0; // For rotating across threads, no help distributing load.
 
+	// In work-stealing mode, tasks posted from pool threads go to the poster's own deque and
+	// idle threads steal from the others, instead of everything going through `task_queue`.
+	// `task_queue` is still used for tasks coming from non-pool threads, pump tasks and
+	// promoted low-priority tasks.
+	bool use_work_stealing = false;
+
 	uint64_t last_task = 1;
 	int pump_task_count = 0;
 
@@ -183,6 +192,10 @@ private:
 
 	bool _try_promote_low_priority_task();
 
+	Task *_pop_or_steal_task(ThreadData *p_thread_data);
+	void _steal_half_from_task_queue(ThreadData *p_thread_data);
+	bool _has_stealable_tasks() const;
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -295,7 +308,9 @@ public:
 	static void thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {}
 #endif
 
-	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3);
+	_FORCE_INLINE_ bool is_using_work_stealing() const { return use_work_stealing; }
+
+	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3, bool p_use_work_stealing = false);
 	void exit_languages_threads();
 	void finish();
 	WorkerThreadPool(bool p_singleton = true);
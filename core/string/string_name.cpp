@@ -30,8 +30,8 @@
 
 #include "string_name.h"
 
-#include "core/os/mutex.h"
 #include "core/os/os.h"
+#include "core/os/rw_lock.h"
 #include "core/string/print_string.h"
 #include "core/templates/paged_allocator.h"
 
@@ -40,9 +40,88 @@ struct StringName::Table {
 	constexpr static uint32_t TABLE_LEN = 1 << TABLE_BITS;
 	constexpr static uint32_t TABLE_MASK = TABLE_LEN - 1;
 
+	// Buckets are split across shards (by the low bits of their index), each with its own lock and
+	// allocator. Lookups of existing names only take their shard's lock for reading, so they don't
+	// serialize against each other; inserts and removals lock only their own shard for writing.
+	constexpr static uint32_t SHARD_BITS = 6;
+	constexpr static uint32_t SHARD_COUNT = 1 << SHARD_BITS;
+	constexpr static uint32_t SHARD_MASK = SHARD_COUNT - 1;
+	constexpr static uint32_t SHARD_PAGE_SIZE = 256;
+
+	struct alignas(64) Shard {
+		RWLock lock;
+		PagedAllocator<_Data> allocator;
+
+		Shard() :
+				allocator(SHARD_PAGE_SIZE) {}
+	};
+
 	static inline _Data *table[TABLE_LEN];
-	static inline BinaryMutex mutex;
-	static inline PagedAllocator<_Data> allocator;
+	static inline Shard shards[SHARD_COUNT];
+
+	_FORCE_INLINE_ static Shard &get_shard(uint32_t p_idx) { return shards[p_idx & SHARD_MASK]; }
+
+	// Shard lock must be held (for reading at least).
+	template <typename T>
+	static _Data *find_and_ref(const T &p_name, uint32_t p_hash, uint32_t p_idx, bool p_static) {
+		for (_Data *d = table[p_idx]; d; d = d->next) {
+			// Compare hash first. A zero refcount means it's being removed, so keep looking.
+			if (d->hash == p_hash && d->name == p_name && d->refcount.ref()) {
+				if (p_static) {
+					d->static_count.increment();
+				}
+#ifdef DEBUG_ENABLED
+				if (unlikely(debug_stringname)) {
+					d->debug_references.increment();
+				}
+#endif
+				return d;
+			}
+		}
+		return nullptr;
+	}
+
+	template <typename T>
+	static _Data *intern(const T &p_name, uint32_t p_hash, bool p_static) {
+		const uint32_t idx = p_hash & TABLE_MASK;
+		Shard &shard = get_shard(idx);
+
+		{
+			RWLockRead read_lock(shard.lock);
+			_Data *d = find_and_ref(p_name, p_hash, idx, p_static);
+			if (d) {
+				return d;
+			}
+		}
+
+		RWLockWrite write_lock(shard.lock);
+		// Another thread may have inserted it in between.
+		_Data *d = find_and_ref(p_name, p_hash, idx, p_static);
+		if (d) {
+			return d;
+		}
+
+		d = shard.allocator.alloc();
+		d->name = p_name;
+		d->refcount.init();
+		d->static_count.set(p_static ? 1 : 0);
+		d->hash = p_hash;
+		d->next = table[idx];
+		d->prev = nullptr;
+#ifdef DEBUG_ENABLED
+		if (unlikely(debug_stringname)) {
+			// Keep in memory, force static.
+			d->refcount.ref();
+			d->static_count.increment();
+		}
+#endif
+
+		if (table[idx]) {
+			table[idx]->prev = d;
+		}
+		table[idx] = d;
+		return d;
+	}
 };
 
 void StringName::setup() {
@@ -54,7 +133,9 @@ void StringName::setup() {
 }
 
 void StringName::cleanup() {
-	MutexLock lock(Table::mutex);
+	for (Table::Shard &shard : Table::shards) {
+		shard.lock.write_lock();
+	}
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
@@ -73,10 +154,11 @@ void StringName::cleanup() {
 		int unreferenced_stringnames = 0;
 		int rarely_referenced_stringnames = 0;
 		for (int i = 0; i < data.size(); i++) {
-			print_line(itos(i + 1) + ": " + data[i]->name + " - " + itos(data[i]->debug_references));
-			if (data[i]->debug_references == 0) {
+			const uint32_t references = data[i]->debug_references.get();
+			print_line(itos(i + 1) + ": " + data[i]->name + " - " + itos(references));
+			if (references == 0) {
 				unreferenced_stringnames += 1;
-			} else if (data[i]->debug_references < 5) {
+			} else if (references < 5) {
 				rarely_referenced_stringnames += 1;
 			}
 		}
@@ -98,20 +180,26 @@ void StringName::cleanup() {
 			}
 
 			Table::table[i] = Table::table[i]->next;
-			Table::allocator.free(d);
+			Table::get_shard(i).allocator.free(d);
 		}
 	}
 	if (lost_strings) {
 		print_verbose(vformat("StringName: %d unclaimed string names at exit.", lost_strings));
 	}
 	configured = false;
+
+	for (Table::Shard &shard : Table::shards) {
+		shard.lock.write_unlock();
+	}
 }
 
 void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(Table::mutex);
+		const uint32_t idx = _data->hash & Table::TABLE_MASK;
+		Table::Shard &shard = Table::get_shard(idx);
+		RWLockWrite lock(shard.lock);
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			ERR_PRINT("BUG: Unreferenced static string to 0: " + _data->name);
@@ -119,14 +207,13 @@ void StringName::unref() {
 		if (_data->prev) {
 			_data->prev->next = _data->next;
 		} else {
-			const uint32_t idx = _data->hash & Table::TABLE_MASK;
 			Table::table[idx] = _data->next;
 		}
 
 		if (_data->next) {
 			_data->next->prev = _data->prev;
 		}
-		Table::allocator.free(_data);
+		shard.allocator.free(_data);
 	}
 
 	_data = nullptr;
@@ -211,52 +298,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	const uint32_t hash = String::hash(p_name);
-	const uint32_t idx = hash & Table::TABLE_MASK;
-
-	MutexLock lock(Table::mutex);
-	_data = Table::table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->name == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
-
-	_data = Table::allocator.alloc();
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->next = Table::table[idx];
-	_data->prev = nullptr;
-
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-	if (Table::table[idx]) {
-		Table::table[idx]->prev = _data;
-	}
-	Table::table[idx] = _data;
+	_data = Table::intern(p_name, String::hash(p_name), p_static);
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -268,51 +310,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	const uint32_t hash = p_name.hash();
-	const uint32_t idx = hash & Table::TABLE_MASK;
-
-	MutexLock lock(Table::mutex);
-	_data = Table::table[idx];
-
-	while (_data) {
-		if (_data->hash == hash && _data->name == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
-
-	_data = Table::allocator.alloc();
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->next = Table::table[idx];
-	_data->prev = nullptr;
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-
-	if (Table::table[idx]) {
-		Table::table[idx]->prev = _data;
-	}
-	Table::table[idx] = _data;
+	_data = Table::intern(p_name, p_name.hash(), p_static);
 }
 
 bool operator==(const String &p_name, const StringName &p_string_name) {
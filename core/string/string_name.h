@@ -45,7 +45,7 @@ class [[nodiscard]] StringName {
 		SafeNumeric<uint32_t> static_count;
 		String name;
 #ifdef DEBUG_ENABLED
-		uint32_t debug_references = 0;
+		SafeNumeric<uint32_t> debug_references; // Bumped under the shared read lock.
 #endif
 
 		uint32_t hash = 0;
@@ -66,7 +66,7 @@ class [[nodiscard]] StringName {
 #ifdef DEBUG_ENABLED
 	struct DebugSortReferences {
 		bool operator()(const _Data *p_left, const _Data *p_right) const {
-			return p_left->debug_references > p_right->debug_references;
+			return p_left->debug_references.get() > p_right->debug_references.get();
 		}
 	};
 
@@ -121,6 +121,10 @@ public:
 		}
 	}
 
+	const Pair *get_least_recent() const {
+		return _list.back() ? &_list.back()->get() : nullptr;
+	}
+
 	_FORCE_INLINE_ size_t get_capacity() const { return capacity; }
 	_FORCE_INLINE_ size_t get_size() const { return _map.size(); }
 
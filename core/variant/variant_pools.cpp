@@ -34,7 +34,9 @@
 #include "core/math/projection.h"
 #include "core/math/transform_2d.h"
 #include "core/math/transform_3d.h"
+#include "core/os/spin_lock.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 
 namespace VariantPools {
 union BucketSmall {
@@ -64,9 +66,113 @@ static_assert(sizeof(BucketLarge) == VariantPools::BUCKET_LARGE);
 static_assert(alignof(BucketLarge) == alignof(real_t));
 } //namespace VariantPools
 
-static PagedAllocator<VariantPools::BucketSmall, true> _bucket_small;
-static PagedAllocator<VariantPools::BucketMedium, true> _bucket_medium;
-static PagedAllocator<VariantPools::BucketLarge, true> _bucket_large;
+// Each bucket is a global paged allocator fronted by small per-thread caches ("magazines"),
+// so the global lock is only taken once per batch instead of on every boxed Variant alloc/free.
+template <typename T>
+class BucketPool {
+	static constexpr uint32_t CACHE_SIZE = 64;
+	static constexpr uint32_t CACHE_BATCH = CACHE_SIZE / 2;
+
+	PagedAllocator<T, false> allocator;
+	SpinLock spin_lock;
+	SafeNumeric<uint64_t> slots_taken;
+	SafeNumeric<uint64_t> transfers;
+
+	// Trivially destructible, so it can still be read by destructors that run after the guard's.
+	struct ThreadCache {
+		T *slots[CACHE_SIZE];
+		uint32_t count;
+	};
+
+	// Gives the cached slots back when the thread exits. Variants freed by thread_local or static
+	// destructors that run later then find no cache, and go straight to the shared allocator.
+	struct ThreadCacheGuard {
+		BucketPool *pool = nullptr;
+		ThreadCache **cache = nullptr;
+
+		~ThreadCacheGuard() {
+			if (cache && *cache) {
+				if ((*cache)->count) {
+					pool->_give_back((*cache)->slots, (*cache)->count);
+					(*cache)->count = 0;
+				}
+				*cache = nullptr;
+			}
+		}
+	};
+	static_assert(std::is_trivially_destructible_v<ThreadCache>);
+
+	void _take(T **r_slots, uint32_t p_count) {
+		spin_lock.lock();
+		for (uint32_t i = 0; i < p_count; i++) {
+			r_slots[i] = allocator.alloc();
+		}
+		spin_lock.unlock();
+		slots_taken.add(p_count);
+		transfers.increment();
+	}
+
+	void _give_back(T **p_slots, uint32_t p_count) {
+		spin_lock.lock();
+		for (uint32_t i = 0; i < p_count; i++) {
+			allocator.free(p_slots[i]);
+		}
+		spin_lock.unlock();
+		slots_taken.sub(p_count);
+		transfers.increment();
+	}
+
+	_FORCE_INLINE_ ThreadCache *_get_thread_cache() {
+		static thread_local ThreadCache cache;
+		static thread_local ThreadCache *cache_ptr = nullptr;
+		static thread_local bool initialized = false;
+		if (unlikely(!initialized)) {
+			initialized = true;
+			static thread_local ThreadCacheGuard guard;
+			guard.pool = this;
+			guard.cache = &cache_ptr;
+			cache_ptr = &cache;
+		}
+		return cache_ptr;
+	}
+
+public:
+	_FORCE_INLINE_ T *alloc() {
+		ThreadCache *cache = _get_thread_cache();
+		if (unlikely(!cache)) {
+			T *ptr;
+			_take(&ptr, 1);
+			return ptr;
+		}
+		if (unlikely(cache->count == 0)) {
+			_take(cache->slots, CACHE_BATCH);
+			cache->count = CACHE_BATCH;
+		}
+		return cache->slots[--cache->count];
+	}
+
+	_FORCE_INLINE_ void free(T *p_ptr) {
+		ThreadCache *cache = _get_thread_cache();
+		if (unlikely(!cache)) {
+			_give_back(&p_ptr, 1);
+			return;
+		}
+		if (unlikely(cache->count == CACHE_SIZE)) {
+			// Return the older half, keeping the most recently freed (likely still hot) slots.
+			_give_back(cache->slots, CACHE_BATCH);
+			memmove(cache->slots, cache->slots + CACHE_BATCH, sizeof(T *) * (CACHE_SIZE - CACHE_BATCH));
+			cache->count -= CACHE_BATCH;
+		}
+		cache->slots[cache->count++] = p_ptr;
+	}
+
+	uint64_t get_slots_taken() const { return slots_taken.get(); }
+	uint64_t get_transfers() const { return transfers.get(); }
+};
+
+static BucketPool<VariantPools::BucketSmall> _bucket_small;
+static BucketPool<VariantPools::BucketMedium> _bucket_medium;
+static BucketPool<VariantPools::BucketLarge> _bucket_large;
 
 void *VariantPools::alloc_small() {
 	return _bucket_small.alloc();
@@ -91,3 +197,11 @@ void VariantPools::free_medium(void *p_ptr) {
 void VariantPools::free_large(void *p_ptr) {
 	_bucket_large.free(static_cast<BucketLarge *>(p_ptr));
 }
+
+uint64_t VariantPools::get_memory_usage() {
+	return _bucket_small.get_slots_taken() * BUCKET_SMALL + _bucket_medium.get_slots_taken() * BUCKET_MEDIUM + _bucket_large.get_slots_taken() * BUCKET_LARGE;
+}
+
+uint64_t VariantPools::get_transfer_count() {
+	return _bucket_small.get_transfers() + _bucket_medium.get_transfers() + _bucket_large.get_transfers();
+}
@@ -71,4 +71,9 @@ _FORCE_INLINE_ void free(T *p_ptr) {
 		memdelete(p_ptr);
 	}
 }
+
+// Memory taken from the global pools, including slots kept in per-thread caches.
+uint64_t get_memory_usage();
+// Number of batched transfers between the per-thread caches and the global pools.
+uint64_t get_transfer_count();
 }; //namespace VariantPools
@@ -35,6 +35,7 @@
 #include "core/string/ustring.h"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #if !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__NetBSD__) && !defined(WEB_ENABLED)
@@ -200,6 +201,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped_data) {
+		munmap(mapped_data, mapped_length);
+		mapped_data = nullptr;
+		mapped_length = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -305,6 +312,38 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+Error FileAccessUnix::map_read_only() {
+	ERR_FAIL_NULL_V_MSG(f, ERR_FILE_CANT_READ, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(flags != READ, ERR_FILE_CANT_READ, "Only files opened for reading can be mapped.");
+
+	if (mapped_data) {
+		return OK;
+	}
+
+#if defined(WEB_ENABLED)
+	// The virtual file system doesn't share pages with the file, mapping would copy the whole file.
+	return ERR_UNAVAILABLE;
+#else
+	struct stat st = {};
+	if (fstat(fileno(f), &st) != 0 || st.st_size <= 0) {
+		return ERR_UNAVAILABLE;
+	}
+
+	void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (addr == MAP_FAILED) {
+		return ERR_UNAVAILABLE;
+	}
+
+	mapped_data = (uint8_t *)addr;
+	mapped_length = st.st_size;
+	return OK;
+#endif
+}
+
+Span<uint8_t> FileAccessUnix::get_mapped_data() const {
+	return Span<uint8_t>(mapped_data, mapped_length);
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -668,6 +668,106 @@ Error NetSocketUnix::sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPA
 	return OK;
 }
 
+#ifdef UNIX_MMSG_ENABLED
+// Datagrams handled per system call, bounded to keep the message headers on the stack.
+#define MMSG_BATCH_MAX 64
+
+Error NetSocketUnix::recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received) {
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(_family != Family::INET, ERR_UNAVAILABLE);
+
+	struct mmsghdr msgs[MMSG_BATCH_MAX];
+	struct iovec iovs[MMSG_BATCH_MAX];
+	struct sockaddr_storage addrs[MMSG_BATCH_MAX];
+
+	r_received = 0;
+	while (r_received < p_count) {
+		const int count = MIN(p_count - r_received, MMSG_BATCH_MAX);
+		memset(msgs, 0, sizeof(struct mmsghdr) * count);
+		for (int i = 0; i < count; i++) {
+			Datagram &datagram = p_datagrams[r_received + i];
+			iovs[i].iov_base = datagram.buffer;
+			iovs[i].iov_len = datagram.size;
+			msgs[i].msg_hdr.msg_iov = &iovs[i];
+			msgs[i].msg_hdr.msg_iovlen = 1;
+			msgs[i].msg_hdr.msg_name = &addrs[i];
+			msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+		}
+
+		// Only the first datagram may block.
+		int ret = ::recvmmsg(_sock, msgs, count, r_received ? MSG_DONTWAIT : MSG_WAITFORONE, nullptr);
+		if (ret < 0) {
+			if (r_received) {
+				break; // Report what we got so far, the error will show up again on the next call.
+			}
+			NetError err = _get_socket_error();
+			if (err == ERR_NET_WOULD_BLOCK) {
+				return ERR_BUSY;
+			}
+			if (err == ERR_NET_BUFFER_TOO_SMALL) {
+				return ERR_OUT_OF_MEMORY;
+			}
+			return FAILED;
+		}
+
+		for (int i = 0; i < ret; i++) {
+			Datagram &datagram = p_datagrams[r_received + i];
+			datagram.read = msgs[i].msg_len;
+			_set_ip_port(&addrs[i], &datagram.ip, &datagram.port);
+		}
+		r_received += ret;
+		if (ret < count) {
+			break; // Drained.
+		}
+	}
+	return OK;
+}
+
+Error NetSocketUnix::sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent) {
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(_family != Family::INET, ERR_UNAVAILABLE);
+
+	struct mmsghdr msgs[MMSG_BATCH_MAX];
+	struct iovec iovs[MMSG_BATCH_MAX];
+	struct sockaddr_storage addrs[MMSG_BATCH_MAX];
+
+	r_sent = 0;
+	while (r_sent < p_count) {
+		const int count = MIN(p_count - r_sent, MMSG_BATCH_MAX);
+		memset(msgs, 0, sizeof(struct mmsghdr) * count);
+		for (int i = 0; i < count; i++) {
+			const Datagram &datagram = p_datagrams[r_sent + i];
+			iovs[i].iov_base = datagram.buffer;
+			iovs[i].iov_len = datagram.size;
+			msgs[i].msg_hdr.msg_iov = &iovs[i];
+			msgs[i].msg_hdr.msg_iovlen = 1;
+			msgs[i].msg_hdr.msg_name = &addrs[i];
+			msgs[i].msg_hdr.msg_namelen = _set_addr_storage(&addrs[i], datagram.ip, datagram.port, _ip_type);
+		}
+
+		int ret = ::sendmmsg(_sock, msgs, count, 0);
+		if (ret < 0) {
+			if (r_sent) {
+				break;
+			}
+			NetError err = _get_socket_error();
+			if (err == ERR_NET_WOULD_BLOCK) {
+				return ERR_BUSY;
+			}
+			if (err == ERR_NET_BUFFER_TOO_SMALL) {
+				return ERR_OUT_OF_MEMORY;
+			}
+			return FAILED;
+		}
+		r_sent += ret;
+		if (ret < count) {
+			break; // Would block.
+		}
+	}
+	return OK;
+}
+#endif // UNIX_MMSG_ENABLED
+
 Error NetSocketUnix::set_broadcasting_enabled(bool p_enabled) {
 	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
 	// IPv6 has no broadcast support.
@@ -699,6 +799,12 @@ void NetSocketUnix::set_blocking_enabled(bool p_enabled) {
 	}
 }
 
+bool NetSocketUnix::is_blocking_enabled() const {
+	ERR_FAIL_COND_V(!is_open(), false);
+
+	return !(fcntl(_sock, F_GETFL) & O_NONBLOCK);
+}
+
 void NetSocketUnix::set_ipv6_only_enabled(bool p_enabled) {
 	ERR_FAIL_COND(!is_open());
 	// This option is only available in IPv6 sockets.
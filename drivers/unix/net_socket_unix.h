@@ -37,6 +37,11 @@
 #include <sys/socket.h>
 #include <sys/un.h>
 
+// Batched UDP I/O via recvmmsg/sendmmsg.
+#if defined(__linux__) && !defined(WEB_ENABLED)
+#define UNIX_MMSG_ENABLED
+#endif
+
 class NetSocketUnix : public NetSocket {
 	GDSOFTCLASS(NetSocketUnix, NetSocket);
 
@@ -99,6 +104,10 @@ public:
 	virtual Error send(const uint8_t *p_buffer, int p_len, int &r_sent) override;
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port) override;
 	virtual Ref<NetSocket> accept(Address &r_addr) override;
+#ifdef UNIX_MMSG_ENABLED
+	virtual Error recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received) override;
+	virtual Error sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent) override;
+#endif
 
 	virtual bool is_open() const override;
 	virtual int get_available_bytes() const override;
@@ -106,6 +115,7 @@ public:
 
 	virtual Error set_broadcasting_enabled(bool p_enabled) override;
 	virtual void set_blocking_enabled(bool p_enabled) override;
+	virtual bool is_blocking_enabled() const override;
 	virtual void set_ipv6_only_enabled(bool p_enabled) override;
 	virtual void set_tcp_no_delay_enabled(bool p_enabled) override;
 	virtual void set_reuse_address_enabled(bool p_enabled) override;
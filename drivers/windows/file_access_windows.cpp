@@ -42,6 +42,7 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <tchar.h>
+#include <windows.h>
 
 #include <cerrno>
 #include <cwchar>
@@ -239,6 +240,12 @@ void FileAccessWindows::_close() {
 		return;
 	}
 
+	if (mapped_data) {
+		UnmapViewOfFile(mapped_data);
+		mapped_data = nullptr;
+		mapped_length = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -350,6 +357,43 @@ uint64_t FileAccessWindows::get_buffer(uint8_t *p_dst, uint64_t p_length) const
 	return read;
 }
 
+Error FileAccessWindows::map_read_only() {
+	ERR_FAIL_NULL_V_MSG(f, ERR_FILE_CANT_READ, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(flags != READ, ERR_FILE_CANT_READ, "Only files opened for reading can be mapped.");
+
+	if (mapped_data) {
+		return OK;
+	}
+
+	uint64_t length = get_length();
+	if (length == 0) {
+		return ERR_UNAVAILABLE;
+	}
+
+	HANDLE file_handle = (HANDLE)_get_osfhandle(_fileno(f));
+	if (file_handle == INVALID_HANDLE_VALUE) {
+		return ERR_UNAVAILABLE;
+	}
+	HANDLE mapping = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr) {
+		return ERR_UNAVAILABLE;
+	}
+	// The view keeps the mapping object alive.
+	void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (view == nullptr) {
+		return ERR_UNAVAILABLE;
+	}
+
+	mapped_data = (uint8_t *)view;
+	mapped_length = length;
+	return OK;
+}
+
+Span<uint8_t> FileAccessWindows::get_mapped_data() const {
+	return Span<uint8_t>(mapped_data, mapped_length);
+}
+
 Error FileAccessWindows::get_error() const {
 	return last_error;
 }
@@ -40,6 +40,8 @@ class FileAccessWindows : public FileAccess {
 	GDSOFTCLASS(FileAccessWindows, FileAccess);
 	FILE *f = nullptr;
 	int flags = 0;
+	uint8_t *mapped_data = nullptr;
+	uint64_t mapped_length = 0;
 	void check_errors(bool p_write = false) const;
 	mutable int prev_op = 0;
 	mutable Error last_error = OK;
@@ -70,6 +72,9 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
 
+	virtual Error map_read_only() override;
+	virtual Span<uint8_t> get_mapped_data() const override;
+
 	virtual Error get_error() const override; ///< get last error
 
 	virtual Error resize(int64_t p_length) override;
@@ -274,6 +274,7 @@ void NetSocketWinSock::close() {
 	_sock = INVALID_SOCKET;
 	_ip_type = IP::TYPE_NONE;
 	_is_stream = false;
+	_is_blocking = true;
 }
 
 Error NetSocketWinSock::bind(Address p_addr) {
@@ -522,9 +523,17 @@ void NetSocketWinSock::set_blocking_enabled(bool p_enabled) {
 	ret = ioctlsocket(_sock, FIONBIO, &par);
 	if (ret != 0) {
 		WARN_PRINT("Unable to change non-block mode.");
+	} else {
+		_is_blocking = p_enabled;
 	}
 }
 
+bool NetSocketWinSock::is_blocking_enabled() const {
+	ERR_FAIL_COND_V(!is_open(), false);
+
+	return _is_blocking;
+}
+
 void NetSocketWinSock::set_ipv6_only_enabled(bool p_enabled) {
 	ERR_FAIL_COND(!is_open());
 	// This option is only available in IPv6 sockets.
@@ -44,6 +44,7 @@ private:
 	SOCKET _sock = INVALID_SOCKET;
 	IP::Type _ip_type = IP::TYPE_NONE;
 	bool _is_stream = false;
+	bool _is_blocking = true; // Winsock can't query FIONBIO, track it instead.
 
 	enum NetError {
 		ERR_NET_WOULD_BLOCK,
@@ -88,6 +89,7 @@ public:
 
 	virtual Error set_broadcasting_enabled(bool p_enabled) override;
 	virtual void set_blocking_enabled(bool p_enabled) override;
+	virtual bool is_blocking_enabled() const override;
 	virtual void set_ipv6_only_enabled(bool p_enabled) override;
 	virtual void set_tcp_no_delay_enabled(bool p_enabled) override;
 	virtual void set_reuse_address_enabled(bool p_enabled) override;
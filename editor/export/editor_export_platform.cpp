@@ -2387,6 +2387,31 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		return ERR_CANT_CREATE;
 	}
 
+	// Append a path index when the directory is stored in the clear. Patches with removals or deltas
+	// are left without one, as they are applied on top of the packs loaded before them.
+	Vector<String> index_paths;
+	if (key.is_empty()) {
+		for (const SavedData &sd : pd.file_ofs) {
+			if (sd.removal || sd.delta) {
+				index_paths.clear();
+				break;
+			}
+			index_paths.push_back(String::utf8(sd.path_utf8.get_data(), sd.path_utf8.length()));
+		}
+	}
+	Vector<uint8_t> path_index;
+	if (!index_paths.is_empty() && PackedData::build_path_index(index_paths, path_index)) {
+		uint64_t index_offset = f->get_position();
+		f->store_buffer(path_index);
+		uint64_t index_end = f->get_position();
+
+		f->seek(pck_start_pos + PACK_HEADER_FLAGS_POS);
+		f->store_32(PACK_REL_FILEBASE | PACK_PATH_INDEX);
+		f->seek(pck_start_pos + PACK_HEADER_PATH_INDEX_POS);
+		f->store_64(index_offset - pck_start_pos);
+		f->seek(index_end);
+	}
+
 	if (p_embed) {
 		// Ensure embedded data ends at a 64-bit multiple.
 		uint64_t embed_end = f->get_position() - embed_pos + 12;
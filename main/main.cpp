@@ -2138,7 +2138,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		} else {
 			int worker_threads = GLOBAL_GET("threading/worker_pool/max_threads");
 			float low_priority_ratio = GLOBAL_GET("threading/worker_pool/low_priority_thread_ratio");
-			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_ratio);
+			bool use_work_stealing = GLOBAL_GET("threading/worker_pool/use_work_stealing");
+			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_ratio, use_work_stealing);
 		}
 #else
 		WorkerThreadPool::get_singleton()->init(0, 0);
@@ -5236,6 +5237,7 @@ void Main::cleanup(bool p_force) {
 	}
 
 	ResourceLoader::clear_thread_load_tasks();
+	ResourceCache::clear_retained();
 
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
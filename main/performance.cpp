@@ -32,11 +32,14 @@
 #include "performance.compat.inc"
 
 #include "core/config/engine.h"
+#include "core/io/resource.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
+#include "core/variant/variant_pools.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
+#include "scene/resources/packed_scene.h"
 #include "servers/audio/audio_server.h"
 #include "servers/rendering/rendering_server.h"
 
@@ -135,6 +138,14 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(MEMORY_VARIANT_POOLS);
+	BIND_ENUM_CONSTANT(MEMORY_VARIANT_POOLS_TRANSFERS);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCE_CACHE_RETAINED);
+	BIND_ENUM_CONSTANT(OBJECT_RESOURCE_CACHE_HITS);
+	BIND_ENUM_CONSTANT(OBJECT_RESOURCE_CACHE_MISSES);
+	BIND_ENUM_CONSTANT(OBJECT_RESOURCE_CACHE_EVICTIONS);
+	BIND_ENUM_CONSTANT(OBJECT_SCENE_POOL_HITS);
+	BIND_ENUM_CONSTANT(OBJECT_SCENE_POOL_MISSES);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_QUANTITY);
@@ -230,6 +241,14 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("memory/variant_pools"),
+		PNAME("memory/variant_pools_transfers"),
+		PNAME("memory/resource_cache_retained"),
+		PNAME("object/resource_cache_hits"),
+		PNAME("object/resource_cache_misses"),
+		PNAME("object/resource_cache_evictions"),
+		PNAME("object/scene_pool_hits"),
+		PNAME("object/scene_pool_misses"),
 	};
 	static_assert(std_size(names) == MONITOR_MAX);
 
@@ -455,6 +474,23 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
 
+		case MEMORY_VARIANT_POOLS:
+			return VariantPools::get_memory_usage();
+		case MEMORY_VARIANT_POOLS_TRANSFERS:
+			return VariantPools::get_transfer_count();
+		case MEMORY_RESOURCE_CACHE_RETAINED:
+			return ResourceCache::get_retained_size();
+		case OBJECT_RESOURCE_CACHE_HITS:
+			return ResourceCache::get_hit_count();
+		case OBJECT_RESOURCE_CACHE_MISSES:
+			return ResourceCache::get_miss_count();
+		case OBJECT_RESOURCE_CACHE_EVICTIONS:
+			return ResourceCache::get_eviction_count();
+		case OBJECT_SCENE_POOL_HITS:
+			return PackedScene::get_pool_hit_count();
+		case OBJECT_SCENE_POOL_MISSES:
+			return PackedScene::get_pool_miss_count();
+
 		default: {
 		}
 	}
@@ -527,7 +563,14 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 #endif // _3D_DISABLED
-
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
 
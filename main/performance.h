@@ -122,6 +122,14 @@ public:
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
 #endif // _3D_DISABLED
+		MEMORY_VARIANT_POOLS,
+		MEMORY_VARIANT_POOLS_TRANSFERS,
+		MEMORY_RESOURCE_CACHE_RETAINED,
+		OBJECT_RESOURCE_CACHE_HITS,
+		OBJECT_RESOURCE_CACHE_MISSES,
+		OBJECT_RESOURCE_CACHE_EVICTIONS,
+		OBJECT_SCENE_POOL_HITS,
+		OBJECT_SCENE_POOL_MISSES,
 		MONITOR_MAX
 	};
 
@@ -3,6 +3,18 @@ def can_build(env, platform):
     return True
 
 
+def get_opts(platform):
+    from SCons.Variables import BoolVariable
+
+    return [
+        BoolVariable(
+            "gdscript_opcode_pair_profiling",
+            "Count executed GDScript opcode pairs and print the most frequent ones on exit",
+            False,
+        ),
+    ]
+
+
 def configure(env):
     pass
 
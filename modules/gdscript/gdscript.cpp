@@ -31,6 +31,7 @@
 #include "gdscript.h"
 
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
@@ -772,6 +773,8 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 #endif
 
+	// Parser already holding this exact source in the cache, if any.
+	Ref<GDScriptParserRef> cached_parser_ref;
 	{
 		String source_path = path;
 		if (source_path.is_empty()) {
@@ -786,14 +789,11 @@ Error GDScript::reload(bool p_keep_state) {
 				Error err = OK;
 				Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(source_path, GDScriptParserRef::EMPTY, err);
 				if (parser_ref.is_valid()) {
-					uint32_t source_hash;
-					if (!binary_tokens.is_empty()) {
-						source_hash = hash_djb2_buffer(binary_tokens.ptr(), binary_tokens.size());
-					} else {
-						source_hash = source.hash();
-					}
-					if (parser_ref->get_source_hash() != source_hash) {
+					if (parser_ref->get_source_hash() != get_source_hash()) {
 						GDScriptCache::remove_parser(source_path);
+					} else if (parser_ref->get_status() != GDScriptParserRef::EMPTY && !parser_ref->is_raising_status()) {
+						// A parser still being resolved further up the stack (e.g. through a cyclic preload) has an incomplete tree.
+						cached_parser_ref = parser_ref;
 					}
 				}
 			}
@@ -809,44 +809,120 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
-	GDScriptParser parser;
 	Error err;
-	if (!binary_tokens.is_empty()) {
-		err = parser.parse_binary(binary_tokens, path);
-	} else {
-		err = parser.parse(source, path, false);
-	}
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().start_line, "Parser Error: " + parser.get_errors().front()->get().message);
+
+	// Exported bytecode that `GDScriptCache` found up to date replaces parsing, analyzing and compiling.
+	if (!bytecode.is_empty()) {
+		const Vector<uint8_t> buffer = bytecode;
+		bytecode.clear();
+		if (!has_instances && GDScriptBytecodeCache::load(this, buffer) == OK) {
+			can_run = ScriptServer::is_scripting_enabled() || tool;
+
+			err = GDScriptCache::finish_compiling(path);
+			if (err) {
+				_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), 0, "Compile Error: Failed to compile depended scripts.", false, ERR_HANDLER_SCRIPT);
+				reloading = false;
+				return can_run ? ERR_COMPILATION_FAILED : err;
+			}
+
+			if (can_run) {
+				err = _static_init();
+				if (err) {
+					return err;
+				}
+			}
+
+#ifdef TOOLS_ENABLED
+			if (can_run && p_keep_state) {
+				_restore_old_static_data();
+			}
+
+			if (p_keep_state) {
+				update_exports();
+			}
+#endif
+
+			reloading = false;
+			return OK;
 		}
-		// TODO: Show all error messages.
-		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser.get_errors().front()->get().start_line, ("Parse Error: " + parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-		reloading = false;
-		return ERR_PARSE_ERROR;
+		print_verbose(vformat(R"(GDScript: Exported bytecode of "%s" could not be loaded, compiling it from source.)", path));
 	}
 
-	GDScriptAnalyzer analyzer(&parser);
-	err = analyzer.analyze();
+	// Resolving dependencies can evict this script from the cache, which clears its parser.
+	// Pin the cached parser so its tree stays alive until compilation is done.
+	struct ParserPin {
+		Ref<GDScriptParserRef> ref;
+		void set(const Ref<GDScriptParserRef> &p_ref) {
+			release();
+			ref = p_ref;
+			if (ref.is_valid()) {
+				ref->pin();
+			}
+		}
+		void release() {
+			if (ref.is_valid()) {
+				ref->unpin();
+				ref.unref();
+			}
+		}
+		~ParserPin() { release(); }
+	} parser_pin;
 
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().start_line, "Parser Error: " + parser.get_errors().front()->get().message);
+	// Dependent scripts usually got this script parsed and analyzed through the cache already.
+	// Compile from that tree instead of parsing and analyzing the same source a second time.
+	if (cached_parser_ref.is_valid()) {
+		parser_pin.set(cached_parser_ref);
+		err = cached_parser_ref->raise_status(GDScriptParserRef::FULLY_SOLVED);
+		if (err == OK) {
+			err = cached_parser_ref->get_analyzer()->resolve_dependencies();
+		}
+		if (err != OK) {
+			// Parse again below, so errors are reported the same way as without the cache.
+			parser_pin.release();
+			cached_parser_ref.unref();
 		}
+	}
 
-		const List<GDScriptParser::ParserError>::Element *e = parser.get_errors().front();
-		while (e != nullptr) {
-			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().start_line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-			e = e->next();
+	GDScriptParser local_parser;
+	GDScriptParser *parser = cached_parser_ref.is_valid() ? cached_parser_ref->get_parser() : &local_parser;
+	if (cached_parser_ref.is_null()) {
+		if (!binary_tokens.is_empty()) {
+			err = parser->parse_binary(binary_tokens, path);
+		} else {
+			err = parser->parse(source, path, false);
+		}
+		if (err) {
+			if (EngineDebugger::is_active()) {
+				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser->get_errors().front()->get().start_line, "Parser Error: " + parser->get_errors().front()->get().message);
+			}
+			// TODO: Show all error messages.
+			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser->get_errors().front()->get().start_line, ("Parse Error: " + parser->get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+			reloading = false;
+			return ERR_PARSE_ERROR;
+		}
+
+		GDScriptAnalyzer analyzer(parser);
+		err = analyzer.analyze();
+
+		if (err) {
+			if (EngineDebugger::is_active()) {
+				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser->get_errors().front()->get().start_line, "Parser Error: " + parser->get_errors().front()->get().message);
+			}
+
+			const List<GDScriptParser::ParserError>::Element *e = parser->get_errors().front();
+			while (e != nullptr) {
+				_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().start_line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+				e = e->next();
+			}
+			reloading = false;
+			return ERR_PARSE_ERROR;
 		}
-		reloading = false;
-		return ERR_PARSE_ERROR;
 	}
 
-	can_run = ScriptServer::is_scripting_enabled() || parser.is_tool();
+	can_run = ScriptServer::is_scripting_enabled() || parser->is_tool();
 
 	GDScriptCompiler compiler;
-	err = compiler.compile(&parser, this, p_keep_state);
+	err = compiler.compile(parser, this, p_keep_state);
 
 	if (err) {
 		// TODO: Provide the script function as the first argument.
@@ -866,11 +942,11 @@ Error GDScript::reload(bool p_keep_state) {
 #ifdef TOOLS_ENABLED
 	// Done after compilation because it needs the GDScript object's inner class GDScript objects,
 	// which are made by calling make_scripts() within compiler.compile() above.
-	GDScriptDocGen::generate_docs(this, parser.get_tree());
+	GDScriptDocGen::generate_docs(this, parser->get_tree());
 #endif
 
 #ifdef DEBUG_ENABLED
-	for (const GDScriptWarning &warning : parser.get_warnings()) {
+	for (const GDScriptWarning &warning : parser->get_warnings()) {
 		if (EngineDebugger::is_active()) {
 			Vector<ScriptLanguage::StackInfo> si;
 			// TODO: Provide the script function as the first argument.
@@ -1175,6 +1251,17 @@ Vector<uint8_t> GDScript::get_as_binary_tokens() const {
 	return tokenizer.parse_code_string(source, GDScriptTokenizerBuffer::COMPRESS_NONE);
 }
 
+uint32_t GDScript::get_source_hash() const {
+	if (!binary_tokens.is_empty()) {
+		return hash_djb2_buffer(binary_tokens.ptr(), binary_tokens.size());
+	}
+	return source.hash();
+}
+
+void GDScript::set_bytecode(const Vector<uint8_t> &p_bytecode) {
+	bytecode = p_bytecode;
+}
+
 const HashMap<StringName, GDScriptFunction *> &GDScript::debug_get_member_functions() const {
 	return member_functions;
 }
@@ -2231,6 +2318,10 @@ void GDScriptLanguage::finish() {
 	}
 	finishing = true;
 
+#ifdef GDSCRIPT_OPCODE_PAIR_PROFILING
+	GDScriptFunction::print_opcode_pair_profile();
+#endif
+
 	// Clear the cache before parsing the script_list
 	GDScriptCache::clear();
 
@@ -559,6 +559,9 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, Variant::NIL);
 
+		last_validated_operator_pos = opcodes.size();
+		last_validated_operator_left = p_left_operand;
+		last_validated_operator_target = p_target;
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(Address());
@@ -616,6 +619,9 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		last_validated_operator_pos = opcodes.size();
+		last_validated_operator_left = p_left_operand;
+		last_validated_operator_target = p_target;
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -883,12 +889,15 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
+	try_fuse_member_validated_operator(p_value);
 	append_opcode(GDScriptFunction::OPCODE_SET_MEMBER);
 	append(p_value);
 	append(p_name);
 }
 
 void GDScriptByteCodeGenerator::write_get_member(const Address &p_target, const StringName &p_name) {
+	last_get_member_pos = opcodes.size();
+	last_get_member_target = p_target;
 	append_opcode(GDScriptFunction::OPCODE_GET_MEMBER);
 	append(p_target);
 	append(p_name);
@@ -1511,9 +1520,46 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 	append(p_target);
 }
 
+bool GDScriptByteCodeGenerator::try_fuse_validated_operator_jump_if_not(const Address &p_condition) {
+	// The operator must be the instruction right before the jump and write to the tested address.
+	if (last_validated_operator_pos < 0 || last_validated_operator_pos + 5 != opcodes.size()) {
+		return false;
+	}
+	if (last_validated_operator_target.mode != p_condition.mode || last_validated_operator_target.address != p_condition.address) {
+		return false;
+	}
+
+	// The result is still written to the target, so code reading it afterwards keeps working.
+	opcodes.write[last_validated_operator_pos] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+	last_validated_operator_pos = -1;
+	return true;
+}
+
+bool GDScriptByteCodeGenerator::try_fuse_member_validated_operator(const Address &p_value) {
+	// Matches `get_member`, then a validated operator on the member, then `set_member` of its result,
+	// as generated for compound assignments to properties. All three must be back to back.
+	if (last_get_member_pos < 0 || last_get_member_pos + 3 != last_validated_operator_pos || last_validated_operator_pos + 5 != opcodes.size()) {
+		return false;
+	}
+	if (last_get_member_target.mode != last_validated_operator_left.mode || last_get_member_target.address != last_validated_operator_left.address) {
+		return false;
+	}
+	if (last_validated_operator_target.mode != p_value.mode || last_validated_operator_target.address != p_value.address) {
+		return false;
+	}
+
+	// The instructions are kept in place, the first one now runs all three.
+	opcodes.write[last_get_member_pos] = GDScriptFunction::OPCODE_MEMBER_OPERATOR_VALIDATED;
+	last_get_member_pos = -1;
+	last_validated_operator_pos = -1;
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!try_fuse_validated_operator_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1731,6 +1777,8 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 	// Next iteration.
 	int continue_addr = opcodes.size();
 	continue_addrs.push_back(continue_addr);
+	last_validated_operator_pos = -1;
+	last_get_member_pos = -1;
 	append_opcode(iterate_opcode);
 	append(counter);
 	if (p_is_range) {
@@ -1783,12 +1831,16 @@ void GDScriptByteCodeGenerator::write_endfor(bool p_is_range) {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	last_validated_operator_pos = -1;
+	last_get_member_pos = -1;
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!try_fuse_validated_operator_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
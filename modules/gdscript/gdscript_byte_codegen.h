@@ -162,6 +162,17 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	List<List<int>> current_breaks_to_patch;
 
+	// Position, left operand and result of the last validated operator, so a conditional
+	// jump on its result can be fused with it into a single instruction.
+	int last_validated_operator_pos = -1;
+	Address last_validated_operator_left;
+	Address last_validated_operator_target;
+
+	// Position and target of the last member read, so a compound assignment to a
+	// property can be fused into a single instruction.
+	int last_get_member_pos = -1;
+	Address last_get_member_target;
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -453,8 +464,14 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		// Something jumps here, so the previous instruction can't be fused with the next.
+		last_validated_operator_pos = -1;
+		last_get_member_pos = -1;
 	}
 
+	bool try_fuse_validated_operator_jump_if_not(const Address &p_condition);
+	bool try_fuse_member_validated_operator(const Address &p_value);
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -0,0 +1,1521 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_bytecode_cache.h"
+
+#include "gdscript.h"
+#include "gdscript_cache.h"
+#include "gdscript_utility_functions.h"
+
+#ifdef TOOLS_ENABLED
+#include "gdscript_analyzer.h"
+#include "gdscript_compiler.h"
+#include "gdscript_parser.h"
+#include "gdscript_tokenizer_buffer.h"
+
+#include "core/templates/rb_map.h"
+#endif
+
+#include "core/config/engine.h"
+#include "core/io/marshalls.h"
+#include "core/io/resource_loader.h"
+#include "core/object/class_db.h"
+#include "core/version.h"
+
+static constexpr uint8_t BYTECODE_MAGIC[4] = { 'G', 'D', 'B', 'C' };
+
+enum BytecodeFlags {
+	BYTECODE_FLAG_DEBUG = 1 << 0, // Compiled with `assert()` and `breakpoint`, for debug builds.
+	BYTECODE_FLAG_KEEP_STATIC_DATA = 1 << 1, // Has static variables and no `@static_unload`.
+};
+
+enum BytecodeValueKind {
+	BYTECODE_VALUE_PLAIN,
+	BYTECODE_VALUE_ARRAY,
+	BYTECODE_VALUE_DICTIONARY,
+	BYTECODE_VALUE_NULL_OBJECT,
+	BYTECODE_VALUE_SCRIPT_CLASS, // Path of the script and fully qualified name of the class.
+	BYTECODE_VALUE_NATIVE_CLASS,
+	BYTECODE_VALUE_SINGLETON,
+	BYTECODE_VALUE_RESOURCE,
+};
+
+class GDScriptBytecodeCache::Reader {
+	const uint8_t *data = nullptr;
+	int size = 0;
+	int pos = 0;
+
+public:
+	bool failed = false;
+
+	bool get_data(uint8_t *r_data, int p_size) {
+		if (failed || p_size < 0 || p_size > size - pos) {
+			failed = true;
+			return false;
+		}
+		memcpy(r_data, data + pos, p_size);
+		pos += p_size;
+		return true;
+	}
+
+	uint8_t get_u8() {
+		uint8_t value = 0;
+		get_data(&value, 1);
+		return value;
+	}
+
+	bool get_bool() {
+		return get_u8() != 0;
+	}
+
+	uint32_t get_u32() {
+		uint8_t buffer[4] = {};
+		if (!get_data(buffer, 4)) {
+			return 0;
+		}
+		return decode_uint32(buffer);
+	}
+
+	int32_t get_32() {
+		return (int32_t)get_u32();
+	}
+
+	// Counts can't exceed the bytes left, so corrupted data doesn't cause huge allocations.
+	int get_count() {
+		const uint32_t count = get_u32();
+		if (failed || count > uint32_t(size - pos)) {
+			failed = true;
+			return 0;
+		}
+		return count;
+	}
+
+	Variant::Type get_type() {
+		const uint32_t type = get_u32();
+		if (type >= Variant::VARIANT_MAX) {
+			failed = true;
+			return Variant::NIL;
+		}
+		return Variant::Type(type);
+	}
+
+	String get_string() {
+		const int length = get_count();
+		String string;
+		if (!failed && length > 0) {
+			if (string.append_utf8((const char *)data + pos, length) != OK) {
+				failed = true;
+			}
+			pos += length;
+		}
+		return string;
+	}
+
+	Variant get_var() {
+		const int length = get_count();
+		Variant value;
+		if (!failed) {
+			if (decode_variant(value, data + pos, length, nullptr, false) != OK) {
+				failed = true;
+				return Variant();
+			}
+			pos += length;
+		}
+		return value;
+	}
+
+	Reader(const Vector<uint8_t> &p_buffer) :
+			data(p_buffer.ptr()), size(p_buffer.size()) {}
+};
+
+bool GDScriptBytecodeCache::_read_header(Reader &r_reader, uint32_t &r_flags, uint32_t &r_source_hash, HashMap<String, uint32_t> &r_dependencies) {
+	uint8_t magic[4] = {};
+	r_reader.get_data(magic, 4);
+	if (r_reader.failed || memcmp(magic, BYTECODE_MAGIC, 4) != 0) {
+		return false;
+	}
+	// Function pointers are looked up by name, but the opcodes and their operands are only valid for the exact engine build.
+	if (r_reader.get_u32() != FORMAT_VERSION || r_reader.get_string() != GODOT_VERSION_FULL_CONFIG || r_reader.get_string() != GODOT_VERSION_HASH) {
+		return false;
+	}
+
+	r_flags = r_reader.get_u32();
+#ifdef DEBUG_ENABLED
+	const bool debug_build = true;
+#else
+	const bool debug_build = false;
+#endif
+	if (bool(r_flags & BYTECODE_FLAG_DEBUG) != debug_build) {
+		return false;
+	}
+
+	r_source_hash = r_reader.get_u32();
+	const int dependency_count = r_reader.get_count();
+	for (int i = 0; i < dependency_count && !r_reader.failed; i++) {
+		const String path = r_reader.get_string();
+		r_dependencies[path] = r_reader.get_u32();
+	}
+	return !r_reader.failed;
+}
+
+void GDScriptBytecodeCache::_make_scripts(Reader &r_reader, GDScript *p_script, const String &p_fully_qualified_name, const StringName &p_local_name) {
+	p_script->fully_qualified_name = p_fully_qualified_name;
+	p_script->local_name = p_local_name;
+	p_script->global_name = r_reader.get_string();
+	p_script->simplified_icon_path = r_reader.get_string();
+
+	HashMap<StringName, Ref<GDScript>> old_subclasses;
+	old_subclasses = p_script->subclasses;
+	p_script->subclasses.clear();
+
+	const int subclass_count = r_reader.get_count();
+	for (int i = 0; i < subclass_count && !r_reader.failed; i++) {
+		const StringName name = r_reader.get_string();
+		const String fully_qualified_name = r_reader.get_string();
+
+		Ref<GDScript> subclass;
+		if (old_subclasses.has(name)) {
+			subclass = old_subclasses[name];
+		} else {
+			subclass = GDScriptLanguage::get_singleton()->get_orphan_subclass(fully_qualified_name);
+		}
+		if (subclass.is_null()) {
+			subclass.instantiate();
+		}
+
+		subclass->_owner = p_script;
+		subclass->path = p_script->path;
+		p_script->subclasses.insert(name, subclass);
+
+		_make_scripts(r_reader, subclass.ptr(), fully_qualified_name, name);
+	}
+}
+
+bool GDScriptBytecodeCache::_check_class_tree(Reader &r_reader, GDScript *p_script) {
+	// Classes must be the ones `make_scripts()` created and still be empty, compiling handles anything else.
+	if (p_script->valid || !p_script->member_functions.is_empty() || !p_script->member_indices.is_empty() || !p_script->constants.is_empty() ||
+			p_script->implicit_initializer || p_script->implicit_ready || p_script->static_initializer) {
+		return false;
+	}
+	if (r_reader.get_string() != String(p_script->global_name) || r_reader.get_string() != p_script->simplified_icon_path) {
+		return false;
+	}
+
+	const int subclass_count = r_reader.get_count();
+	if (r_reader.failed || subclass_count != p_script->subclasses.size()) {
+		return false;
+	}
+	for (int i = 0; i < subclass_count; i++) {
+		const StringName name = r_reader.get_string();
+		const String fully_qualified_name = r_reader.get_string();
+		const Ref<GDScript> *subclass = p_script->subclasses.getptr(name);
+		if (r_reader.failed || subclass == nullptr || (*subclass)->fully_qualified_name != fully_qualified_name) {
+			return false;
+		}
+		if (!_check_class_tree(r_reader, subclass->ptr())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+Ref<GDScript> GDScriptBytecodeCache::_resolve_script(const String &p_path, const String &p_fully_qualified_name, GDScript *p_root) {
+	if (p_path == p_root->path) {
+		return Ref<GDScript>(p_root->find_class(p_fully_qualified_name));
+	}
+
+	// Registers the dependency, so `GDScriptCache::finish_compiling()` fully loads it.
+	Error err = OK;
+	Ref<GDScript> root = GDScriptCache::get_shallow_script(p_path, err, p_root->path);
+	if (err || root.is_null()) {
+		return Ref<GDScript>();
+	}
+	return Ref<GDScript>(root->find_class(p_fully_qualified_name));
+}
+
+Variant GDScriptBytecodeCache::_read_value(Reader &r_reader, GDScript *p_root) {
+	switch (r_reader.get_u8()) {
+		case BYTECODE_VALUE_PLAIN: {
+			return r_reader.get_var();
+		}
+		case BYTECODE_VALUE_ARRAY: {
+			const bool read_only = r_reader.get_bool();
+			const Variant::Type element_type = r_reader.get_type();
+			const StringName element_class_name = r_reader.get_string();
+			const Variant element_script = _read_value(r_reader, p_root);
+			const int size = r_reader.get_count();
+
+			Array array;
+			if (!r_reader.failed && element_type != Variant::NIL) {
+				array.set_typed(element_type, element_class_name, element_script);
+			}
+			for (int i = 0; i < size && !r_reader.failed; i++) {
+				array.push_back(_read_value(r_reader, p_root));
+			}
+			if (read_only) {
+				array.make_read_only();
+			}
+			return array;
+		}
+		case BYTECODE_VALUE_DICTIONARY: {
+			const bool read_only = r_reader.get_bool();
+			const Variant::Type key_type = r_reader.get_type();
+			const StringName key_class_name = r_reader.get_string();
+			const Variant key_script = _read_value(r_reader, p_root);
+			const Variant::Type value_type = r_reader.get_type();
+			const StringName value_class_name = r_reader.get_string();
+			const Variant value_script = _read_value(r_reader, p_root);
+			const int size = r_reader.get_count();
+
+			Dictionary dictionary;
+			if (!r_reader.failed && (key_type != Variant::NIL || value_type != Variant::NIL)) {
+				dictionary.set_typed(key_type, key_class_name, key_script, value_type, value_class_name, value_script);
+			}
+			for (int i = 0; i < size && !r_reader.failed; i++) {
+				const Variant key = _read_value(r_reader, p_root);
+				dictionary[key] = _read_value(r_reader, p_root);
+			}
+			if (read_only) {
+				dictionary.make_read_only();
+			}
+			return dictionary;
+		}
+		case BYTECODE_VALUE_NULL_OBJECT: {
+			return Variant((Object *)nullptr);
+		}
+		case BYTECODE_VALUE_SCRIPT_CLASS: {
+			const String path = r_reader.get_string();
+			const String fully_qualified_name = r_reader.get_string();
+			if (r_reader.failed) {
+				return Variant();
+			}
+			Ref<GDScript> script = _resolve_script(path, fully_qualified_name, p_root);
+			if (script.is_null()) {
+				r_reader.failed = true;
+			}
+			return script;
+		}
+		case BYTECODE_VALUE_NATIVE_CLASS: {
+			const StringName name = r_reader.get_string();
+			const int *index = GDScriptLanguage::get_singleton()->get_global_map().getptr(name);
+			if (r_reader.failed || index == nullptr) {
+				r_reader.failed = true;
+				return Variant();
+			}
+			return GDScriptLanguage::get_singleton()->get_global_array()[*index];
+		}
+		case BYTECODE_VALUE_SINGLETON: {
+			const StringName name = r_reader.get_string();
+			if (r_reader.failed || !Engine::get_singleton()->has_singleton(name)) {
+				r_reader.failed = true;
+				return Variant();
+			}
+			return Engine::get_singleton()->get_singleton_object(name);
+		}
+		case BYTECODE_VALUE_RESOURCE: {
+			const String path = r_reader.get_string();
+			Ref<Resource> resource;
+			if (!r_reader.failed) {
+				resource = ResourceLoader::load(path);
+			}
+			if (resource.is_null()) {
+				r_reader.failed = true;
+			}
+			return resource;
+		}
+		default: {
+			r_reader.failed = true;
+			return Variant();
+		}
+	}
+}
+
+GDScriptDataType GDScriptBytecodeCache::_read_data_type(Reader &r_reader, GDScript *p_root) {
+	GDScriptDataType type;
+	const uint8_t kind = r_reader.get_u8();
+	if (kind > GDScriptDataType::GDSCRIPT) {
+		r_reader.failed = true;
+		return type;
+	}
+	type.kind = GDScriptDataType::Kind(kind);
+	type.builtin_type = r_reader.get_type();
+	type.native_type = r_reader.get_string();
+
+	if (type.kind == GDScriptDataType::SCRIPT || type.kind == GDScriptDataType::GDSCRIPT) {
+		Ref<Script> script = _read_value(r_reader, p_root);
+		if (script.is_null()) {
+			r_reader.failed = true;
+			return type;
+		}
+		type.script_type = script.ptr();
+		// Like the compiler, don't hold a strong reference to classes of the same script, to avoid cycles.
+		GDScript *gdscript = Object::cast_to<GDScript>(script.ptr());
+		if (type.kind == GDScriptDataType::SCRIPT || gdscript == nullptr || gdscript->get_root_script() != p_root) {
+			type.script_type_ref = script;
+		}
+	}
+
+	const int element_count = r_reader.get_count();
+	for (int i = 0; i < element_count && !r_reader.failed; i++) {
+		type.set_container_element_type(i, _read_data_type(r_reader, p_root));
+	}
+	return type;
+}
+
+PropertyInfo GDScriptBytecodeCache::_read_property_info(Reader &r_reader) {
+	PropertyInfo info;
+	info.type = r_reader.get_type();
+	info.name = r_reader.get_string();
+	info.class_name = r_reader.get_string();
+	info.hint = PropertyHint(r_reader.get_u32());
+	info.hint_string = r_reader.get_string();
+	info.usage = r_reader.get_u32();
+	return info;
+}
+
+MethodInfo GDScriptBytecodeCache::_read_method_info(Reader &r_reader, GDScript *p_root) {
+	MethodInfo info;
+	info.name = r_reader.get_string();
+	info.return_val = _read_property_info(r_reader);
+	info.flags = r_reader.get_u32();
+	info.id = r_reader.get_32();
+
+	const int argument_count = r_reader.get_count();
+	for (int i = 0; i < argument_count && !r_reader.failed; i++) {
+		info.arguments.push_back(_read_property_info(r_reader));
+	}
+	const int default_argument_count = r_reader.get_count();
+	for (int i = 0; i < default_argument_count && !r_reader.failed; i++) {
+		info.default_arguments.push_back(_read_value(r_reader, p_root));
+	}
+
+	info.return_val_metadata = r_reader.get_32();
+	const int metadata_count = r_reader.get_count();
+	for (int i = 0; i < metadata_count && !r_reader.failed; i++) {
+		info.arguments_metadata.push_back(r_reader.get_32());
+	}
+	return info;
+}
+
+bool GDScriptBytecodeCache::_read_member_info(Reader &r_reader, GDScript::MemberInfo &r_info, GDScript *p_root) {
+	r_info.index = r_reader.get_32();
+	r_info.setter = r_reader.get_string();
+	r_info.getter = r_reader.get_string();
+	r_info.data_type = _read_data_type(r_reader, p_root);
+	r_info.property_info = _read_property_info(r_reader);
+	return !r_reader.failed;
+}
+
+GDScriptFunction *GDScriptBytecodeCache::_read_function(Reader &r_reader, GDScript *p_script, GDScript *p_root) {
+	GDScriptFunction *function = memnew(GDScriptFunction);
+	function->_script = p_script;
+	function->source = p_script->get_script_path();
+	function->name = r_reader.get_string();
+#ifdef DEBUG_ENABLED
+	function->func_cname = (String(function->source) + " - " + String(function->name)).utf8();
+	function->_func_cname = function->func_cname.get_data();
+#endif
+
+	function->_static = r_reader.get_bool();
+	const int argument_count = r_reader.get_count();
+	for (int i = 0; i < argument_count && !r_reader.failed; i++) {
+		function->argument_types.push_back(_read_data_type(r_reader, p_root));
+	}
+	function->return_type = _read_data_type(r_reader, p_root);
+	function->method_info = _read_method_info(r_reader, p_root);
+	function->rpc_config = _read_value(r_reader, p_root);
+
+	function->_initial_line = r_reader.get_32();
+	function->_argument_count = r_reader.get_32();
+	function->_vararg_index = r_reader.get_32();
+	function->_stack_size = r_reader.get_32();
+	function->_instruction_args_size = r_reader.get_32();
+
+	const int temporary_count = r_reader.get_count();
+	for (int i = 0; i < temporary_count && !r_reader.failed; i++) {
+		const int index = r_reader.get_32();
+		function->temporary_slots.push_back(Pair(index, r_reader.get_type()));
+	}
+
+	function->code.resize(r_reader.get_count());
+	for (int &E : function->code) {
+		E = r_reader.get_32();
+	}
+	function->default_arguments.resize(r_reader.get_count());
+	for (int &E : function->default_arguments) {
+		E = r_reader.get_32();
+	}
+
+	const int constant_count = r_reader.get_count();
+	for (int i = 0; i < constant_count && !r_reader.failed; i++) {
+		function->constants.push_back(_read_value(r_reader, p_root));
+	}
+	const int local_constant_count = r_reader.get_count();
+	for (int i = 0; i < local_constant_count && !r_reader.failed; i++) {
+		const StringName name = r_reader.get_string();
+		function->constant_map.insert(name, _read_value(r_reader, p_root));
+	}
+	const int global_name_count = r_reader.get_count();
+	for (int i = 0; i < global_name_count && !r_reader.failed; i++) {
+		function->global_names.push_back(r_reader.get_string());
+	}
+
+	// Native function pointers are looked up again, they differ between builds and runs.
+	const int operator_count = r_reader.get_count();
+	for (int i = 0; i < operator_count && !r_reader.failed; i++) {
+		const uint32_t op = r_reader.get_u32();
+		const Variant::Type type_a = r_reader.get_type();
+		const Variant::Type type_b = r_reader.get_type();
+		Variant::ValidatedOperatorEvaluator evaluator = op < Variant::OP_MAX && !r_reader.failed ? Variant::get_validated_operator_evaluator(Variant::Operator(op), type_a, type_b) : nullptr;
+		r_reader.failed = r_reader.failed || evaluator == nullptr;
+		function->operator_funcs.push_back(evaluator);
+	}
+	const int setter_count = r_reader.get_count();
+	for (int i = 0; i < setter_count && !r_reader.failed; i++) {
+		const Variant::Type type = r_reader.get_type();
+		Variant::ValidatedSetter setter = Variant::get_member_validated_setter(type, r_reader.get_string());
+		r_reader.failed = r_reader.failed || setter == nullptr;
+		function->setters.push_back(setter);
+	}
+	const int getter_count = r_reader.get_count();
+	for (int i = 0; i < getter_count && !r_reader.failed; i++) {
+		const Variant::Type type = r_reader.get_type();
+		Variant::ValidatedGetter getter = Variant::get_member_validated_getter(type, r_reader.get_string());
+		r_reader.failed = r_reader.failed || getter == nullptr;
+		function->getters.push_back(getter);
+	}
+	const int keyed_setter_count = r_reader.get_count();
+	for (int i = 0; i < keyed_setter_count && !r_reader.failed; i++) {
+		Variant::ValidatedKeyedSetter setter = Variant::get_member_validated_keyed_setter(r_reader.get_type());
+		r_reader.failed = r_reader.failed || setter == nullptr;
+		function->keyed_setters.push_back(setter);
+	}
+	const int keyed_getter_count = r_reader.get_count();
+	for (int i = 0; i < keyed_getter_count && !r_reader.failed; i++) {
+		Variant::ValidatedKeyedGetter getter = Variant::get_member_validated_keyed_getter(r_reader.get_type());
+		r_reader.failed = r_reader.failed || getter == nullptr;
+		function->keyed_getters.push_back(getter);
+	}
+	const int indexed_setter_count = r_reader.get_count();
+	for (int i = 0; i < indexed_setter_count && !r_reader.failed; i++) {
+		Variant::ValidatedIndexedSetter setter = Variant::get_member_validated_indexed_setter(r_reader.get_type());
+		r_reader.failed = r_reader.failed || setter == nullptr;
+		function->indexed_setters.push_back(setter);
+	}
+	const int indexed_getter_count = r_reader.get_count();
+	for (int i = 0; i < indexed_getter_count && !r_reader.failed; i++) {
+		Variant::ValidatedIndexedGetter getter = Variant::get_member_validated_indexed_getter(r_reader.get_type());
+		r_reader.failed = r_reader.failed || getter == nullptr;
+		function->indexed_getters.push_back(getter);
+	}
+	const int builtin_method_count = r_reader.get_count();
+	for (int i = 0; i < builtin_method_count && !r_reader.failed; i++) {
+		const Variant::Type type = r_reader.get_type();
+		const StringName name = r_reader.get_string();
+		Variant::ValidatedBuiltInMethod method = Variant::has_builtin_method(type, name) ? Variant::get_validated_builtin_method(type, name) : nullptr;
+		r_reader.failed = r_reader.failed || method == nullptr;
+		function->builtin_methods.push_back(method);
+	}
+	const int constructor_count = r_reader.get_count();
+	for (int i = 0; i < constructor_count && !r_reader.failed; i++) {
+		const Variant::Type type = r_reader.get_type();
+		const int index = r_reader.get_32();
+		Variant::ValidatedConstructor constructor = index >= 0 && index < Variant::get_constructor_count(type) ? Variant::get_validated_constructor(type, index) : nullptr;
+		r_reader.failed = r_reader.failed || constructor == nullptr;
+		function->constructors.push_back(constructor);
+	}
+	const int utility_count = r_reader.get_count();
+	for (int i = 0; i < utility_count && !r_reader.failed; i++) {
+		Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(r_reader.get_string());
+		r_reader.failed = r_reader.failed || utility == nullptr;
+		function->utilities.push_back(utility);
+	}
+	const int gds_utility_count = r_reader.get_count();
+	for (int i = 0; i < gds_utility_count && !r_reader.failed; i++) {
+		const StringName name = r_reader.get_string();
+		GDScriptUtilityFunctions::FunctionPtr utility = GDScriptUtilityFunctions::function_exists(name) ? GDScriptUtilityFunctions::get_function(name) : nullptr;
+		r_reader.failed = r_reader.failed || utility == nullptr;
+		function->gds_utilities.push_back(utility);
+	}
+	const int method_count = r_reader.get_count();
+	for (int i = 0; i < method_count && !r_reader.failed; i++) {
+		const StringName class_name = r_reader.get_string();
+		MethodBind *method = ClassDB::get_method(class_name, r_reader.get_string());
+		r_reader.failed = r_reader.failed || method == nullptr;
+		function->methods.push_back(method);
+	}
+	const int lambda_count = r_reader.get_count();
+	for (int i = 0; i < lambda_count && !r_reader.failed; i++) {
+		GDScript::LambdaInfo info;
+		info.capture_count = r_reader.get_32();
+		info.use_self = r_reader.get_bool();
+		GDScriptFunction *lambda = _read_function(r_reader, p_script, p_root);
+		if (lambda == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		// Owned by the function from now on, so it's deleted along with it.
+		function->lambdas.push_back(lambda);
+		p_script->lambda_info.insert(lambda, info);
+	}
+
+	// Names for disassembling and error messages, only kept by debug builds.
+	for (int i = 0; i < 7 && !r_reader.failed; i++) {
+		Vector<String> names;
+		const int name_count = r_reader.get_count();
+		for (int j = 0; j < name_count && !r_reader.failed; j++) {
+			names.push_back(r_reader.get_string());
+		}
+#ifdef DEBUG_ENABLED
+		Vector<String> *debug_names[7] = {
+			&function->operator_names,
+			&function->setter_names,
+			&function->getter_names,
+			&function->builtin_methods_names,
+			&function->constructors_names,
+			&function->utilities_names,
+			&function->gds_utilities_names,
+		};
+		*debug_names[i] = names;
+#endif
+	}
+
+	if (r_reader.failed) {
+		memdelete(function);
+		return nullptr;
+	}
+
+	// Same as `GDScriptByteCodeGenerator::write_end()`.
+	function->_code_size = function->code.size();
+	function->_code_ptr = function->code.ptrw();
+	function->_default_arg_count = function->default_arguments.is_empty() ? 0 : function->default_arguments.size() - 1;
+	function->_default_arg_ptr = function->default_arguments.ptr();
+	function->_constant_count = function->constants.size();
+	function->_constants_ptr = function->constants.ptrw();
+	function->_global_names_count = function->global_names.size();
+	function->_global_names_ptr = function->global_names.ptr();
+	function->_operator_funcs_count = function->operator_funcs.size();
+	function->_operator_funcs_ptr = function->operator_funcs.ptr();
+	function->_setters_count = function->setters.size();
+	function->_setters_ptr = function->setters.ptr();
+	function->_getters_count = function->getters.size();
+	function->_getters_ptr = function->getters.ptr();
+	function->_keyed_setters_count = function->keyed_setters.size();
+	function->_keyed_setters_ptr = function->keyed_setters.ptr();
+	function->_keyed_getters_count = function->keyed_getters.size();
+	function->_keyed_getters_ptr = function->keyed_getters.ptr();
+	function->_indexed_setters_count = function->indexed_setters.size();
+	function->_indexed_setters_ptr = function->indexed_setters.ptr();
+	function->_indexed_getters_count = function->indexed_getters.size();
+	function->_indexed_getters_ptr = function->indexed_getters.ptr();
+	function->_builtin_methods_count = function->builtin_methods.size();
+	function->_builtin_methods_ptr = function->builtin_methods.ptr();
+	function->_constructors_count = function->constructors.size();
+	function->_constructors_ptr = function->constructors.ptr();
+	function->_utilities_count = function->utilities.size();
+	function->_utilities_ptr = function->utilities.ptr();
+	function->_gds_utilities_count = function->gds_utilities.size();
+	function->_gds_utilities_ptr = function->gds_utilities.ptr();
+	function->_methods_count = function->methods.size();
+	function->_methods_ptr = function->methods.ptrw();
+	function->_lambdas_count = function->lambdas.size();
+	function->_lambdas_ptr = function->lambdas.ptrw();
+
+	return function;
+}
+
+bool GDScriptBytecodeCache::_read_class(Reader &r_reader, GDScript *p_script, GDScript *p_root) {
+	p_script->tool = r_reader.get_bool();
+	p_script->_is_abstract = r_reader.get_bool();
+
+	const int *native_index = GDScriptLanguage::get_singleton()->get_global_map().getptr(r_reader.get_string());
+	if (r_reader.failed || native_index == nullptr) {
+		return false;
+	}
+	p_script->native = GDScriptLanguage::get_singleton()->get_global_array()[*native_index];
+	if (p_script->native.is_null()) {
+		return false;
+	}
+
+	if (r_reader.get_bool()) {
+		p_script->base = _read_value(r_reader, p_root);
+		if (p_script->base.is_null()) {
+			return false;
+		}
+	}
+
+	const int member_count = r_reader.get_count();
+	for (int i = 0; i < member_count && !r_reader.failed; i++) {
+		const StringName name = r_reader.get_string();
+		GDScript::MemberInfo info;
+		if (_read_member_info(r_reader, info, p_root)) {
+			p_script->member_indices.insert(name, info);
+		}
+	}
+	const int own_member_count = r_reader.get_count();
+	for (int i = 0; i < own_member_count && !r_reader.failed; i++) {
+		p_script->members.insert(r_reader.get_string());
+	}
+	const int static_variable_count = r_reader.get_count();
+	for (int i = 0; i < static_variable_count && !r_reader.failed; i++) {
+		const StringName name = r_reader.get_string();
+		GDScript::MemberInfo info;
+		if (_read_member_info(r_reader, info, p_root)) {
+			p_script->static_variables_indices.insert(name, info);
+		}
+	}
+	p_script->static_variables.resize(p_script->static_variables_indices.size());
+
+	const int constant_count = r_reader.get_count();
+	for (int i = 0; i < constant_count && !r_reader.failed; i++) {
+		const StringName name = r_reader.get_string();
+		p_script->constants.insert(name, _read_value(r_reader, p_root));
+	}
+	const int signal_count = r_reader.get_count();
+	for (int i = 0; i < signal_count && !r_reader.failed; i++) {
+		const StringName name = r_reader.get_string();
+		p_script->_signals.insert(name, _read_method_info(r_reader, p_root));
+	}
+	p_script->rpc_config = _read_value(r_reader, p_root);
+
+	const int function_count = r_reader.get_count();
+	for (int i = 0; i < function_count && !r_reader.failed; i++) {
+		const StringName name = r_reader.get_string();
+		GDScriptFunction *function = _read_function(r_reader, p_script, p_root);
+		if (function == nullptr) {
+			return false;
+		}
+		p_script->member_functions.insert(name, function);
+	}
+	if (r_reader.failed) {
+		return false;
+	}
+	if (HashMap<StringName, GDScriptFunction *>::Iterator E = p_script->member_functions.find(GDScriptLanguage::get_singleton()->strings._init)) {
+		p_script->initializer = E->value;
+	}
+
+	GDScriptFunction **special_functions[3] = { &p_script->implicit_initializer, &p_script->implicit_ready, &p_script->static_initializer };
+	for (GDScriptFunction **special_function : special_functions) {
+		if (r_reader.get_bool()) {
+			*special_function = _read_function(r_reader, p_script, p_root);
+			if (*special_function == nullptr) {
+				return false;
+			}
+		}
+	}
+	if (r_reader.failed) {
+		return false;
+	}
+
+	for (KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		if (!_read_class(r_reader, E.value.ptr(), p_root)) {
+			return false;
+		}
+	}
+
+	p_script->_static_default_init();
+
+	p_script->valid = true;
+	return true;
+}
+
+void GDScriptBytecodeCache::_invalidate(GDScript *p_script) {
+	p_script->valid = false;
+	for (KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		_invalidate(E.value.ptr());
+	}
+}
+
+String GDScriptBytecodeCache::get_cache_path(const String &p_script_path) {
+	return p_script_path.get_basename() + ".gdbc";
+}
+
+bool GDScriptBytecodeCache::is_up_to_date(const Vector<uint8_t> &p_buffer, uint32_t p_source_hash) {
+	Reader reader(p_buffer);
+	uint32_t flags = 0;
+	uint32_t source_hash = 0;
+	HashMap<String, uint32_t> dependencies;
+	if (!_read_header(reader, flags, source_hash, dependencies) || source_hash != p_source_hash) {
+		return false;
+	}
+
+	// Constants, member indices and types of other scripts are baked in, so they must be unchanged too.
+	for (const KeyValue<String, uint32_t> &E : dependencies) {
+		if (GDScriptCache::get_source_hash(E.key) != E.value) {
+			return false;
+		}
+	}
+	return true;
+}
+
+Error GDScriptBytecodeCache::make_scripts(GDScript *p_script, const Vector<uint8_t> &p_buffer) {
+	Reader reader(p_buffer);
+	uint32_t flags = 0;
+	uint32_t source_hash = 0;
+	HashMap<String, uint32_t> dependencies;
+	if (!_read_header(reader, flags, source_hash, dependencies)) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	const String fully_qualified_name = reader.get_string();
+	const StringName local_name = reader.get_string();
+	if (reader.failed) {
+		return ERR_FILE_CORRUPT;
+	}
+	_make_scripts(reader, p_script, fully_qualified_name, local_name);
+	return reader.failed ? ERR_FILE_CORRUPT : OK;
+}
+
+Error GDScriptBytecodeCache::load(GDScript *p_script, const Vector<uint8_t> &p_buffer) {
+	Reader reader(p_buffer);
+	uint32_t flags = 0;
+	uint32_t source_hash = 0;
+	HashMap<String, uint32_t> dependencies;
+	if (!_read_header(reader, flags, source_hash, dependencies)) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	const String fully_qualified_name = reader.get_string();
+	const StringName local_name = reader.get_string();
+	if (reader.failed || fully_qualified_name != p_script->fully_qualified_name || local_name != p_script->local_name || !_check_class_tree(reader, p_script)) {
+		return ERR_FILE_CORRUPT;
+	}
+
+	p_script->_owner = nullptr;
+	if (!_read_class(reader, p_script, p_script)) {
+		// What was read stays until `GDScriptCompiler` clears it, like after a failed compilation.
+		_invalidate(p_script);
+		return ERR_FILE_CORRUPT;
+	}
+
+	if (flags & BYTECODE_FLAG_KEEP_STATIC_DATA) {
+		GDScriptCache::add_static_script(p_script);
+	}
+	return OK;
+}
+
+#ifdef TOOLS_ENABLED
+
+class GDScriptBytecodeCache::Writer {
+public:
+	Vector<uint8_t> data;
+
+	void put_data(const uint8_t *p_data, int p_size) {
+		const int offset = data.size();
+		data.resize(offset + p_size);
+		memcpy(data.ptrw() + offset, p_data, p_size);
+	}
+
+	void put_u8(uint8_t p_value) {
+		data.push_back(p_value);
+	}
+
+	void put_bool(bool p_value) {
+		put_u8(p_value ? 1 : 0);
+	}
+
+	void put_u32(uint32_t p_value) {
+		uint8_t buffer[4];
+		encode_uint32(p_value, buffer);
+		put_data(buffer, 4);
+	}
+
+	void put_32(int32_t p_value) {
+		put_u32((uint32_t)p_value);
+	}
+
+	void put_string(const String &p_string) {
+		const CharString utf8 = p_string.utf8();
+		put_u32(utf8.length());
+		put_data((const uint8_t *)utf8.get_data(), utf8.length());
+	}
+
+	bool put_var(const Variant &p_value) {
+		int length = 0;
+		if (encode_variant(p_value, nullptr, length) != OK) {
+			return false;
+		}
+		put_u32(length);
+		const int offset = data.size();
+		data.resize(offset + length);
+		return encode_variant(p_value, data.ptrw() + offset, length) == OK;
+	}
+};
+
+struct GDScriptBytecodeCache::ExportContext {
+	String path;
+	HashSet<String> dependencies;
+	String error; // Why the script can't be exported as bytecode.
+};
+
+// Reverse lookup of the native function pointers used by bytecode, built once per editor run.
+struct GDScriptBytecodeExportLookup {
+	struct Operator {
+		Variant::Operator op = Variant::OP_MAX;
+		Variant::Type type_a = Variant::NIL;
+		Variant::Type type_b = Variant::NIL;
+	};
+
+	RBMap<Variant::ValidatedOperatorEvaluator, Operator> operators;
+	RBMap<Variant::ValidatedSetter, Pair<Variant::Type, StringName>> setters;
+	RBMap<Variant::ValidatedGetter, Pair<Variant::Type, StringName>> getters;
+	RBMap<Variant::ValidatedKeyedSetter, Variant::Type> keyed_setters;
+	RBMap<Variant::ValidatedKeyedGetter, Variant::Type> keyed_getters;
+	RBMap<Variant::ValidatedIndexedSetter, Variant::Type> indexed_setters;
+	RBMap<Variant::ValidatedIndexedGetter, Variant::Type> indexed_getters;
+	RBMap<Variant::ValidatedBuiltInMethod, Pair<Variant::Type, StringName>> builtin_methods;
+	RBMap<Variant::ValidatedConstructor, Pair<Variant::Type, int>> constructors;
+	RBMap<Variant::ValidatedUtilityFunction, StringName> utilities;
+	RBMap<GDScriptUtilityFunctions::FunctionPtr, StringName> gds_utilities;
+
+	GDScriptBytecodeExportLookup() {
+		for (int type = 0; type < Variant::VARIANT_MAX; type++) {
+			const Variant::Type variant_type = Variant::Type(type);
+
+			for (int op = 0; op < Variant::OP_MAX; op++) {
+				for (int type_b = 0; type_b < Variant::VARIANT_MAX; type_b++) {
+					Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::Operator(op), variant_type, Variant::Type(type_b));
+					if (evaluator != nullptr && !operators.has(evaluator)) {
+						operators.insert(evaluator, { Variant::Operator(op), variant_type, Variant::Type(type_b) });
+					}
+				}
+			}
+
+			List<StringName> members;
+			Variant::get_member_list(variant_type, &members);
+			for (const StringName &member : members) {
+				if (Variant::ValidatedSetter setter = Variant::get_member_validated_setter(variant_type, member)) {
+					setters.insert(setter, Pair(variant_type, member));
+				}
+				if (Variant::ValidatedGetter getter = Variant::get_member_validated_getter(variant_type, member)) {
+					getters.insert(getter, Pair(variant_type, member));
+				}
+			}
+
+			if (Variant::ValidatedKeyedSetter setter = Variant::get_member_validated_keyed_setter(variant_type)) {
+				keyed_setters.insert(setter, variant_type);
+			}
+			if (Variant::ValidatedKeyedGetter getter = Variant::get_member_validated_keyed_getter(variant_type)) {
+				keyed_getters.insert(getter, variant_type);
+			}
+			if (Variant::ValidatedIndexedSetter setter = Variant::get_member_validated_indexed_setter(variant_type)) {
+				indexed_setters.insert(setter, variant_type);
+			}
+			if (Variant::ValidatedIndexedGetter getter = Variant::get_member_validated_indexed_getter(variant_type)) {
+				indexed_getters.insert(getter, variant_type);
+			}
+
+			List<StringName> methods;
+			Variant::get_builtin_method_list(variant_type, &methods);
+			for (const StringName &method : methods) {
+				if (Variant::ValidatedBuiltInMethod validated = Variant::get_validated_builtin_method(variant_type, method)) {
+					builtin_methods.insert(validated, Pair(variant_type, method));
+				}
+			}
+
+			for (int i = 0; i < Variant::get_constructor_count(variant_type); i++) {
+				if (Variant::ValidatedConstructor constructor = Variant::get_validated_constructor(variant_type, i)) {
+					constructors.insert(constructor, Pair(variant_type, i));
+				}
+			}
+		}
+
+		List<StringName> utility_names;
+		Variant::get_utility_function_list(&utility_names);
+		for (const StringName &name : utility_names) {
+			if (Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(name)) {
+				utilities.insert(utility, name);
+			}
+		}
+
+		List<StringName> gds_utility_names;
+		GDScriptUtilityFunctions::get_function_list(&gds_utility_names);
+		for (const StringName &name : gds_utility_names) {
+			gds_utilities.insert(GDScriptUtilityFunctions::get_function(name), name);
+		}
+	}
+};
+
+template <typename K, typename V>
+static const V *_find_export_lookup(const RBMap<K, V> &p_map, const K &p_key) {
+	const typename RBMap<K, V>::Element *E = p_map.find(p_key);
+	return E ? &E->value() : nullptr;
+}
+
+static const GDScriptBytecodeExportLookup &_get_export_lookup() {
+	static const GDScriptBytecodeExportLookup lookup;
+	return lookup;
+}
+
+uint32_t GDScriptBytecodeCache::_get_export_source_hash(const String &p_path, ExportOptions &r_options) {
+	if (const uint32_t *hash = r_options.source_hashes.getptr(p_path)) {
+		return *hash;
+	}
+
+	// Must match what `GDScriptCache::get_source_hash()` computes from the exported file.
+	const String source = GDScriptCache::get_source_code(p_path);
+	uint32_t hash;
+	if (r_options.binary_tokens) {
+		const Vector<uint8_t> tokens = GDScriptTokenizerBuffer::parse_code_string(source, r_options.compress_binary_tokens ? GDScriptTokenizerBuffer::COMPRESS_ZSTD : GDScriptTokenizerBuffer::COMPRESS_NONE);
+		hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+	} else {
+		hash = source.hash();
+	}
+	r_options.source_hashes[p_path] = hash;
+	return hash;
+}
+
+bool GDScriptBytecodeCache::_write_value(Writer &r_writer, const Variant &p_value, ExportContext &r_context) {
+	switch (p_value.get_type()) {
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			r_writer.put_u8(BYTECODE_VALUE_ARRAY);
+			r_writer.put_bool(array.is_read_only());
+			r_writer.put_u32(array.get_typed_builtin());
+			r_writer.put_string(array.get_typed_class_name());
+			if (!_write_value(r_writer, array.get_typed_script(), r_context)) {
+				return false;
+			}
+			r_writer.put_u32(array.size());
+			for (int i = 0; i < array.size(); i++) {
+				if (!_write_value(r_writer, array[i], r_context)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case Variant::DICTIONARY: {
+			const Dictionary dictionary = p_value;
+			r_writer.put_u8(BYTECODE_VALUE_DICTIONARY);
+			r_writer.put_bool(dictionary.is_read_only());
+			r_writer.put_u32(dictionary.get_typed_key_builtin());
+			r_writer.put_string(dictionary.get_typed_key_class_name());
+			if (!_write_value(r_writer, dictionary.get_typed_key_script(), r_context)) {
+				return false;
+			}
+			r_writer.put_u32(dictionary.get_typed_value_builtin());
+			r_writer.put_string(dictionary.get_typed_value_class_name());
+			if (!_write_value(r_writer, dictionary.get_typed_value_script(), r_context)) {
+				return false;
+			}
+			const Array keys = dictionary.keys();
+			r_writer.put_u32(keys.size());
+			for (int i = 0; i < keys.size(); i++) {
+				if (!_write_value(r_writer, keys[i], r_context) || !_write_value(r_writer, dictionary[keys[i]], r_context)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case Variant::OBJECT: {
+			Object *object = p_value.get_validated_object();
+			if (object == nullptr) {
+				r_writer.put_u8(BYTECODE_VALUE_NULL_OBJECT);
+				return true;
+			}
+
+			if (GDScript *script = Object::cast_to<GDScript>(object)) {
+				if (script->path.is_empty() || script->path.contains("::")) {
+					r_context.error = "refers to a built-in script.";
+					return false;
+				}
+				r_writer.put_u8(BYTECODE_VALUE_SCRIPT_CLASS);
+				r_writer.put_string(script->path);
+				r_writer.put_string(script->fully_qualified_name);
+				if (script->path != r_context.path) {
+					r_context.dependencies.insert(script->path);
+				}
+				return true;
+			}
+
+			if (GDScriptNativeClass *native = Object::cast_to<GDScriptNativeClass>(object)) {
+				r_writer.put_u8(BYTECODE_VALUE_NATIVE_CLASS);
+				r_writer.put_string(native->get_name());
+				return true;
+			}
+
+			List<Engine::Singleton> singletons;
+			Engine::get_singleton()->get_singletons(&singletons);
+			for (const Engine::Singleton &singleton : singletons) {
+				if (singleton.ptr == object && !singleton.editor_only) {
+					r_writer.put_u8(BYTECODE_VALUE_SINGLETON);
+					r_writer.put_string(singleton.name);
+					return true;
+				}
+			}
+
+			Resource *resource = Object::cast_to<Resource>(object);
+			if (resource != nullptr && !resource->is_built_in()) {
+				r_writer.put_u8(BYTECODE_VALUE_RESOURCE);
+				r_writer.put_string(resource->get_path());
+				return true;
+			}
+
+			r_context.error = vformat(R"(has a constant of class "%s", which can't be saved.)", object->get_class());
+			return false;
+		}
+		case Variant::CALLABLE:
+		case Variant::SIGNAL:
+		case Variant::RID: {
+			r_context.error = vformat(R"(has a constant of type "%s", which can't be saved.)", Variant::get_type_name(p_value.get_type()));
+			return false;
+		}
+		default: {
+			r_writer.put_u8(BYTECODE_VALUE_PLAIN);
+			return r_writer.put_var(p_value);
+		}
+	}
+}
+
+bool GDScriptBytecodeCache::_write_data_type(Writer &r_writer, const GDScriptDataType &p_type, ExportContext &r_context) {
+	r_writer.put_u8(p_type.kind);
+	r_writer.put_u32(p_type.builtin_type);
+	r_writer.put_string(p_type.native_type);
+	if (p_type.kind == GDScriptDataType::SCRIPT || p_type.kind == GDScriptDataType::GDSCRIPT) {
+		if (p_type.script_type == nullptr || !_write_value(r_writer, Variant(p_type.script_type), r_context)) {
+			return false;
+		}
+	}
+
+	r_writer.put_u32(p_type.container_element_types.size());
+	for (const GDScriptDataType &E : p_type.container_element_types) {
+		if (!_write_data_type(r_writer, E, r_context)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void GDScriptBytecodeCache::_write_property_info(Writer &r_writer, const PropertyInfo &p_info) {
+	r_writer.put_u32(p_info.type);
+	r_writer.put_string(p_info.name);
+	r_writer.put_string(p_info.class_name);
+	r_writer.put_u32(p_info.hint);
+	r_writer.put_string(p_info.hint_string);
+	r_writer.put_u32(p_info.usage);
+}
+
+bool GDScriptBytecodeCache::_write_method_info(Writer &r_writer, const MethodInfo &p_info, ExportContext &r_context) {
+	r_writer.put_string(p_info.name);
+	_write_property_info(r_writer, p_info.return_val);
+	r_writer.put_u32(p_info.flags);
+	r_writer.put_32(p_info.id);
+
+	r_writer.put_u32(p_info.arguments.size());
+	for (const PropertyInfo &E : p_info.arguments) {
+		_write_property_info(r_writer, E);
+	}
+	r_writer.put_u32(p_info.default_arguments.size());
+	for (const Variant &E : p_info.default_arguments) {
+		if (!_write_value(r_writer, E, r_context)) {
+			return false;
+		}
+	}
+
+	r_writer.put_32(p_info.return_val_metadata);
+	r_writer.put_u32(p_info.arguments_metadata.size());
+	for (int E : p_info.arguments_metadata) {
+		r_writer.put_32(E);
+	}
+	return true;
+}
+
+bool GDScriptBytecodeCache::_write_member_info(Writer &r_writer, const GDScript::MemberInfo &p_info, ExportContext &r_context) {
+	r_writer.put_32(p_info.index);
+	r_writer.put_string(p_info.setter);
+	r_writer.put_string(p_info.getter);
+	if (!_write_data_type(r_writer, p_info.data_type, r_context)) {
+		return false;
+	}
+	_write_property_info(r_writer, p_info.property_info);
+	return true;
+}
+
+bool GDScriptBytecodeCache::_write_function(Writer &r_writer, const GDScriptFunction *p_function, ExportContext &r_context) {
+	const GDScriptBytecodeExportLookup &lookup = _get_export_lookup();
+
+	r_writer.put_string(p_function->name);
+	r_writer.put_bool(p_function->_static);
+	r_writer.put_u32(p_function->argument_types.size());
+	for (const GDScriptDataType &E : p_function->argument_types) {
+		if (!_write_data_type(r_writer, E, r_context)) {
+			return false;
+		}
+	}
+	if (!_write_data_type(r_writer, p_function->return_type, r_context) ||
+			!_write_method_info(r_writer, p_function->method_info, r_context) ||
+			!_write_value(r_writer, p_function->rpc_config, r_context)) {
+		return false;
+	}
+
+	r_writer.put_32(p_function->_initial_line);
+	r_writer.put_32(p_function->_argument_count);
+	r_writer.put_32(p_function->_vararg_index);
+	r_writer.put_32(p_function->_stack_size);
+	r_writer.put_32(p_function->_instruction_args_size);
+
+	r_writer.put_u32(p_function->temporary_slots.size());
+	for (const Pair<int, Variant::Type> &E : p_function->temporary_slots) {
+		r_writer.put_32(E.first);
+		r_writer.put_u32(E.second);
+	}
+
+	r_writer.put_u32(p_function->code.size());
+	for (int E : p_function->code) {
+		r_writer.put_32(E);
+	}
+	r_writer.put_u32(p_function->default_arguments.size());
+	for (int E : p_function->default_arguments) {
+		r_writer.put_32(E);
+	}
+
+	r_writer.put_u32(p_function->constants.size());
+	for (const Variant &E : p_function->constants) {
+		if (!_write_value(r_writer, E, r_context)) {
+			return false;
+		}
+	}
+	r_writer.put_u32(p_function->constant_map.size());
+	for (const KeyValue<StringName, Variant> &E : p_function->constant_map) {
+		r_writer.put_string(E.key);
+		if (!_write_value(r_writer, E.value, r_context)) {
+			return false;
+		}
+	}
+	r_writer.put_u32(p_function->global_names.size());
+	for (const StringName &E : p_function->global_names) {
+		r_writer.put_string(E);
+	}
+
+	r_writer.put_u32(p_function->operator_funcs.size());
+	for (Variant::ValidatedOperatorEvaluator E : p_function->operator_funcs) {
+		const GDScriptBytecodeExportLookup::Operator *op = _find_export_lookup(lookup.operators, E);
+		ERR_FAIL_NULL_V(op, false);
+		r_writer.put_u32(op->op);
+		r_writer.put_u32(op->type_a);
+		r_writer.put_u32(op->type_b);
+	}
+	r_writer.put_u32(p_function->setters.size());
+	for (Variant::ValidatedSetter E : p_function->setters) {
+		const Pair<Variant::Type, StringName> *setter = _find_export_lookup(lookup.setters, E);
+		ERR_FAIL_NULL_V(setter, false);
+		r_writer.put_u32(setter->first);
+		r_writer.put_string(setter->second);
+	}
+	r_writer.put_u32(p_function->getters.size());
+	for (Variant::ValidatedGetter E : p_function->getters) {
+		const Pair<Variant::Type, StringName> *getter = _find_export_lookup(lookup.getters, E);
+		ERR_FAIL_NULL_V(getter, false);
+		r_writer.put_u32(getter->first);
+		r_writer.put_string(getter->second);
+	}
+	r_writer.put_u32(p_function->keyed_setters.size());
+	for (Variant::ValidatedKeyedSetter E : p_function->keyed_setters) {
+		const Variant::Type *type = _find_export_lookup(lookup.keyed_setters, E);
+		ERR_FAIL_NULL_V(type, false);
+		r_writer.put_u32(*type);
+	}
+	r_writer.put_u32(p_function->keyed_getters.size());
+	for (Variant::ValidatedKeyedGetter E : p_function->keyed_getters) {
+		const Variant::Type *type = _find_export_lookup(lookup.keyed_getters, E);
+		ERR_FAIL_NULL_V(type, false);
+		r_writer.put_u32(*type);
+	}
+	r_writer.put_u32(p_function->indexed_setters.size());
+	for (Variant::ValidatedIndexedSetter E : p_function->indexed_setters) {
+		const Variant::Type *type = _find_export_lookup(lookup.indexed_setters, E);
+		ERR_FAIL_NULL_V(type, false);
+		r_writer.put_u32(*type);
+	}
+	r_writer.put_u32(p_function->indexed_getters.size());
+	for (Variant::ValidatedIndexedGetter E : p_function->indexed_getters) {
+		const Variant::Type *type = _find_export_lookup(lookup.indexed_getters, E);
+		ERR_FAIL_NULL_V(type, false);
+		r_writer.put_u32(*type);
+	}
+	r_writer.put_u32(p_function->builtin_methods.size());
+	for (Variant::ValidatedBuiltInMethod E : p_function->builtin_methods) {
+		const Pair<Variant::Type, StringName> *method = _find_export_lookup(lookup.builtin_methods, E);
+		ERR_FAIL_NULL_V(method, false);
+		r_writer.put_u32(method->first);
+		r_writer.put_string(method->second);
+	}
+	r_writer.put_u32(p_function->constructors.size());
+	for (Variant::ValidatedConstructor E : p_function->constructors) {
+		const Pair<Variant::Type, int> *constructor = _find_export_lookup(lookup.constructors, E);
+		ERR_FAIL_NULL_V(constructor, false);
+		r_writer.put_u32(constructor->first);
+		r_writer.put_32(constructor->second);
+	}
+	r_writer.put_u32(p_function->utilities.size());
+	for (Variant::ValidatedUtilityFunction E : p_function->utilities) {
+		const StringName *name = _find_export_lookup(lookup.utilities, E);
+		ERR_FAIL_NULL_V(name, false);
+		r_writer.put_string(*name);
+	}
+	r_writer.put_u32(p_function->gds_utilities.size());
+	for (GDScriptUtilityFunctions::FunctionPtr E : p_function->gds_utilities) {
+		const StringName *name = _find_export_lookup(lookup.gds_utilities, E);
+		ERR_FAIL_NULL_V(name, false);
+		r_writer.put_string(*name);
+	}
+	r_writer.put_u32(p_function->methods.size());
+	for (MethodBind *E : p_function->methods) {
+		// Looked up by name when loading, which must find this same method.
+		ERR_FAIL_COND_V(ClassDB::get_method(E->get_instance_class(), E->get_name()) != E, false);
+		r_writer.put_string(E->get_instance_class());
+		r_writer.put_string(E->get_name());
+	}
+	r_writer.put_u32(p_function->lambdas.size());
+	for (const GDScriptFunction *E : p_function->lambdas) {
+		const GDScript::LambdaInfo *info = E->_script->lambda_info.getptr(const_cast<GDScriptFunction *>(E));
+		ERR_FAIL_NULL_V(info, false);
+		ERR_FAIL_COND_V(E->_script != p_function->_script, false);
+		r_writer.put_32(info->capture_count);
+		r_writer.put_bool(info->use_self);
+		if (!_write_function(r_writer, E, r_context)) {
+			return false;
+		}
+	}
+
+	// The editor is always a debug build.
+	const Vector<String> *debug_names[7] = {
+		&p_function->operator_names,
+		&p_function->setter_names,
+		&p_function->getter_names,
+		&p_function->builtin_methods_names,
+		&p_function->constructors_names,
+		&p_function->utilities_names,
+		&p_function->gds_utilities_names,
+	};
+	for (const Vector<String> *names : debug_names) {
+		r_writer.put_u32(names->size());
+		for (const String &E : *names) {
+			r_writer.put_string(E);
+		}
+	}
+	return true;
+}
+
+void GDScriptBytecodeCache::_write_class_tree(Writer &r_writer, const GDScript *p_script) {
+	r_writer.put_string(p_script->global_name);
+	r_writer.put_string(p_script->simplified_icon_path);
+	r_writer.put_u32(p_script->subclasses.size());
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		r_writer.put_string(E.key);
+		r_writer.put_string(E.value->fully_qualified_name);
+		_write_class_tree(r_writer, E.value.ptr());
+	}
+}
+
+bool GDScriptBytecodeCache::_write_class(Writer &r_writer, const GDScript *p_script, ExportContext &r_context) {
+	r_writer.put_bool(p_script->tool);
+	r_writer.put_bool(p_script->_is_abstract);
+	ERR_FAIL_COND_V(p_script->native.is_null(), false);
+	r_writer.put_string(p_script->native->get_name());
+	r_writer.put_bool(p_script->base.is_valid());
+	if (p_script->base.is_valid() && !_write_value(r_writer, p_script->base, r_context)) {
+		return false;
+	}
+
+	r_writer.put_u32(p_script->member_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->member_indices) {
+		r_writer.put_string(E.key);
+		if (!_write_member_info(r_writer, E.value, r_context)) {
+			return false;
+		}
+	}
+	r_writer.put_u32(p_script->members.size());
+	for (const StringName &E : p_script->members) {
+		r_writer.put_string(E);
+	}
+	r_writer.put_u32(p_script->static_variables_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->static_variables_indices) {
+		r_writer.put_string(E.key);
+		if (!_write_member_info(r_writer, E.value, r_context)) {
+			return false;
+		}
+	}
+
+	r_writer.put_u32(p_script->constants.size());
+	for (const KeyValue<StringName, Variant> &E : p_script->constants) {
+		r_writer.put_string(E.key);
+		if (!_write_value(r_writer, E.value, r_context)) {
+			return false;
+		}
+	}
+	r_writer.put_u32(p_script->_signals.size());
+	for (const KeyValue<StringName, MethodInfo> &E : p_script->_signals) {
+		r_writer.put_string(E.key);
+		if (!_write_method_info(r_writer, E.value, r_context)) {
+			return false;
+		}
+	}
+	if (!_write_value(r_writer, p_script->rpc_config, r_context)) {
+		return false;
+	}
+
+	r_writer.put_u32(p_script->member_functions.size());
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+		r_writer.put_string(E.key);
+		if (!_write_function(r_writer, E.value, r_context)) {
+			return false;
+		}
+	}
+
+	const GDScriptFunction *special_functions[3] = { p_script->implicit_initializer, p_script->implicit_ready, p_script->static_initializer };
+	for (const GDScriptFunction *special_function : special_functions) {
+		r_writer.put_bool(special_function != nullptr);
+		if (special_function != nullptr && !_write_function(r_writer, special_function, r_context)) {
+			return false;
+		}
+	}
+
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		if (!_write_class(r_writer, E.value.ptr(), r_context)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool GDScriptBytecodeCache::_has_static_data(const GDScript *p_script) {
+	if (p_script->static_initializer != nullptr) {
+		return true;
+	}
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		if (_has_static_data(E.value.ptr())) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void _collect_classes(const Ref<GDScript> &p_script, Vector<Ref<GDScript>> &r_classes) {
+	r_classes.push_back(p_script);
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->get_subclasses()) {
+		_collect_classes(E.value, r_classes);
+	}
+}
+
+void GDScriptBytecodeCache::_clear_detached(GDScript *p_script) {
+	// Unlink the inner classes first, so clearing doesn't hand them over as orphans to the editor's copy of the script.
+	Vector<Ref<GDScript>> classes;
+	_collect_classes(Ref<GDScript>(p_script), classes);
+	for (Ref<GDScript> &E : classes) {
+		E->subclasses.clear();
+		E->_owner = nullptr;
+	}
+	for (Ref<GDScript> &E : classes) {
+		E->clear();
+	}
+}
+
+Error GDScriptBytecodeCache::export_script(const String &p_path, ExportOptions &r_options, Vector<uint8_t> &r_buffer) {
+	const String source = GDScriptCache::get_source_code(p_path);
+
+	GDScriptParser parser;
+	Error err = parser.parse(source, p_path, false);
+	if (err == OK) {
+		GDScriptAnalyzer analyzer(&parser);
+		err = analyzer.analyze();
+	}
+	if (err) {
+		print_verbose(vformat(R"(GDScript: Not exporting bytecode of "%s", it has errors.)", p_path));
+		return err;
+	}
+
+	// Compiled apart from the editor's copy of the script, which must stay as it is.
+	Ref<GDScript> script;
+	script.instantiate();
+	script->path = p_path;
+
+	GDScriptCompiler compiler;
+	compiler.set_for_export(r_options.debug);
+	err = compiler.compile(&parser, script.ptr());
+	if (err) {
+		print_verbose(vformat(R"(GDScript: Not exporting bytecode of "%s": %s)", p_path, compiler.get_error()));
+		_clear_detached(script.ptr());
+		return err;
+	}
+
+	ExportContext context;
+	context.path = p_path;
+
+	Writer body;
+	body.put_string(script->fully_qualified_name);
+	body.put_string(script->local_name);
+	_write_class_tree(body, script.ptr());
+	const bool written = _write_class(body, script.ptr(), context);
+	const bool keep_static_data = _has_static_data(script.ptr()) && !parser.get_tree()->annotated_static_unload;
+	_clear_detached(script.ptr());
+
+	if (!written) {
+		print_verbose(vformat(R"(GDScript: Not exporting bytecode of "%s", it %s)", p_path, context.error.is_empty() ? "uses a native function that can't be saved." : context.error));
+		return ERR_UNAVAILABLE;
+	}
+
+	// Anything the analyzer resolved through other scripts may be baked in, and so may what they resolved in turn.
+	List<GDScriptParser *> pending_parsers;
+	pending_parsers.push_back(&parser);
+	while (!pending_parsers.is_empty()) {
+		GDScriptParser *depending_parser = pending_parsers.front()->get();
+		pending_parsers.pop_front();
+		for (const KeyValue<String, Ref<GDScriptParserRef>> &E : depending_parser->get_depended_parsers()) {
+			if (context.dependencies.has(E.key)) {
+				continue;
+			}
+			context.dependencies.insert(E.key);
+			if (E.value.is_valid() && E.value->get_status() != GDScriptParserRef::EMPTY) {
+				pending_parsers.push_back(E.value->get_parser());
+			}
+		}
+	}
+	context.dependencies.erase(p_path);
+
+	Writer header;
+	header.put_data(BYTECODE_MAGIC, 4);
+	header.put_u32(FORMAT_VERSION);
+	header.put_string(GODOT_VERSION_FULL_CONFIG);
+	header.put_string(GODOT_VERSION_HASH);
+	header.put_u32((r_options.debug ? BYTECODE_FLAG_DEBUG : 0) | (keep_static_data ? BYTECODE_FLAG_KEEP_STATIC_DATA : 0));
+	header.put_u32(_get_export_source_hash(p_path, r_options));
+	header.put_u32(context.dependencies.size());
+	for (const String &E : context.dependencies) {
+		header.put_string(E);
+		header.put_u32(_get_export_source_hash(E, r_options));
+	}
+
+	r_buffer = header.data;
+	r_buffer.append_array(body.data);
+	return OK;
+}
+
+#endif // TOOLS_ENABLED
@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "gdscript.h"
+
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+
+// Compiled GDScript serialized at export time. When the script and all the scripts it
+// depends on still hash to what was exported, GDScriptCache loads it in place of parsing,
+// analyzing and compiling the source. Any mismatch falls back to a regular compilation.
+class GDScriptBytecodeCache {
+public:
+	static constexpr uint32_t FORMAT_VERSION = 1;
+
+#ifdef TOOLS_ENABLED
+	struct ExportOptions {
+		bool debug = false; // Keep `assert()` and `breakpoint`, like debug builds do.
+		bool binary_tokens = false; // Scripts are exported as `.gdc`, so their hashes are computed from the tokens.
+		bool compress_binary_tokens = false;
+		HashMap<String, uint32_t> source_hashes; // Hashes of scripts as exported, filled on demand.
+	};
+#endif
+
+private:
+	class Reader;
+#ifdef TOOLS_ENABLED
+	class Writer;
+	struct ExportContext;
+#endif
+
+	static bool _read_header(Reader &r_reader, uint32_t &r_flags, uint32_t &r_source_hash, HashMap<String, uint32_t> &r_dependencies);
+	static void _make_scripts(Reader &r_reader, GDScript *p_script, const String &p_fully_qualified_name, const StringName &p_local_name);
+	static bool _check_class_tree(Reader &r_reader, GDScript *p_script);
+	static Ref<GDScript> _resolve_script(const String &p_path, const String &p_fully_qualified_name, GDScript *p_root);
+	static Variant _read_value(Reader &r_reader, GDScript *p_root);
+	static GDScriptDataType _read_data_type(Reader &r_reader, GDScript *p_root);
+	static PropertyInfo _read_property_info(Reader &r_reader);
+	static MethodInfo _read_method_info(Reader &r_reader, GDScript *p_root);
+	static bool _read_member_info(Reader &r_reader, GDScript::MemberInfo &r_info, GDScript *p_root);
+	static GDScriptFunction *_read_function(Reader &r_reader, GDScript *p_script, GDScript *p_root);
+	static bool _read_class(Reader &r_reader, GDScript *p_script, GDScript *p_root);
+	static void _invalidate(GDScript *p_script);
+
+#ifdef TOOLS_ENABLED
+	static uint32_t _get_export_source_hash(const String &p_path, ExportOptions &r_options);
+	static bool _write_value(Writer &r_writer, const Variant &p_value, ExportContext &r_context);
+	static bool _write_data_type(Writer &r_writer, const GDScriptDataType &p_type, ExportContext &r_context);
+	static void _write_property_info(Writer &r_writer, const PropertyInfo &p_info);
+	static bool _write_method_info(Writer &r_writer, const MethodInfo &p_info, ExportContext &r_context);
+	static bool _write_member_info(Writer &r_writer, const GDScript::MemberInfo &p_info, ExportContext &r_context);
+	static bool _write_function(Writer &r_writer, const GDScriptFunction *p_function, ExportContext &r_context);
+	static void _write_class_tree(Writer &r_writer, const GDScript *p_script);
+	static bool _write_class(Writer &r_writer, const GDScript *p_script, ExportContext &r_context);
+	static bool _has_static_data(const GDScript *p_script);
+	static void _clear_detached(GDScript *p_script);
+#endif
+
+public:
+	static String get_cache_path(const String &p_script_path);
+
+	// Checks the header against this build and the current sources of the script and its dependencies.
+	static bool is_up_to_date(const Vector<uint8_t> &p_buffer, uint32_t p_source_hash);
+	// Creates the inner class scripts, like `GDScriptCompiler::make_scripts()` does from the parse tree.
+	static Error make_scripts(GDScript *p_script, const Vector<uint8_t> &p_buffer);
+	// Fills the classes made by `make_scripts()`, like `GDScriptCompiler::compile()` does.
+	static Error load(GDScript *p_script, const Vector<uint8_t> &p_buffer);
+
+#ifdef TOOLS_ENABLED
+	// Compiles a detached copy of the script for the export target and serializes it.
+	// Returns `ERR_UNAVAILABLE` when the script holds values that can't be serialized.
+	static Error export_script(const String &p_path, ExportOptions &r_options, Vector<uint8_t> &r_buffer);
+#endif
+};
@@ -32,9 +32,12 @@
 
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 
+#include "core/config/engine.h"
+#include "core/debugger/engine_debugger.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/templates/vector.h"
@@ -73,6 +76,7 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 		return OK;
 	}
 
+	raising_status++;
 	while (result == OK && p_new_status > status) {
 		switch (status) {
 			case EMPTY: {
@@ -104,18 +108,41 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				result = get_analyzer()->resolve_body();
 			} break;
 			case FULLY_SOLVED: {
-				return result;
-			}
+				// Nothing left to resolve.
+			} break;
 		}
 	}
+	raising_status--;
 
 	return result;
 }
 
+bool GDScriptParserRef::is_raising_status() const {
+	return raising_status > 0;
+}
+
+void GDScriptParserRef::pin() {
+	pin_count++;
+}
+
+void GDScriptParserRef::unpin() {
+	ERR_FAIL_COND(pin_count == 0);
+	pin_count--;
+	if (pin_count == 0 && clear_pending) {
+		clear_pending = false;
+		clear();
+	}
+}
+
 void GDScriptParserRef::clear() {
 	if (clearing) {
 		return;
 	}
+	if (pin_count > 0) {
+		// The parser tree is still in use, e.g. by a script compiling from it.
+		clear_pending = true;
+		return;
+	}
 	clearing = true;
 
 	GDScriptParser *lparser = parser;
@@ -300,6 +327,42 @@ Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
 	return buffer;
 }
 
+uint32_t GDScriptCache::get_source_hash(const String &p_path) {
+	Ref<GDScript> script = get_cached_script(p_path);
+	if (script.is_valid() && (script->has_source_code() || !script->get_binary_tokens_source().is_empty())) {
+		return script->get_source_hash();
+	}
+
+	const String remapped_path = ResourceLoader::path_remap(p_path);
+	if (!FileAccess::exists(remapped_path)) {
+		return 0;
+	}
+	if (remapped_path.has_extension("gdc")) {
+		Vector<uint8_t> tokens = get_binary_tokens(remapped_path);
+		return hash_djb2_buffer(tokens.ptr(), tokens.size());
+	}
+	return get_source_code(remapped_path).hash();
+}
+
+Vector<uint8_t> GDScriptCache::get_bytecode(const String &p_path, uint32_t p_source_hash) {
+	// The editor and debugged runs compile from source, they need what the exported bytecode leaves out.
+	if (Engine::get_singleton()->is_editor_hint() || EngineDebugger::is_active() || GDScriptLanguage::get_singleton()->should_track_locals()) {
+		return Vector<uint8_t>();
+	}
+
+	const String bytecode_path = GDScriptBytecodeCache::get_cache_path(p_path);
+	if (!FileAccess::exists(bytecode_path)) {
+		return Vector<uint8_t>();
+	}
+
+	Vector<uint8_t> buffer = FileAccess::get_file_as_bytes(bytecode_path);
+	if (!GDScriptBytecodeCache::is_up_to_date(buffer, p_source_hash)) {
+		print_verbose(vformat(R"(GDScript: Exported bytecode of "%s" is out of date, compiling it from source.)", p_path));
+		return Vector<uint8_t>();
+	}
+	return buffer;
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
 	MutexLock lock(singleton->mutex);
 
@@ -333,9 +396,14 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 		return Ref<GDScript>(); // Returns null and does not cache when the script fails to load.
 	}
 
-	Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
-	if (r_error == OK) {
-		GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
+	Vector<uint8_t> bytecode = get_bytecode(p_path, script->get_source_hash());
+	if (!bytecode.is_empty() && GDScriptBytecodeCache::make_scripts(script.ptr(), bytecode) == OK) {
+		script->set_bytecode(bytecode);
+	} else {
+		Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
+		if (r_error == OK) {
+			GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
+		}
 	}
 
 	singleton->shallow_gdscript_cache[p_path] = script;
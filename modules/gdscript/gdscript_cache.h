@@ -61,6 +61,9 @@ private:
 	uint32_t source_hash = 0;
 	bool clearing = false;
 	bool abandoned = false;
+	int raising_status = 0; // Nesting depth of `raise_status()` calls in progress.
+	int pin_count = 0; // While above zero, `clear()` is deferred until the last `unpin()`.
+	bool clear_pending = false;
 
 	friend class GDScriptCache;
 	friend class GDScript;
@@ -72,6 +75,9 @@ public:
 	GDScriptParser *get_parser();
 	GDScriptAnalyzer *get_analyzer();
 	Error raise_status(Status p_new_status);
+	bool is_raising_status() const;
+	void pin();
+	void unpin();
 	void clear();
 
 	GDScriptParserRef() {}
@@ -116,6 +122,8 @@ public:
 	static void remove_parser(const String &p_path);
 	static String get_source_code(const String &p_path);
 	static Vector<uint8_t> get_binary_tokens(const String &p_path);
+	static uint32_t get_source_hash(const String &p_path);
+	static Vector<uint8_t> get_bytecode(const String &p_path, uint32_t p_source_hash);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	/**
 	 * Returns a fully loaded GDScript using an already cached script if one exists.
@@ -2180,6 +2180,9 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::ASSERT: {
 #ifdef DEBUG_ENABLED
+				if (for_export && !export_debug) {
+					break; // Release builds don't evaluate assertions.
+				}
 				const GDScriptParser::AssertNode *as = static_cast<const GDScriptParser::AssertNode *>(s);
 
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, as->condition);
@@ -2207,7 +2210,9 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::BREAKPOINT: {
 #ifdef DEBUG_ENABLED
-				gen->write_breakpoint();
+				if (!for_export || export_debug) {
+					gen->write_breakpoint();
+				}
 #endif
 			} break;
 			case GDScriptParser::Node::VARIABLE: {
@@ -3112,7 +3117,7 @@ void GDScriptCompiler::convert_to_initializer_type(Variant &p_variant, const GDS
 	}
 }
 
-void GDScriptCompiler::make_scripts(GDScript *p_script, const GDScriptParser::ClassNode *p_class, bool p_keep_state) {
+void GDScriptCompiler::make_scripts(GDScript *p_script, const GDScriptParser::ClassNode *p_class, bool p_keep_state, bool p_reuse_orphans) {
 	p_script->fully_qualified_name = p_class->fqcn;
 	p_script->local_name = p_class->identifier ? p_class->identifier->name : StringName();
 	p_script->global_name = p_class->get_global_name();
@@ -3137,7 +3142,7 @@ void GDScriptCompiler::make_scripts(GDScript *p_script, const GDScriptParser::Cl
 
 		if (old_subclasses.has(name)) {
 			subclass = old_subclasses[name];
-		} else {
+		} else if (p_reuse_orphans) {
 			subclass = GDScriptLanguage::get_singleton()->get_orphan_subclass(inner_class->fqcn);
 		}
 
@@ -3149,7 +3154,7 @@ void GDScriptCompiler::make_scripts(GDScript *p_script, const GDScriptParser::Cl
 		subclass->path = p_script->path;
 		p_script->subclasses.insert(name, subclass);
 
-		make_scripts(subclass.ptr(), inner_class, p_keep_state);
+		make_scripts(subclass.ptr(), inner_class, p_keep_state, p_reuse_orphans);
 	}
 }
 
@@ -3292,7 +3297,8 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	ScriptLambdaInfo old_lambda_info = _get_script_lambda_replacement_info(p_script);
 
 	// Create scripts for subclasses beforehand so they can be referenced
-	make_scripts(p_script, root, p_keep_state);
+	// Orphans belong to the editor's copy of the script, not to a detached export one.
+	make_scripts(p_script, root, p_keep_state, !for_export);
 
 	main_script->_owner = nullptr;
 	Error err = _prepare_compilation(main_script, parser->get_tree(), p_keep_state);
@@ -3312,6 +3318,11 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	_get_function_ptr_replacements(func_ptr_replacements, old_lambda_info, &new_lambda_info);
 	main_script->_recurse_replace_function_ptrs(func_ptr_replacements);
 
+	if (for_export) {
+		// The exported copy is never run, nor does it own the dependencies it loaded.
+		return OK;
+	}
+
 	if (has_static_data && !root->annotated_static_unload) {
 		GDScriptCache::add_static_script(p_script);
 	}
@@ -3323,6 +3334,11 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	return err;
 }
 
+void GDScriptCompiler::set_for_export(bool p_debug) {
+	for_export = true;
+	export_debug = p_debug;
+}
+
 String GDScriptCompiler::get_error() const {
 	return error;
 }
@@ -223,6 +223,55 @@ void GDScriptFunction::debug_get_stack_member_state(int p_line, List<Pair<String
 	}
 }
 
+#ifdef GDSCRIPT_OPCODE_PAIR_PROFILING
+SafeNumeric<uint64_t> GDScriptFunction::opcode_pair_counts[OPCODE_END + 1][OPCODE_END + 1];
+
+void GDScriptFunction::print_opcode_pair_profile(int p_max_pairs) {
+	struct OpcodePair {
+		int previous = 0;
+		int next = 0;
+		uint64_t count = 0;
+
+		bool operator<(const OpcodePair &p_other) const {
+			return count > p_other.count;
+		}
+	};
+
+	LocalVector<OpcodePair> pairs;
+	uint64_t total = 0;
+	for (int i = 0; i <= OPCODE_END; i++) {
+		for (int j = 0; j <= OPCODE_END; j++) {
+			uint64_t count = opcode_pair_counts[i][j].get();
+			if (count > 0) {
+				pairs.push_back({ i, j, count });
+				total += count;
+			}
+		}
+	}
+	if (total == 0) {
+		return;
+	}
+	pairs.sort();
+
+	print_line(vformat("GDScript opcode pairs (%d dispatches, %d distinct pairs):", total, pairs.size()));
+	for (uint32_t i = 0; i < pairs.size() && (int)i < p_max_pairs; i++) {
+#ifdef DEBUG_ENABLED
+		print_line(vformat("  %s -> %s: %d (%.2f%%)", get_opcode_name(pairs[i].previous), get_opcode_name(pairs[i].next), pairs[i].count, 100.0 * pairs[i].count / total));
+#else
+		print_line(vformat("  %d -> %d: %d (%.2f%%)", pairs[i].previous, pairs[i].next, pairs[i].count, 100.0 * pairs[i].count / total));
+#endif
+	}
+}
+
+void GDScriptFunction::clear_opcode_pair_profile() {
+	for (int i = 0; i <= OPCODE_END; i++) {
+		for (int j = 0; j <= OPCODE_END; j++) {
+			opcode_pair_counts[i][j].set(0);
+		}
+	}
+}
+#endif // GDSCRIPT_OPCODE_PAIR_PROFILING
+
 GDScriptFunction::GDScriptFunction() {
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
@@ -152,6 +152,8 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
+		OPCODE_MEMBER_OPERATOR_VALIDATED,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -339,6 +341,7 @@ public:
 
 private:
 	friend class GDScript;
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
@@ -493,6 +496,19 @@ public:
 #ifdef DEBUG_ENABLED
 	void _profile_native_call(uint64_t p_t_taken, const String &p_function_name, const String &p_instance_class_name = String());
 	void disassemble(const Vector<String> &p_code_lines) const;
+	static const char *get_opcode_name(int p_opcode);
+#endif
+
+#ifdef GDSCRIPT_OPCODE_PAIR_PROFILING
+	// Counts how often each opcode is directly followed by another, to find candidates for fused instructions.
+	static SafeNumeric<uint64_t> opcode_pair_counts[OPCODE_END + 1][OPCODE_END + 1];
+	_FORCE_INLINE_ static void profile_opcode_pair(int p_previous, int p_next) {
+		if (p_previous >= 0 && p_next >= 0 && p_next <= OPCODE_END) {
+			opcode_pair_counts[p_previous][p_next].increment();
+		}
+	}
+	static void print_opcode_pair_profile(int p_max_pairs = 32);
+	static void clear_opcode_pair_profile();
 #endif
 
 	GDScriptFunction();
@@ -251,11 +251,21 @@ void (*type_init_function_table[])(Variant *) = {
 	&VariantInitializer<PackedVector4Array>::init, // PACKED_VECTOR4_ARRAY.
 };
 
+#ifdef GDSCRIPT_OPCODE_PAIR_PROFILING
+#define PROFILE_OPCODE_PAIR() \
+	GDScriptFunction::profile_opcode_pair(profiled_opcode, _code_ptr[ip]); \
+	profiled_opcode = _code_ptr[ip]
+#else
+#define PROFILE_OPCODE_PAIR()
+#endif // GDSCRIPT_OPCODE_PAIR_PROFILING
+
 #if defined(__GNUC__) || defined(__clang__)
 #define OPCODES_TABLE \
 	static const void *switch_table_ops[] = { \
 		&&OPCODE_OPERATOR, \
 		&&OPCODE_OPERATOR_VALIDATED, \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT, \
+		&&OPCODE_MEMBER_OPERATOR_VALIDATED, \
 		&&OPCODE_TYPE_TEST_BUILTIN, \
 		&&OPCODE_TYPE_TEST_ARRAY, \
 		&&OPCODE_TYPE_TEST_DICTIONARY, \
@@ -426,10 +436,13 @@ void (*type_init_function_table[])(Variant *) = {
 
 #ifdef DEBUG_ENABLED
 #define DISPATCH_OPCODE \
+	PROFILE_OPCODE_PAIR(); \
 	last_opcode = _code_ptr[ip]; \
 	goto *switch_table_ops[last_opcode]
 #else // !DEBUG_ENABLED
-#define DISPATCH_OPCODE goto *switch_table_ops[_code_ptr[ip]]
+#define DISPATCH_OPCODE \
+	PROFILE_OPCODE_PAIR(); \
+	goto *switch_table_ops[_code_ptr[ip]]
 #endif // DEBUG_ENABLED
 
 #define OPCODE_BREAK goto OPSEXIT
@@ -750,12 +763,20 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	bool awaited = false;
 	Variant *variant_addresses[ADDR_TYPE_MAX] = { stack, _constants_ptr, p_instance ? p_instance->members.ptrw() : nullptr };
 
+#ifdef GDSCRIPT_OPCODE_PAIR_PROFILING
+	int profiled_opcode = -1;
+#endif
+
 #ifdef DEBUG_ENABLED
 	OPCODE_WHILE(ip < _code_size) {
 		int last_opcode = _code_ptr[ip];
 #else
 	OPCODE_WHILE(true) {
 #endif
+#if !(defined(__GNUC__) || defined(__clang__))
+		// Jump table dispatch profiles in `DISPATCH_OPCODE`, the switch goes through here for every instruction.
+		PROFILE_OPCODE_PAIR();
+#endif
 
 		OPCODE_SWITCH(_code_ptr[ip]) {
 			OPCODE(OPCODE_OPERATOR) {
@@ -862,6 +883,79 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT) {
+				// Fused `OPCODE_OPERATOR_VALIDATED` + `OPCODE_JUMP_IF_NOT` on its result.
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				if (!dst->booleanize()) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_MEMBER_OPERATOR_VALIDATED) {
+				// Fused `OPCODE_GET_MEMBER` + `OPCODE_OPERATOR_VALIDATED` + `OPCODE_SET_MEMBER`, laid out as the three of them.
+				CHECK_SPACE(11);
+
+				GET_VARIANT_PTR(member, 0);
+				int get_indexname = _code_ptr[ip + 2];
+				GD_ERR_BREAK(get_indexname < 0 || get_indexname >= _global_names_count);
+				const StringName *get_index = &_global_names_ptr[get_indexname];
+#ifndef DEBUG_ENABLED
+				ClassDB::get_property(p_instance->owner, *get_index, *member);
+#else
+				if (!ClassDB::get_property(p_instance->owner, *get_index, *member)) {
+					err_text = "Internal error getting property: " + String(*get_index);
+					OPCODE_BREAK;
+				}
+#endif
+
+				int operator_idx = _code_ptr[ip + 7];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 3);
+				GET_VARIANT_PTR(b, 4);
+				GET_VARIANT_PTR(dst, 5);
+
+				operator_func(a, b, dst);
+
+				GET_VARIANT_PTR(src, 8);
+				int set_indexname = _code_ptr[ip + 10];
+				GD_ERR_BREAK(set_indexname < 0 || set_indexname >= _global_names_count);
+				const StringName *set_index = &_global_names_ptr[set_indexname];
+
+				bool valid;
+#ifndef DEBUG_ENABLED
+				ClassDB::set_property(p_instance->owner, *set_index, *src, &valid);
+#else
+				bool ok = ClassDB::set_property(p_instance->owner, *set_index, *src, &valid);
+				if (!ok) {
+					err_text = "Internal error setting property: " + String(*set_index);
+					OPCODE_BREAK;
+				} else if (!valid) {
+					err_text = "Error setting property '" + String(*set_index) + "' with value of type " + Variant::get_type_name(src->get_type()) + ".";
+					OPCODE_BREAK;
+				}
+#endif
+				ip += 11;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -3813,13 +3907,19 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				int globalname_idx = _code_ptr[ip + 2];
 				GD_ERR_BREAK(globalname_idx < 0 || globalname_idx >= _global_names_count);
 				const StringName *globalname = &_global_names_ptr[globalname_idx];
-				if (unlikely(!GDScriptLanguage::get_singleton()->get_named_globals_map().has(*globalname))) {
-					err_text = vformat(R"(Trying to access non-existent autoload singleton "%s".)", *globalname);
-					OPCODE_BREAK;
+				const Variant *global = GDScriptLanguage::get_singleton()->get_named_globals_map().getptr(*globalname);
+				if (unlikely(global == nullptr)) {
+					// Bytecode compiled by the editor refers to autoloads by name, which are regular globals at runtime.
+					const HashMap<StringName, int>::ConstIterator E = GDScriptLanguage::get_singleton()->get_global_map().find(*globalname);
+					if (unlikely(!E)) {
+						err_text = vformat(R"(Trying to access non-existent autoload singleton "%s".)", *globalname);
+						OPCODE_BREAK;
+					}
+					global = &GDScriptLanguage::get_singleton()->get_global_array()[E->value];
 				}
 
 				GET_VARIANT_PTR(dst, 0);
-				*dst = GDScriptLanguage::get_singleton()->get_named_globals_map()[*globalname];
+				*dst = *global;
 
 				ip += 3;
 			}
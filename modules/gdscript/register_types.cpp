@@ -31,6 +31,7 @@
 #include "register_types.h"
 
 #include "gdscript.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_parser.h"
 #include "gdscript_resource_format.h"
@@ -85,35 +86,59 @@ class EditorExportGDScript : public EditorExportPlugin {
 
 	static constexpr EditorExportPreset::ScriptExportMode DEFAULT_SCRIPT_MODE = EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED;
 	EditorExportPreset::ScriptExportMode script_mode = DEFAULT_SCRIPT_MODE;
+	bool export_bytecode_cache = true;
+	GDScriptBytecodeCache::ExportOptions bytecode_options;
 
 protected:
+	virtual void _get_export_options(const Ref<EditorExportPlatform> &p_export_platform, List<EditorExportPlatform::ExportOption> *r_options) const override {
+		r_options->push_back(EditorExportPlatform::ExportOption(PropertyInfo(Variant::BOOL, "gdscript/export_bytecode_cache"), true));
+	}
+
 	virtual void _export_begin(const HashSet<String> &p_features, bool p_debug, const String &p_path, int p_flags) override {
 		script_mode = DEFAULT_SCRIPT_MODE;
+		export_bytecode_cache = true;
 
 		const Ref<EditorExportPreset> &preset = get_export_preset();
 		if (preset.is_valid()) {
 			script_mode = preset->get_script_export_mode();
+			export_bytecode_cache = get_option("gdscript/export_bytecode_cache");
 		}
+
+		bytecode_options = GDScriptBytecodeCache::ExportOptions();
+		bytecode_options.debug = p_debug;
+		bytecode_options.binary_tokens = script_mode != EditorExportPreset::MODE_SCRIPT_TEXT;
+		bytecode_options.compress_binary_tokens = script_mode == EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED;
 	}
 
 	virtual void _export_file(const String &p_path, const String &p_type, const HashSet<String> &p_features) override {
-		if (p_path.get_extension() != "gd" || script_mode == EditorExportPreset::MODE_SCRIPT_TEXT) {
+		if (p_path.get_extension() != "gd") {
 			return;
 		}
 
-		Vector<uint8_t> file = FileAccess::get_file_as_bytes(p_path);
-		if (file.is_empty()) {
-			return;
+		if (script_mode != EditorExportPreset::MODE_SCRIPT_TEXT) {
+			Vector<uint8_t> file = FileAccess::get_file_as_bytes(p_path);
+			if (file.is_empty()) {
+				return;
+			}
+
+			String source = String::utf8(reinterpret_cast<const char *>(file.ptr()), file.size());
+			GDScriptTokenizerBuffer::CompressMode compress_mode = script_mode == EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED ? GDScriptTokenizerBuffer::COMPRESS_ZSTD : GDScriptTokenizerBuffer::COMPRESS_NONE;
+			file = GDScriptTokenizerBuffer::parse_code_string(source, compress_mode);
+			if (file.is_empty()) {
+				return;
+			}
+
+			add_file(p_path.get_basename() + ".gdc", file, true);
+			bytecode_options.source_hashes[p_path] = hash_djb2_buffer(file.ptr(), file.size());
 		}
 
-		String source = String::utf8(reinterpret_cast<const char *>(file.ptr()), file.size());
-		GDScriptTokenizerBuffer::CompressMode compress_mode = script_mode == EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED ? GDScriptTokenizerBuffer::COMPRESS_ZSTD : GDScriptTokenizerBuffer::COMPRESS_NONE;
-		file = GDScriptTokenizerBuffer::parse_code_string(source, compress_mode);
-		if (file.is_empty()) {
-			return;
+		if (export_bytecode_cache) {
+			// Optional, the exported game compiles the script from source without it.
+			Vector<uint8_t> bytecode;
+			if (GDScriptBytecodeCache::export_script(p_path, bytecode_options, bytecode) == OK) {
+				add_file(GDScriptBytecodeCache::get_cache_path(p_path), bytecode, false);
+			}
 		}
-
-		add_file(p_path.get_basename() + ".gdc", file, true);
 	}
 
 public:
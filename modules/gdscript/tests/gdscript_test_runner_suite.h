@@ -30,7 +30,9 @@
 
 #pragma once
 
+#include "../gdscript_bytecode_cache.h"
 #include "../gdscript_cache.h"
+#include "../gdscript_parser.h"
 #include "gdscript_test_runner.h"
 
 #include "core/io/file_access.h"
@@ -53,6 +55,11 @@ public:
 	static bool has_full(String p_path) {
 		return GDScriptCache::singleton->full_gdscript_cache.has(p_path);
 	}
+
+	static GDScriptParserRef::Status get_parser_status(String p_path) {
+		GDScriptParserRef **parser_ref = GDScriptCache::singleton->parser_map.getptr(p_path);
+		return parser_ref ? (*parser_ref)->get_status() : GDScriptParserRef::EMPTY;
+	}
 };
 
 // TODO: Handle some cases failing on release builds. See: https://github.com/godotengine/godot/pull/88452
@@ -111,6 +118,107 @@ TEST_CASE("[Modules][GDScript] Loading keeps ResourceCache and GDScriptCache in
 	CHECK(TestGDScriptCacheAccessor::has_full(path));
 }
 
+TEST_CASE("[Modules][GDScript] Loading compiles from the tree already parsed by GDScriptCache") {
+	const String path = TestUtils::get_temp_path("gdscript_parser_reuse_test.gd");
+
+	{
+		Ref<FileAccess> fa = FileAccess::open(path, FileAccess::ModeFlags::WRITE);
+		fa->store_string("extends RefCounted\n\nfunc get_value() -> int:\n\treturn 21 * 2\n");
+		fa->close();
+	}
+
+	Error err = OK;
+	Ref<GDScript> shallow = GDScriptCache::get_shallow_script(path, err);
+	REQUIRE(err == OK);
+	CHECK(TestGDScriptCacheAccessor::get_parser_status(path) == GDScriptParserRef::PARSED);
+
+	Ref<GDScript> full = GDScriptCache::get_full_script(path, err);
+	REQUIRE(err == OK);
+	CHECK(full == shallow);
+	CHECK(full->is_valid());
+	CHECK_MESSAGE(TestGDScriptCacheAccessor::get_parser_status(path) == GDScriptParserRef::FULLY_SOLVED, "The cached parser should have been analyzed and used for compilation.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(full);
+	CHECK(int(ref_counted->call("get_value")) == 42);
+}
+
+TEST_CASE("[Modules][GDScript] Pinned cached parsers outlive removal from GDScriptCache") {
+	const String path = TestUtils::get_temp_path("gdscript_parser_pin_test.gd");
+
+	{
+		Ref<FileAccess> fa = FileAccess::open(path, FileAccess::ModeFlags::WRITE);
+		fa->store_string("extends RefCounted\n\nvar value := 1\n");
+		fa->close();
+	}
+
+	Error err = OK;
+	Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(path, GDScriptParserRef::PARSED, err);
+	REQUIRE(err == OK);
+	REQUIRE(parser_ref.is_valid());
+
+	parser_ref->pin();
+	GDScriptCache::remove_script(path);
+	CHECK_MESSAGE(parser_ref->get_status() == GDScriptParserRef::PARSED, "Clearing a pinned parser should be deferred.");
+	CHECK(parser_ref->get_parser()->get_tree() != nullptr);
+
+	parser_ref->unpin();
+	CHECK(parser_ref->get_status() == GDScriptParserRef::EMPTY);
+}
+
+#ifdef TOOLS_ENABLED
+TEST_CASE("[Modules][GDScript] Exported bytecode replaces compiling until the source changes") {
+	const String path = TestUtils::get_temp_path("gdscript_bytecode_test.gd");
+
+	{
+		Ref<FileAccess> fa = FileAccess::open(path, FileAccess::ModeFlags::WRITE);
+		fa->store_string("extends RefCounted\n\nconst FACTOR = 2\nstatic var calls := 0\n\nclass Inner:\n\tfunc get_base() -> int:\n\t\treturn 20\n\nfunc get_value() -> int:\n\tcalls += 1\n\tvar add := func(p_value: int) -> int: return p_value + 2\n\treturn add.call(Inner.new().get_base() * FACTOR)\n");
+		fa->close();
+	}
+
+	GDScriptBytecodeCache::ExportOptions options;
+	options.debug = true;
+	Vector<uint8_t> bytecode;
+	REQUIRE(GDScriptBytecodeCache::export_script(path, options, bytecode) == OK);
+	GDScriptCache::remove_script(path);
+	CHECK(GDScriptBytecodeCache::is_up_to_date(bytecode, GDScriptCache::get_source_hash(path)));
+
+	{
+		Ref<FileAccess> fa = FileAccess::open(GDScriptBytecodeCache::get_cache_path(path), FileAccess::ModeFlags::WRITE);
+		fa->store_buffer(bytecode);
+		fa->close();
+	}
+
+	Error err = OK;
+	{
+		Ref<GDScript> script = GDScriptCache::get_full_script(path, err);
+		REQUIRE(err == OK);
+		CHECK(script->is_valid());
+		CHECK_MESSAGE(TestGDScriptCacheAccessor::get_parser_status(path) == GDScriptParserRef::EMPTY, "The script should have been loaded from the exported bytecode.");
+
+		Ref<RefCounted> ref_counted = memnew(RefCounted);
+		ref_counted->set_script(script);
+		CHECK(int(ref_counted->call("get_value")) == 42);
+	}
+	GDScriptCache::remove_script(path);
+
+	{
+		Ref<FileAccess> fa = FileAccess::open(path, FileAccess::ModeFlags::WRITE);
+		fa->store_string("extends RefCounted\n\nfunc get_value() -> int:\n\treturn 7\n");
+		fa->close();
+	}
+	CHECK_FALSE(GDScriptBytecodeCache::is_up_to_date(bytecode, GDScriptCache::get_source_hash(path)));
+
+	Ref<GDScript> script = GDScriptCache::get_full_script(path, err);
+	REQUIRE(err == OK);
+	CHECK_MESSAGE(TestGDScriptCacheAccessor::get_parser_status(path) == GDScriptParserRef::FULLY_SOLVED, "Outdated bytecode should fall back to compiling the source.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(script);
+	CHECK(int(ref_counted->call("get_value")) == 7);
+}
+#endif // TOOLS_ENABLED
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
@@ -0,0 +1,48 @@
+# Typed comparisons directly tested by `if` and `while` are fused with the jump.
+
+func test():
+	var count: int = 0
+	while count < 5:
+		count += 1
+	print(count)
+
+	var total: float = 0.0
+	var i: int = 10
+	while i > 0:
+		if i % 2 == 0:
+			total += i
+		elif i == 3:
+			total -= 0.5
+		else:
+			print_edge(i)
+		i -= 1
+	print(total)
+
+	var found := false
+	for j: int in 10:
+		if j == 7:
+			found = true
+			break
+	print(found)
+
+	var a: int = 3
+	var b: int = 4
+	if not a < b:
+		print("not reached")
+	else:
+		print("not a < b is false")
+
+	var nested: int = 0
+	var x: int = 0
+	while x < 3:
+		var y: int = 0
+		while y < 3:
+			if x != y:
+				nested += 1
+			y += 1
+		x += 1
+	print(nested)
+
+func print_edge(value: int) -> void:
+	if value >= 9 or value <= 1:
+		print("odd edge ", value)
@@ -0,0 +1,26 @@
+# Typed compound assignments to native properties run as a single fused instruction.
+extends Node
+
+func test():
+	process_priority = 1
+	var step: int = 3
+	process_priority += step
+	print(process_priority)
+	process_priority *= 2
+	print(process_priority)
+	process_priority = process_priority - 5
+	print(process_priority)
+
+	for i in 4:
+		process_priority += i
+	print(process_priority)
+
+	var count: int = 0
+	while process_priority > 0:
+		process_priority -= 2
+		count += 1
+	print(process_priority, " ", count)
+
+	editor_description = "a"
+	editor_description += "b"
+	print(editor_description)
@@ -475,6 +475,13 @@ bool GodotBody3D::is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const {
 }
 
 void GodotBody3D::integrate_forces(real_t p_step) {
+	integrate_forces_local(p_step);
+	integrate_forces_finish();
+}
+
+void GodotBody3D::integrate_forces_local(real_t p_step) {
+	pending_shape_motion_update = false;
+
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
 	}
@@ -665,23 +672,35 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector3();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		pending_shape_motion = motion;
+		pending_shape_motion_update = true;
 	}
 
 	contact_count = 0;
 }
 
+void GodotBody3D::integrate_forces_finish() {
+	if (pending_shape_motion_update) {
+		_update_shapes_with_motion(pending_shape_motion);
+		pending_shape_motion_update = false;
+	}
+}
+
 void GodotBody3D::integrate_velocities(real_t p_step) {
+	integrate_velocities_local(p_step);
+	integrate_velocities_finish();
+}
+
+void GodotBody3D::integrate_velocities_local(real_t p_step) {
+	pending_shape_update = false;
+	pending_deactivation = false;
+
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
 	}
 
 	ERR_FAIL_NULL(get_space());
 
-	if (fi_callback_data || body_state_callback.is_valid()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
-	}
-
 	//apply axis lock linear
 	for (int i = 0; i < 3; i++) {
 		if (is_axis_locked((PhysicsServer3D::BodyAxis)(1 << i))) {
@@ -702,7 +721,7 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.is_empty() && linear_velocity == Vector3() && angular_velocity == Vector3()) {
-			set_active(false); //stopped moving, deactivate
+			pending_deactivation = true; //stopped moving, deactivate
 		}
 
 		return;
@@ -731,10 +750,32 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	transform_new.origin += total_linear_velocity * p_step;
 
-	_set_transform(transform_new);
+	_set_transform(transform_new, false);
 	_set_inv_transform(get_transform().inverse());
 
 	_update_transform_dependent();
+
+	pending_shape_update = true;
+}
+
+void GodotBody3D::integrate_velocities_finish() {
+	if (mode == PhysicsServer3D::BODY_MODE_STATIC || !get_space()) {
+		return;
+	}
+
+	if (fi_callback_data || body_state_callback.is_valid()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+
+	if (pending_shape_update) {
+		_update_shapes();
+		pending_shape_update = false;
+	}
+
+	if (pending_deactivation) {
+		set_active(false);
+		pending_deactivation = false;
+	}
 }
 
 void GodotBody3D::wakeup_neighbours() {
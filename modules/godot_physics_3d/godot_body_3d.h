@@ -89,6 +89,12 @@ class GodotBody3D : public GodotCollisionObject3D {
 
 	real_t still_time = 0.0;
 
+	// Deferred from the local to the finish integration passes.
+	Vector3 pending_shape_motion;
+	bool pending_shape_motion_update = false;
+	bool pending_shape_update = false;
+	bool pending_deactivation = false;
+
 	Vector3 applied_force;
 	Vector3 applied_torque;
 
@@ -319,6 +325,14 @@ public:
 	void integrate_forces(real_t p_step);
 	void integrate_velocities(real_t p_step);
 
+	// Integration split in two, so the first part can run on multiple threads:
+	// the "local" part only touches this body, while the "finish" part updates the space
+	// (broadphase, active and query lists) and must be called from a single thread.
+	void integrate_forces_local(real_t p_step);
+	void integrate_forces_finish();
+	void integrate_velocities_local(real_t p_step);
+	void integrate_velocities_finish();
+
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
 	}
@@ -260,9 +260,37 @@ real_t combine_friction(GodotBody3D *A, GodotBody3D *B) {
 	return Math::abs(MIN(A->get_friction(), B->get_friction()));
 }
 
+void GodotBodyPair3D::get_collision_shapes(const GodotShape3D *&r_shape_A, Transform3D &r_xform_A, const GodotShape3D *&r_shape_B, Transform3D &r_xform_B) const {
+	const Vector3 &offset_A = A->get_transform().get_origin();
+	Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
+	r_xform_A = xform_Au * A->get_shape_transform(shape_A);
+
+	Transform3D xform_Bu = B->get_transform();
+	xform_Bu.origin -= offset_A;
+	r_xform_B = xform_Bu * B->get_shape_transform(shape_B);
+
+	r_shape_A = A->get_shape(shape_A);
+	r_shape_B = B->get_shape(shape_B);
+}
+
+void GodotBodyPair3D::gather_narrowphase(GodotNarrowphaseBatch3D &p_batch) {
+	narrowphase_batch = nullptr;
+
+	bool swap = false;
+	if (!GodotNarrowphaseBatch3D::get_pair_type(A->get_shape(shape_A)->get_type(), B->get_shape(shape_B)->get_type(), narrowphase_pair_type, swap)) {
+		return;
+	}
+	narrowphase_index = p_batch.add_pair(narrowphase_pair_type, swap, this);
+	narrowphase_batch = &p_batch;
+}
+
 bool GodotBodyPair3D::setup(real_t p_step) {
 	check_ccd = false;
 
+	// Batched results are only valid for the step they were gathered in.
+	const GodotNarrowphaseBatch3D *batch = narrowphase_batch;
+	narrowphase_batch = nullptr;
+
 	if (!A->interacts_with(B) || A->has_exception(B->get_self()) || B->has_exception(A->get_self())) {
 		collided = false;
 		return false;
@@ -285,18 +313,25 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 
 	validate_contacts();
 
-	const Vector3 &offset_A = A->get_transform().get_origin();
-	Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
-	Transform3D xform_A = xform_Au * A->get_shape_transform(shape_A);
-
-	Transform3D xform_Bu = B->get_transform();
-	xform_Bu.origin -= offset_A;
-	Transform3D xform_B = xform_Bu * B->get_shape_transform(shape_B);
-
-	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
-	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
+	GodotNarrowphaseBatch3D::Result result = GodotNarrowphaseBatch3D::RESULT_FALLBACK;
+	Vector3 point_A, point_B, normal;
+	if (batch) {
+		result = batch->get_result(narrowphase_pair_type, narrowphase_index, point_A, point_B, normal);
+	}
 
-	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+	if (result == GodotNarrowphaseBatch3D::RESULT_FALLBACK) {
+		const GodotShape3D *shape_A_ptr = nullptr;
+		const GodotShape3D *shape_B_ptr = nullptr;
+		Transform3D xform_A, xform_B;
+		get_collision_shapes(shape_A_ptr, xform_A, shape_B_ptr, xform_B);
+
+		collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+	} else {
+		collided = result == GodotNarrowphaseBatch3D::RESULT_CONTACT;
+		if (collided) {
+			contact_added_callback(point_A, 0, point_B, 0, normal);
+		}
+	}
 
 	if (!collided) {
 		if (A->is_continuous_collision_detection_enabled() && collide_A) {
@@ -32,6 +32,7 @@
 
 #include "godot_body_3d.h"
 #include "godot_constraint_3d.h"
+#include "godot_narrowphase_batch_3d.h"
 #include "godot_soft_body_3d.h"
 
 #include "core/templates/local_vector.h"
@@ -96,6 +97,11 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	// Set when the pair was gathered in a narrowphase batch for the current step.
+	const GodotNarrowphaseBatch3D *narrowphase_batch = nullptr;
+	GodotNarrowphaseBatch3D::PairType narrowphase_pair_type = GodotNarrowphaseBatch3D::PAIR_TYPE_MAX;
+	uint32_t narrowphase_index = 0;
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal);
@@ -104,6 +110,9 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
 public:
+	void get_collision_shapes(const GodotShape3D *&r_shape_A, Transform3D &r_xform_A, const GodotShape3D *&r_shape_B, Transform3D &r_xform_B) const;
+
+	virtual void gather_narrowphase(GodotNarrowphaseBatch3D &p_batch) override;
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
@@ -34,6 +34,7 @@
 #include "core/typedefs.h"
 
 class GodotBody3D;
+class GodotNarrowphaseBatch3D;
 class GodotSoftBody3D;
 
 class GodotConstraint3D {
@@ -73,6 +74,8 @@ public:
 	_FORCE_INLINE_ void disable_collisions_between_bodies(const bool p_disabled) { disabled_collisions_between_bodies = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled_collisions_between_bodies() const { return disabled_collisions_between_bodies; }
 
+	// Called before `setup()` so that constraints can queue their collision tests in the batch.
+	virtual void gather_narrowphase(GodotNarrowphaseBatch3D &p_batch) {}
 	virtual bool setup(real_t p_step) = 0;
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
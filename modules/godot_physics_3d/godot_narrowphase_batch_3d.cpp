@@ -0,0 +1,720 @@
+/**************************************************************************/
+/*  godot_narrowphase_batch_3d.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "godot_narrowphase_batch_3d.h"
+
+#include "godot_body_pair_3d.h"
+#include "godot_shape_3d.h"
+
+#include "core/object/worker_thread_pool.h"
+
+#if !defined(REAL_T_IS_DOUBLE) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64))
+#define NARROWPHASE_BATCH_SSE2
+#include <emmintrin.h>
+#elif !defined(REAL_T_IS_DOUBLE) && (defined(__aarch64__) || defined(_M_ARM64))
+#define NARROWPHASE_BATCH_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+// A `Lane` holds one value per pair processed together, a `Mask` one boolean per pair.
+// The kernels below are written once against these and compiled for the available SIMD set.
+
+#if defined(NARROWPHASE_BATCH_SSE2)
+
+struct Mask {
+	__m128 v;
+};
+
+struct Lane {
+	static constexpr uint32_t WIDTH = 4;
+	__m128 v;
+
+	static _FORCE_INLINE_ Lane load(const real_t *p_ptr) { return { _mm_loadu_ps(p_ptr) }; }
+	static _FORCE_INLINE_ Lane splat(real_t p_value) { return { _mm_set1_ps(p_value) }; }
+	_FORCE_INLINE_ void store(real_t *p_ptr) const { _mm_storeu_ps(p_ptr, v); }
+};
+
+_FORCE_INLINE_ Lane operator+(Lane p_a, Lane p_b) { return { _mm_add_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane operator-(Lane p_a, Lane p_b) { return { _mm_sub_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane operator*(Lane p_a, Lane p_b) { return { _mm_mul_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane operator/(Lane p_a, Lane p_b) { return { _mm_div_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane operator-(Lane p_a) { return { _mm_xor_ps(p_a.v, _mm_set1_ps(-0.0f)) }; }
+_FORCE_INLINE_ Lane lane_abs(Lane p_a) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), p_a.v) }; }
+_FORCE_INLINE_ Lane lane_min(Lane p_a, Lane p_b) { return { _mm_min_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane lane_max(Lane p_a, Lane p_b) { return { _mm_max_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane lane_sqrt(Lane p_a) { return { _mm_sqrt_ps(p_a.v) }; }
+
+_FORCE_INLINE_ Mask operator<(Lane p_a, Lane p_b) { return { _mm_cmplt_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator<=(Lane p_a, Lane p_b) { return { _mm_cmple_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator>(Lane p_a, Lane p_b) { return { _mm_cmpgt_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator>=(Lane p_a, Lane p_b) { return { _mm_cmpge_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator==(Lane p_a, Lane p_b) { return { _mm_cmpeq_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator&(Mask p_a, Mask p_b) { return { _mm_and_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator|(Mask p_a, Mask p_b) { return { _mm_or_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator!(Mask p_a) { return { _mm_xor_ps(p_a.v, _mm_castsi128_ps(_mm_set1_epi32(-1))) }; }
+
+_FORCE_INLINE_ Lane select(Mask p_mask, Lane p_true, Lane p_false) {
+	return { _mm_or_ps(_mm_and_ps(p_mask.v, p_true.v), _mm_andnot_ps(p_mask.v, p_false.v)) };
+}
+
+#elif defined(NARROWPHASE_BATCH_NEON)
+
+struct Mask {
+	uint32x4_t v;
+};
+
+struct Lane {
+	static constexpr uint32_t WIDTH = 4;
+	float32x4_t v;
+
+	static _FORCE_INLINE_ Lane load(const real_t *p_ptr) { return { vld1q_f32(p_ptr) }; }
+	static _FORCE_INLINE_ Lane splat(real_t p_value) { return { vdupq_n_f32(p_value) }; }
+	_FORCE_INLINE_ void store(real_t *p_ptr) const { vst1q_f32(p_ptr, v); }
+};
+
+_FORCE_INLINE_ Lane operator+(Lane p_a, Lane p_b) { return { vaddq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane operator-(Lane p_a, Lane p_b) { return { vsubq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane operator*(Lane p_a, Lane p_b) { return { vmulq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane operator/(Lane p_a, Lane p_b) { return { vdivq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane operator-(Lane p_a) { return { vnegq_f32(p_a.v) }; }
+_FORCE_INLINE_ Lane lane_abs(Lane p_a) { return { vabsq_f32(p_a.v) }; }
+_FORCE_INLINE_ Lane lane_min(Lane p_a, Lane p_b) { return { vminq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane lane_max(Lane p_a, Lane p_b) { return { vmaxq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane lane_sqrt(Lane p_a) { return { vsqrtq_f32(p_a.v) }; }
+
+_FORCE_INLINE_ Mask operator<(Lane p_a, Lane p_b) { return { vcltq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator<=(Lane p_a, Lane p_b) { return { vcleq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator>(Lane p_a, Lane p_b) { return { vcgtq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator>=(Lane p_a, Lane p_b) { return { vcgeq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator==(Lane p_a, Lane p_b) { return { vceqq_f32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator&(Mask p_a, Mask p_b) { return { vandq_u32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator|(Mask p_a, Mask p_b) { return { vorrq_u32(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Mask operator!(Mask p_a) { return { vmvnq_u32(p_a.v) }; }
+
+_FORCE_INLINE_ Lane select(Mask p_mask, Lane p_true, Lane p_false) {
+	return { vbslq_f32(p_mask.v, p_true.v, p_false.v) };
+}
+
+#else
+
+struct Mask {
+	bool v;
+};
+
+struct Lane {
+	static constexpr uint32_t WIDTH = 1;
+	real_t v;
+
+	static _FORCE_INLINE_ Lane load(const real_t *p_ptr) { return { *p_ptr }; }
+	static _FORCE_INLINE_ Lane splat(real_t p_value) { return { p_value }; }
+	_FORCE_INLINE_ void store(real_t *p_ptr) const { *p_ptr = v; }
+};
+
+_FORCE_INLINE_ Lane operator+(Lane p_a, Lane p_b) { return { p_a.v + p_b.v }; }
+_FORCE_INLINE_ Lane operator-(Lane p_a, Lane p_b) { return { p_a.v - p_b.v }; }
+_FORCE_INLINE_ Lane operator*(Lane p_a, Lane p_b) { return { p_a.v * p_b.v }; }
+_FORCE_INLINE_ Lane operator/(Lane p_a, Lane p_b) { return { p_a.v / p_b.v }; }
+_FORCE_INLINE_ Lane operator-(Lane p_a) { return { -p_a.v }; }
+_FORCE_INLINE_ Lane lane_abs(Lane p_a) { return { Math::abs(p_a.v) }; }
+_FORCE_INLINE_ Lane lane_min(Lane p_a, Lane p_b) { return { MIN(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane lane_max(Lane p_a, Lane p_b) { return { MAX(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lane lane_sqrt(Lane p_a) { return { Math::sqrt(p_a.v) }; }
+
+_FORCE_INLINE_ Mask operator<(Lane p_a, Lane p_b) { return { p_a.v < p_b.v }; }
+_FORCE_INLINE_ Mask operator<=(Lane p_a, Lane p_b) { return { p_a.v <= p_b.v }; }
+_FORCE_INLINE_ Mask operator>(Lane p_a, Lane p_b) { return { p_a.v > p_b.v }; }
+_FORCE_INLINE_ Mask operator>=(Lane p_a, Lane p_b) { return { p_a.v >= p_b.v }; }
+_FORCE_INLINE_ Mask operator==(Lane p_a, Lane p_b) { return { p_a.v == p_b.v }; }
+_FORCE_INLINE_ Mask operator&(Mask p_a, Mask p_b) { return { p_a.v && p_b.v }; }
+_FORCE_INLINE_ Mask operator|(Mask p_a, Mask p_b) { return { p_a.v || p_b.v }; }
+_FORCE_INLINE_ Mask operator!(Mask p_a) { return { !p_a.v }; }
+
+_FORCE_INLINE_ Lane select(Mask p_mask, Lane p_true, Lane p_false) {
+	return p_mask.v ? p_true : p_false;
+}
+
+#endif
+
+struct LaneVector3 {
+	Lane x, y, z;
+
+	_FORCE_INLINE_ Lane dot(const LaneVector3 &p_with) const { return x * p_with.x + y * p_with.y + z * p_with.z; }
+	_FORCE_INLINE_ LaneVector3 operator+(const LaneVector3 &p_with) const { return { x + p_with.x, y + p_with.y, z + p_with.z }; }
+	_FORCE_INLINE_ LaneVector3 operator-(const LaneVector3 &p_with) const { return { x - p_with.x, y - p_with.y, z - p_with.z }; }
+	_FORCE_INLINE_ LaneVector3 operator*(Lane p_scalar) const { return { x * p_scalar, y * p_scalar, z * p_scalar }; }
+	_FORCE_INLINE_ LaneVector3 operator/(Lane p_scalar) const { return { x / p_scalar, y / p_scalar, z / p_scalar }; }
+};
+
+_FORCE_INLINE_ LaneVector3 select(Mask p_mask, const LaneVector3 &p_true, const LaneVector3 &p_false) {
+	return { select(p_mask, p_true.x, p_false.x), select(p_mask, p_true.y, p_false.y), select(p_mask, p_true.z, p_false.z) };
+}
+
+// Input columns of each shape. A pair's input is the columns of its first shape followed by the ones of its second shape.
+enum {
+	SPHERE_ORIGIN = 0,
+	SPHERE_RADIUS = 3, // Scaled.
+	SPHERE_COLUMNS = 4,
+
+	BOX_BASIS = 0, // Row-major.
+	BOX_ORIGIN = 9,
+	BOX_HALF_EXTENTS = 12,
+	BOX_COLUMNS = 15,
+
+	CAPSULE_ORIGIN = 0,
+	CAPSULE_HALF_SEGMENT = 3, // From the origin to the center of the top ball.
+	CAPSULE_RADIUS = 6, // Scaled.
+	CAPSULE_COLUMNS = 7,
+};
+
+enum {
+	OUTPUT_RESULT = 0,
+	OUTPUT_POINT_A = 1,
+	OUTPUT_POINT_B = 4,
+	OUTPUT_NORMAL = 7,
+	OUTPUT_COLUMNS = 10,
+};
+
+const uint32_t input_columns[GodotNarrowphaseBatch3D::PAIR_TYPE_MAX] = {
+	SPHERE_COLUMNS + SPHERE_COLUMNS,
+	SPHERE_COLUMNS + BOX_COLUMNS,
+	CAPSULE_COLUMNS + CAPSULE_COLUMNS,
+	BOX_COLUMNS + BOX_COLUMNS,
+};
+
+const uint32_t output_columns[GodotNarrowphaseBatch3D::PAIR_TYPE_MAX] = {
+	OUTPUT_COLUMNS,
+	OUTPUT_COLUMNS,
+	OUTPUT_COLUMNS,
+	1, // Box-box pairs only ever report separation, contacts come from the collision solver.
+};
+
+struct LaneColumns {
+	const real_t *input = nullptr;
+	real_t *output = nullptr;
+	uint32_t stride = 0;
+	uint32_t index = 0;
+
+	_FORCE_INLINE_ Lane get(uint32_t p_column) const { return Lane::load(input + p_column * stride + index); }
+	_FORCE_INLINE_ LaneVector3 get_vector3(uint32_t p_column) const { return { get(p_column), get(p_column + 1), get(p_column + 2) }; }
+	_FORCE_INLINE_ LaneVector3 get_basis_column(uint32_t p_column, int p_axis) const { return { get(p_column + p_axis), get(p_column + 3 + p_axis), get(p_column + 6 + p_axis) }; }
+
+	_FORCE_INLINE_ void set(uint32_t p_column, Lane p_value) const { p_value.store(output + p_column * stride + index); }
+	_FORCE_INLINE_ void set_vector3(uint32_t p_column, const LaneVector3 &p_value) const {
+		set(p_column, p_value.x);
+		set(p_column + 1, p_value.y);
+		set(p_column + 2, p_value.z);
+	}
+
+	_FORCE_INLINE_ void set_contact(Mask p_contact, Mask p_fallback, const LaneVector3 &p_point_A, const LaneVector3 &p_point_B, const LaneVector3 &p_normal) const {
+		Lane result = select(p_fallback, Lane::splat(GodotNarrowphaseBatch3D::RESULT_FALLBACK), select(p_contact, Lane::splat(GodotNarrowphaseBatch3D::RESULT_CONTACT), Lane::splat(GodotNarrowphaseBatch3D::RESULT_SEPARATED)));
+		set(OUTPUT_RESULT, result);
+		set_vector3(OUTPUT_POINT_A, p_point_A);
+		set_vector3(OUTPUT_POINT_B, p_point_B);
+		set_vector3(OUTPUT_NORMAL, p_normal);
+	}
+};
+
+// Same as `analytic_sphere_collision()` in the SAT solver, without margins.
+_FORCE_INLINE_ void _sphere_sphere_contact(const LaneColumns &p_columns, Mask p_fallback, const LaneVector3 &p_origin_A, Lane p_radius_A, const LaneVector3 &p_origin_B, Lane p_radius_B) {
+	const Lane zero = Lane::splat(0.0);
+	const Lane one = Lane::splat(1.0);
+
+	LaneVector3 b_to_a = p_origin_A - p_origin_B;
+	Lane b_to_a_len = lane_sqrt(b_to_a.dot(b_to_a));
+	Lane overlap = p_radius_A + p_radius_B - b_to_a_len;
+	Mask contact = !(overlap < zero);
+
+	// Spheres coincident, use arbitrary direction.
+	Mask coincident = b_to_a_len < Lane::splat(CMP_EPSILON);
+	LaneVector3 normal = select(coincident, LaneVector3{ zero, one, zero }, b_to_a / b_to_a_len);
+
+	// Start from the smaller sphere to minimize precision errors, see the SAT solver.
+	Mask a_smaller = p_radius_A < p_radius_B;
+	LaneVector3 point_A_from_A = p_origin_A - normal * p_radius_A;
+	LaneVector3 point_B_from_A = point_A_from_A + normal * overlap;
+	LaneVector3 point_B_from_B = p_origin_B + normal * p_radius_B;
+	LaneVector3 point_A_from_B = point_B_from_B - normal * overlap;
+
+	p_columns.set_contact(contact, p_fallback, select(a_smaller, point_A_from_A, point_A_from_B), select(a_smaller, point_B_from_A, point_B_from_B), normal);
+}
+
+void _kernel_sphere_sphere(LaneColumns p_columns, uint32_t p_from, uint32_t p_to) {
+	const Mask no_fallback = Lane::splat(0.0) < Lane::splat(0.0);
+	for (uint32_t i = p_from; i < p_to; i += Lane::WIDTH) {
+		p_columns.index = i;
+		_sphere_sphere_contact(p_columns, no_fallback,
+				p_columns.get_vector3(SPHERE_ORIGIN), p_columns.get(SPHERE_RADIUS),
+				p_columns.get_vector3(SPHERE_COLUMNS + SPHERE_ORIGIN), p_columns.get(SPHERE_COLUMNS + SPHERE_RADIUS));
+	}
+}
+
+// Same as `_collision_sphere_box()` in the SAT solver, without margins.
+void _kernel_sphere_box(LaneColumns p_columns, uint32_t p_from, uint32_t p_to) {
+	const Lane zero = Lane::splat(0.0);
+	const Lane one = Lane::splat(1.0);
+	const uint32_t box = SPHERE_COLUMNS;
+
+	for (uint32_t i = p_from; i < p_to; i += Lane::WIDTH) {
+		p_columns.index = i;
+
+		const LaneVector3 sphere_origin = p_columns.get_vector3(SPHERE_ORIGIN);
+		const Lane radius = p_columns.get(SPHERE_RADIUS);
+
+		Lane r[3][3];
+		for (int row = 0; row < 3; row++) {
+			for (int column = 0; column < 3; column++) {
+				r[row][column] = p_columns.get(box + BOX_BASIS + row * 3 + column);
+			}
+		}
+		const LaneVector3 box_origin = p_columns.get_vector3(box + BOX_ORIGIN);
+		const LaneVector3 extents = p_columns.get_vector3(box + BOX_HALF_EXTENTS);
+
+		// Affine inverse of the box transform, as in `Basis::invert()`. Singular bases are left to the solver.
+		Lane co0 = r[1][1] * r[2][2] - r[1][2] * r[2][1];
+		Lane co1 = r[1][2] * r[2][0] - r[1][0] * r[2][2];
+		Lane co2 = r[1][0] * r[2][1] - r[1][1] * r[2][0];
+		Lane det = r[0][0] * co0 + r[0][1] * co1 + r[0][2] * co2;
+		Mask singular = det == zero;
+		Lane s = one / det;
+		LaneVector3 inverse_rows[3] = {
+			{ co0 * s, (r[0][2] * r[2][1] - r[0][1] * r[2][2]) * s, (r[0][1] * r[1][2] - r[0][2] * r[1][1]) * s },
+			{ co1 * s, (r[0][0] * r[2][2] - r[0][2] * r[2][0]) * s, (r[0][2] * r[1][0] - r[0][0] * r[1][2]) * s },
+			{ co2 * s, (r[0][1] * r[2][0] - r[0][0] * r[2][1]) * s, (r[0][0] * r[1][1] - r[0][1] * r[1][0]) * s },
+		};
+		const LaneVector3 negated_origin = { -box_origin.x, -box_origin.y, -box_origin.z };
+
+		// Find the point on the box nearest to the center of the sphere.
+		LaneVector3 center;
+		center.x = inverse_rows[0].dot(sphere_origin) + inverse_rows[0].dot(negated_origin);
+		center.y = inverse_rows[1].dot(sphere_origin) + inverse_rows[1].dot(negated_origin);
+		center.z = inverse_rows[2].dot(sphere_origin) + inverse_rows[2].dot(negated_origin);
+		LaneVector3 local_nearest = {
+			lane_min(lane_max(center.x, -extents.x), extents.x),
+			lane_min(lane_max(center.y, -extents.y), extents.y),
+			lane_min(lane_max(center.z, -extents.z), extents.z),
+		};
+		LaneVector3 nearest;
+		nearest.x = r[0][0] * local_nearest.x + r[0][1] * local_nearest.y + r[0][2] * local_nearest.z + box_origin.x;
+		nearest.y = r[1][0] * local_nearest.x + r[1][1] * local_nearest.y + r[1][2] * local_nearest.z + box_origin.y;
+		nearest.z = r[2][0] * local_nearest.x + r[2][1] * local_nearest.y + r[2][2] * local_nearest.z + box_origin.z;
+
+		// See if it is inside the sphere.
+		LaneVector3 delta = nearest - sphere_origin;
+		Lane length = lane_sqrt(delta.dot(delta));
+		Mask contact = !(length > radius);
+
+		// When the box passes through the sphere center, select an axis based on the box's center.
+		Mask centered = length == zero;
+		LaneVector3 direction = select(centered, box_origin - nearest, delta);
+		Lane direction_length = select(centered, lane_sqrt(direction.dot(direction)), length);
+		LaneVector3 axis = select(direction_length == zero, LaneVector3{ zero, zero, zero }, direction / direction_length);
+
+		p_columns.set_contact(contact, singular, sphere_origin + axis * radius, nearest, axis);
+	}
+}
+
+// Same as `_collision_capsule_capsule()` in the SAT solver, without margins.
+// The closest points between the segments follow `Geometry3D::get_closest_points_between_segments()`,
+// with all of its branches evaluated and selected per lane.
+void _kernel_capsule_capsule(LaneColumns p_columns, uint32_t p_from, uint32_t p_to) {
+	const Lane zero = Lane::splat(0.0);
+	const Lane one = Lane::splat(1.0);
+	const Mask no_fallback = zero < zero;
+	const uint32_t capsule_B = CAPSULE_COLUMNS;
+
+	for (uint32_t i = p_from; i < p_to; i += Lane::WIDTH) {
+		p_columns.index = i;
+
+		const LaneVector3 origin_A = p_columns.get_vector3(CAPSULE_ORIGIN);
+		const LaneVector3 half_segment_A = p_columns.get_vector3(CAPSULE_HALF_SEGMENT);
+		const LaneVector3 origin_B = p_columns.get_vector3(capsule_B + CAPSULE_ORIGIN);
+		const LaneVector3 half_segment_B = p_columns.get_vector3(capsule_B + CAPSULE_HALF_SEGMENT);
+
+		const LaneVector3 p0 = origin_A + half_segment_A;
+		const LaneVector3 p1 = origin_A - half_segment_A;
+		const LaneVector3 q0 = origin_B + half_segment_B;
+		const LaneVector3 q1 = origin_B - half_segment_B;
+
+		const LaneVector3 p = p1 - p0;
+		const LaneVector3 q = q1 - q0;
+		const LaneVector3 r = p0 - q0;
+
+		const Lane a = p.dot(p);
+		const Lane b = p.dot(q);
+		const Lane c = q.dot(q);
+		const Lane d = p.dot(r);
+		const Lane e = q.dot(r);
+		const Lane det = a * c - b * b;
+
+		// Clamped ratios shared by several branches, `a` and `c` can only be zero in the parallel case,
+		// where divisions by them are never selected.
+		const Lane neg_d = -d;
+		const Lane b_minus_d = b - d;
+		const Lane b_plus_e = b + e;
+		const Lane s_neg_d = select(neg_d <= zero, zero, select(neg_d >= a, one, neg_d / a));
+		const Lane s_b_minus_d = select(b_minus_d <= zero, zero, select(b_minus_d >= a, one, b_minus_d / a));
+
+		// Non-parallel segments.
+		const Lane bte = b * e;
+		const Lane ctd = c * d;
+		const Lane ate = a * e;
+		const Lane btd = b * d;
+		const Lane s_num = bte - ctd;
+		const Lane t_num = ate - btd;
+
+		// s <= 0.
+		const Mask e_low = e <= zero;
+		const Mask e_inside = e < c;
+		const Lane s_min = select(e_low, s_neg_d, select(e_inside, zero, s_b_minus_d));
+		const Lane t_min = select(e_low, zero, select(e_inside, e / c, one));
+
+		// s >= 1.
+		const Mask be_low = b_plus_e <= zero;
+		const Mask be_inside = b_plus_e < c;
+		const Lane s_max = select(be_low, s_neg_d, select(be_inside, one, s_b_minus_d));
+		const Lane t_max = select(be_low, zero, select(be_inside, b_plus_e / c, one));
+
+		// 0 < s < 1.
+		const Mask t_low = ate <= btd;
+		const Mask t_high = t_num >= det;
+		const Lane s_mid = select(t_low, s_neg_d, select(t_high, s_b_minus_d, s_num / det));
+		const Lane t_mid = select(t_low, zero, select(t_high, one, t_num / det));
+
+		const Mask s_low = bte <= ctd;
+		const Mask s_high = s_num >= det;
+		Lane s = select(s_low, s_min, select(s_high, s_max, s_mid));
+		Lane t = select(s_low, t_min, select(s_high, t_max, t_mid));
+
+		// Parallel segments.
+		const Mask e_high = e >= c;
+		const Lane s_parallel = select(e_low, s_neg_d, select(e_high, s_b_minus_d, zero));
+		const Lane t_parallel = select(e_low, zero, select(e_high, one, e / c));
+
+		const Mask parallel = !(det > Lane::splat(CMP_EPSILON));
+		s = select(parallel, s_parallel, s);
+		t = select(parallel, t_parallel, t);
+
+		const LaneVector3 closest_A = p0 * (one - s) + p1 * s;
+		const LaneVector3 closest_B = q0 * (one - t) + q1 * t;
+
+		_sphere_sphere_contact(p_columns, no_fallback, closest_A, p_columns.get(CAPSULE_RADIUS), closest_B, p_columns.get(capsule_B + CAPSULE_RADIUS));
+	}
+}
+
+// Conservative OBB-OBB separation test (see Ericson, "Real-Time Collision Detection", 4.4.1).
+// It only proves separation, colliding boxes go through the SAT solver which also generates the contacts.
+void _kernel_box_box(LaneColumns p_columns, uint32_t p_from, uint32_t p_to) {
+	const Lane zero = Lane::splat(0.0);
+	const Lane epsilon = Lane::splat(CMP_EPSILON);
+	const Lane orthogonal_tolerance = Lane::splat(0.001);
+	const uint32_t box_B = BOX_COLUMNS;
+
+	for (uint32_t i = p_from; i < p_to; i += Lane::WIDTH) {
+		p_columns.index = i;
+
+		LaneVector3 axes_A[3];
+		LaneVector3 axes_B[3];
+		Lane extents_A[3];
+		Lane extents_B[3];
+		const LaneVector3 half_extents_A = p_columns.get_vector3(BOX_HALF_EXTENTS);
+		const LaneVector3 half_extents_B = p_columns.get_vector3(box_B + BOX_HALF_EXTENTS);
+		const Lane half_extents[2][3] = {
+			{ half_extents_A.x, half_extents_A.y, half_extents_A.z },
+			{ half_extents_B.x, half_extents_B.y, half_extents_B.z },
+		};
+
+		// Degenerate and skewed transforms are left to the solver, the test relies on orthogonal axes.
+		Mask fallback = zero < zero;
+		for (int j = 0; j < 3; j++) {
+			LaneVector3 column_A = p_columns.get_basis_column(BOX_BASIS, j);
+			LaneVector3 column_B = p_columns.get_basis_column(box_B + BOX_BASIS, j);
+			Lane length_A = lane_sqrt(column_A.dot(column_A));
+			Lane length_B = lane_sqrt(column_B.dot(column_B));
+			fallback = fallback | (length_A < epsilon) | (length_B < epsilon);
+			axes_A[j] = column_A / length_A;
+			axes_B[j] = column_B / length_B;
+			extents_A[j] = half_extents[0][j] * length_A;
+			extents_B[j] = half_extents[1][j] * length_B;
+		}
+		for (int j = 0; j < 3; j++) {
+			int k = (j + 1) % 3;
+			fallback = fallback | (lane_abs(axes_A[j].dot(axes_A[k])) > orthogonal_tolerance) | (lane_abs(axes_B[j].dot(axes_B[k])) > orthogonal_tolerance);
+		}
+
+		// Rotation matrix expressing B in A's frame, with an epsilon to counteract
+		// arithmetic errors when two edges are parallel and their cross product is near null.
+		Lane rotation[3][3];
+		Lane abs_rotation[3][3];
+		for (int j = 0; j < 3; j++) {
+			for (int k = 0; k < 3; k++) {
+				rotation[j][k] = axes_A[j].dot(axes_B[k]);
+				abs_rotation[j][k] = lane_abs(rotation[j][k]) + epsilon;
+			}
+		}
+
+		// Translation in A's frame.
+		const LaneVector3 delta = p_columns.get_vector3(box_B + BOX_ORIGIN) - p_columns.get_vector3(BOX_ORIGIN);
+		const Lane translation[3] = { delta.dot(axes_A[0]), delta.dot(axes_A[1]), delta.dot(axes_A[2]) };
+
+		Mask separated = zero < zero;
+
+		// Faces of A.
+		for (int j = 0; j < 3; j++) {
+			Lane radius_B = extents_B[0] * abs_rotation[j][0] + extents_B[1] * abs_rotation[j][1] + extents_B[2] * abs_rotation[j][2];
+			separated = separated | (lane_abs(translation[j]) > extents_A[j] + radius_B);
+		}
+
+		// Faces of B.
+		for (int k = 0; k < 3; k++) {
+			Lane radius_A = extents_A[0] * abs_rotation[0][k] + extents_A[1] * abs_rotation[1][k] + extents_A[2] * abs_rotation[2][k];
+			Lane distance = translation[0] * rotation[0][k] + translation[1] * rotation[1][k] + translation[2] * rotation[2][k];
+			separated = separated | (lane_abs(distance) > radius_A + extents_B[k]);
+		}
+
+		// Edge combinations (A_j x B_k).
+		for (int j = 0; j < 3; j++) {
+			const int j1 = (j + 1) % 3;
+			const int j2 = (j + 2) % 3;
+			for (int k = 0; k < 3; k++) {
+				const int k1 = (k + 1) % 3;
+				const int k2 = (k + 2) % 3;
+				Lane radius_A = extents_A[j1] * abs_rotation[j2][k] + extents_A[j2] * abs_rotation[j1][k];
+				Lane radius_B = extents_B[k1] * abs_rotation[j][k2] + extents_B[k2] * abs_rotation[j][k1];
+				Lane distance = translation[j2] * rotation[j1][k] - translation[j1] * rotation[j2][k];
+				separated = separated | (lane_abs(distance) > radius_A + radius_B);
+			}
+		}
+
+		Lane result = select(separated & !fallback, Lane::splat(GodotNarrowphaseBatch3D::RESULT_SEPARATED), Lane::splat(GodotNarrowphaseBatch3D::RESULT_FALLBACK));
+		p_columns.set(OUTPUT_RESULT, result);
+	}
+}
+
+typedef void (*KernelFunc)(LaneColumns, uint32_t, uint32_t);
+
+const KernelFunc kernels[GodotNarrowphaseBatch3D::PAIR_TYPE_MAX] = {
+	_kernel_sphere_sphere,
+	_kernel_sphere_box,
+	_kernel_capsule_capsule,
+	_kernel_box_box,
+};
+
+_FORCE_INLINE_ void _set_column(real_t *p_input, uint32_t p_stride, uint32_t p_column, real_t p_value) {
+	p_input[p_column * p_stride] = p_value;
+}
+
+_FORCE_INLINE_ void _set_column_vector3(real_t *p_input, uint32_t p_stride, uint32_t p_column, const Vector3 &p_value) {
+	for (int i = 0; i < 3; i++) {
+		p_input[(p_column + i) * p_stride] = p_value[i];
+	}
+}
+
+void _gather_shape(const GodotShape3D *p_shape, const Transform3D &p_xform, real_t *p_input, uint32_t p_stride, uint32_t p_column) {
+	switch (p_shape->get_type()) {
+		case PhysicsServer3D::SHAPE_SPHERE: {
+			const GodotSphereShape3D *sphere = static_cast<const GodotSphereShape3D *>(p_shape);
+			_set_column_vector3(p_input, p_stride, p_column + SPHERE_ORIGIN, p_xform.origin);
+			_set_column(p_input, p_stride, p_column + SPHERE_RADIUS, sphere->get_radius() * p_xform.basis[0].length());
+		} break;
+		case PhysicsServer3D::SHAPE_BOX: {
+			const GodotBoxShape3D *box = static_cast<const GodotBoxShape3D *>(p_shape);
+			for (int i = 0; i < 3; i++) {
+				_set_column_vector3(p_input, p_stride, p_column + BOX_BASIS + i * 3, p_xform.basis[i]);
+			}
+			_set_column_vector3(p_input, p_stride, p_column + BOX_ORIGIN, p_xform.origin);
+			_set_column_vector3(p_input, p_stride, p_column + BOX_HALF_EXTENTS, box->get_half_extents());
+		} break;
+		case PhysicsServer3D::SHAPE_CAPSULE: {
+			const GodotCapsuleShape3D *capsule = static_cast<const GodotCapsuleShape3D *>(p_shape);
+			_set_column_vector3(p_input, p_stride, p_column + CAPSULE_ORIGIN, p_xform.origin);
+			_set_column_vector3(p_input, p_stride, p_column + CAPSULE_HALF_SEGMENT, p_xform.basis.get_column(1) * (capsule->get_height() * 0.5 - capsule->get_radius()));
+			_set_column(p_input, p_stride, p_column + CAPSULE_RADIUS, capsule->get_radius() * p_xform.basis[0].length());
+		} break;
+		default: {
+			ERR_FAIL_MSG("Unsupported shape type in the narrowphase batch.");
+		}
+	}
+}
+
+uint32_t _get_shape_columns(PhysicsServer3D::ShapeType p_type) {
+	switch (p_type) {
+		case PhysicsServer3D::SHAPE_SPHERE:
+			return SPHERE_COLUMNS;
+		case PhysicsServer3D::SHAPE_BOX:
+			return BOX_COLUMNS;
+		case PhysicsServer3D::SHAPE_CAPSULE:
+			return CAPSULE_COLUMNS;
+		default:
+			return 0;
+	}
+}
+
+} // namespace
+
+bool GodotNarrowphaseBatch3D::get_pair_type(PhysicsServer3D::ShapeType p_type_A, PhysicsServer3D::ShapeType p_type_B, PairType &r_type, bool &r_swap) {
+	// Shapes are ordered by type like the collision solver does, so that results match its output.
+	r_swap = p_type_A > p_type_B;
+	if (r_swap) {
+		SWAP(p_type_A, p_type_B);
+	}
+
+	if (p_type_A == PhysicsServer3D::SHAPE_SPHERE && p_type_B == PhysicsServer3D::SHAPE_SPHERE) {
+		r_type = PAIR_SPHERE_SPHERE;
+	} else if (p_type_A == PhysicsServer3D::SHAPE_SPHERE && p_type_B == PhysicsServer3D::SHAPE_BOX) {
+		r_type = PAIR_SPHERE_BOX;
+	} else if (p_type_A == PhysicsServer3D::SHAPE_CAPSULE && p_type_B == PhysicsServer3D::SHAPE_CAPSULE) {
+		r_type = PAIR_CAPSULE_CAPSULE;
+	} else if (p_type_A == PhysicsServer3D::SHAPE_BOX && p_type_B == PhysicsServer3D::SHAPE_BOX) {
+		r_type = PAIR_BOX_BOX;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+void GodotNarrowphaseBatch3D::clear() {
+	for (Batch &batch : batches) {
+		batch.pairs.clear();
+		batch.swapped.clear();
+	}
+	blocks.clear();
+}
+
+uint32_t GodotNarrowphaseBatch3D::add_pair(PairType p_type, bool p_swap, GodotBodyPair3D *p_pair) {
+	Batch &batch = batches[p_type];
+	batch.pairs.push_back(p_pair);
+	batch.swapped.push_back(p_swap);
+	return batch.pairs.size() - 1;
+}
+
+void GodotNarrowphaseBatch3D::_gather_pair(PairType p_type, uint32_t p_index) {
+	Batch &batch = batches[p_type];
+
+	const GodotShape3D *shape_A = nullptr;
+	const GodotShape3D *shape_B = nullptr;
+	Transform3D xform_A;
+	Transform3D xform_B;
+	batch.pairs[p_index]->get_collision_shapes(shape_A, xform_A, shape_B, xform_B);
+	if (batch.swapped[p_index]) {
+		SWAP(shape_A, shape_B);
+		SWAP(xform_A, xform_B);
+	}
+
+	real_t *input = batch.input.ptr() + p_index;
+	_gather_shape(shape_A, xform_A, input, batch.stride, 0);
+	_gather_shape(shape_B, xform_B, input, batch.stride, _get_shape_columns(shape_A->get_type()));
+}
+
+void GodotNarrowphaseBatch3D::_process_block(uint32_t p_block_index, void *p_userdata) {
+	const Block &block = blocks[p_block_index];
+	Batch &batch = batches[block.type];
+
+	for (uint32_t i = block.from; i < block.to; i++) {
+		_gather_pair(block.type, i);
+	}
+
+	LaneColumns columns;
+	columns.input = batch.input.ptr();
+	columns.output = batch.output.ptr();
+	columns.stride = batch.stride;
+	// Blocks start on a lane boundary, the last lanes of a batch are padded up to the stride.
+	kernels[block.type](columns, block.from, block.to);
+}
+
+void GodotNarrowphaseBatch3D::process() {
+	blocks.clear();
+
+	for (int type = 0; type < PAIR_TYPE_MAX; type++) {
+		Batch &batch = batches[type];
+		const uint32_t count = batch.pairs.size();
+		if (count == 0) {
+			continue;
+		}
+
+		batch.stride = (count + Lane::WIDTH - 1) / Lane::WIDTH * Lane::WIDTH;
+		batch.input.resize(batch.stride * input_columns[type]);
+		batch.output.resize(batch.stride * output_columns[type]);
+
+		// Padding lanes go through the kernels too, keep their input defined.
+		for (uint32_t column = 0; column < input_columns[type]; column++) {
+			for (uint32_t i = count; i < batch.stride; i++) {
+				batch.input[column * batch.stride + i] = 0.0;
+			}
+		}
+
+		for (uint32_t from = 0; from < count; from += BLOCK_SIZE) {
+			Block block;
+			block.type = PairType(type);
+			block.from = from;
+			block.to = MIN(from + BLOCK_SIZE, count);
+			blocks.push_back(block);
+		}
+	}
+
+	if (blocks.is_empty()) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNarrowphaseBatch3D::_process_block, nullptr, blocks.size(), -1, true, SNAME("Physics3DNarrowphaseBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+GodotNarrowphaseBatch3D::Result GodotNarrowphaseBatch3D::get_result(PairType p_type, uint32_t p_index, Vector3 &r_point_A, Vector3 &r_point_B, Vector3 &r_normal) const {
+	const Batch &batch = batches[p_type];
+	ERR_FAIL_UNSIGNED_INDEX_V(p_index, batch.pairs.size(), RESULT_FALLBACK);
+
+	const real_t *output = batch.output.ptr() + p_index;
+	const uint32_t stride = batch.stride;
+	Result result = Result(int(output[OUTPUT_RESULT * stride]));
+	if (result != RESULT_CONTACT) {
+		return result;
+	}
+
+	Vector3 point_A(output[OUTPUT_POINT_A * stride], output[(OUTPUT_POINT_A + 1) * stride], output[(OUTPUT_POINT_A + 2) * stride]);
+	Vector3 point_B(output[OUTPUT_POINT_B * stride], output[(OUTPUT_POINT_B + 1) * stride], output[(OUTPUT_POINT_B + 2) * stride]);
+	Vector3 normal(output[OUTPUT_NORMAL * stride], output[(OUTPUT_NORMAL + 1) * stride], output[(OUTPUT_NORMAL + 2) * stride]);
+
+	// Same orientation and swapping as the collision solver's collector.
+	if (normal.dot(point_B - point_A) < 0) {
+		normal = -normal;
+	}
+	if (batch.swapped[p_index]) {
+		r_point_A = point_B;
+		r_point_B = point_A;
+		r_normal = -normal;
+	} else {
+		r_point_A = point_A;
+		r_point_B = point_B;
+		r_normal = normal;
+	}
+	return result;
+}
@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*  godot_narrowphase_batch_3d.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/vector3.h"
+#include "core/templates/local_vector.h"
+#include "servers/physics_3d/physics_server_3d.h"
+
+class GodotBodyPair3D;
+
+// Runs the narrowphase of the simplest primitive pairs (sphere-sphere,
+// sphere-box, capsule-capsule and box-box) several pairs at a time.
+// Pairs are gathered per type into structure-of-arrays columns, and each
+// kernel processes as many pairs per instruction as the SIMD width allows
+// (SSE2 or NEON with single precision, scalar otherwise). Results that need
+// the generic collision solver (box-box contacts, degenerate transforms)
+// are reported as RESULT_FALLBACK.
+class GodotNarrowphaseBatch3D {
+public:
+	enum PairType {
+		PAIR_SPHERE_SPHERE,
+		PAIR_SPHERE_BOX,
+		PAIR_CAPSULE_CAPSULE,
+		PAIR_BOX_BOX,
+		PAIR_TYPE_MAX
+	};
+
+	enum Result {
+		RESULT_SEPARATED,
+		RESULT_CONTACT,
+		RESULT_FALLBACK,
+	};
+
+private:
+	enum {
+		BLOCK_SIZE = 64, // Pairs per worker task, multiple of the SIMD width.
+	};
+
+	struct Batch {
+		LocalVector<GodotBodyPair3D *> pairs;
+		LocalVector<uint8_t> swapped;
+		// Columns of `stride` values each, padded to the SIMD width.
+		LocalVector<real_t> input;
+		LocalVector<real_t> output;
+		uint32_t stride = 0;
+	};
+
+	struct Block {
+		PairType type = PAIR_TYPE_MAX;
+		uint32_t from = 0;
+		uint32_t to = 0;
+	};
+
+	Batch batches[PAIR_TYPE_MAX];
+	LocalVector<Block> blocks;
+
+	void _gather_pair(PairType p_type, uint32_t p_index);
+	void _process_block(uint32_t p_block_index, void *p_userdata = nullptr);
+
+public:
+	static bool get_pair_type(PhysicsServer3D::ShapeType p_type_A, PhysicsServer3D::ShapeType p_type_B, PairType &r_type, bool &r_swap);
+
+	void clear();
+	uint32_t add_pair(PairType p_type, bool p_swap, GodotBodyPair3D *p_pair);
+	void process();
+
+	// Points and normal are given in the pair's own A/B order, like the collision solver reports them.
+	Result get_result(PairType p_type, uint32_t p_index, Vector3 &r_point_A, Vector3 &r_point_B, Vector3 &r_normal) const;
+};
@@ -43,6 +43,17 @@ Object *MultiplayerSynchronizer::_get_prop_target(Object *p_obj, const NodePath
 	return node->get_node(p_path);
 }
 
+const PropertyAccessor *MultiplayerSynchronizer::_get_prop_accessor(MultiplayerSynchronizer *p_sync, const Object *p_obj, const NodePath &p_prop) {
+	if (!p_sync) {
+		return nullptr;
+	}
+	PropertyAccessor *accessor = p_sync->property_accessors.getptr(p_prop);
+	if (!accessor || accessor->get_class_name() != p_obj->get_class_name()) {
+		accessor = &p_sync->property_accessors.insert(p_prop, ClassDB::get_property_accessor(p_obj->get_class_name(), p_prop.get_subnames()))->value;
+	}
+	return accessor;
+}
+
 void MultiplayerSynchronizer::_stop() {
 #ifdef TOOLS_ENABLED
 	if (Engine::get_singleton()->is_editor_hint()) {
@@ -154,7 +165,7 @@ PackedStringArray MultiplayerSynchronizer::get_configuration_warnings() const {
 	return warnings;
 }
 
-Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs) {
+Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs, MultiplayerSynchronizer *p_sync) {
 	ERR_FAIL_NULL_V(p_obj, ERR_INVALID_PARAMETER);
 	r_variant.resize(p_properties.size());
 	r_variant_ptrs.resize(r_variant.size());
@@ -163,7 +174,8 @@ Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Obj
 		bool valid = false;
 		const Object *obj = _get_prop_target(p_obj, prop);
 		ERR_FAIL_NULL_V(obj, FAILED);
-		r_variant.write[i] = obj->get_indexed(prop.get_subnames(), &valid);
+		const PropertyAccessor *accessor = _get_prop_accessor(p_sync, obj, prop);
+		r_variant.write[i] = accessor ? accessor->get(obj, &valid) : obj->get_indexed(prop.get_subnames(), &valid);
 		r_variant_ptrs.write[i] = &r_variant[i];
 		ERR_FAIL_COND_V_MSG(!valid, ERR_INVALID_DATA, vformat("Property '%s' not found.", prop));
 		i++;
@@ -171,13 +183,18 @@ Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Obj
 	return OK;
 }
 
-Error MultiplayerSynchronizer::set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state) {
+Error MultiplayerSynchronizer::set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state, MultiplayerSynchronizer *p_sync) {
 	ERR_FAIL_NULL_V(p_obj, ERR_INVALID_PARAMETER);
 	int i = 0;
 	for (const NodePath &prop : p_properties) {
 		Object *obj = _get_prop_target(p_obj, prop);
 		ERR_FAIL_NULL_V(obj, FAILED);
-		obj->set_indexed(prop.get_subnames(), p_state[i]);
+		const PropertyAccessor *accessor = _get_prop_accessor(p_sync, obj, prop);
+		if (accessor) {
+			accessor->set(obj, p_state[i]);
+		} else {
+			obj->set_indexed(prop.get_subnames(), p_state[i]);
+		}
 		i += 1;
 	}
 	return OK;
@@ -243,6 +260,18 @@ MultiplayerSynchronizer::VisibilityUpdateMode MultiplayerSynchronizer::get_visib
 	return visibility_update_mode;
 }
 
+void MultiplayerSynchronizer::set_interest_managed(bool p_enabled) {
+	if (interest_managed == p_enabled) {
+		return;
+	}
+	interest_managed = p_enabled;
+	update_visibility(0);
+}
+
+bool MultiplayerSynchronizer::is_interest_managed() const {
+	return interest_managed;
+}
+
 void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &MultiplayerSynchronizer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &MultiplayerSynchronizer::get_root_path);
@@ -267,6 +296,8 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("remove_visibility_filter", "filter"), &MultiplayerSynchronizer::remove_visibility_filter);
 	ClassDB::bind_method(D_METHOD("set_visibility_for", "peer", "visible"), &MultiplayerSynchronizer::set_visibility_for);
 	ClassDB::bind_method(D_METHOD("get_visibility_for", "peer"), &MultiplayerSynchronizer::get_visibility_for);
+	ClassDB::bind_method(D_METHOD("set_interest_managed", "enabled"), &MultiplayerSynchronizer::set_interest_managed);
+	ClassDB::bind_method(D_METHOD("is_interest_managed"), &MultiplayerSynchronizer::is_interest_managed);
 
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "replication_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_replication_interval", "get_replication_interval");
@@ -274,6 +305,7 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, SceneReplicationConfig::get_class_static(), PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_EDITOR_INSTANTIATE_OBJECT), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "interest_managed"), "set_interest_managed", "is_interest_managed");
 
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_PHYSICS);
@@ -330,6 +362,7 @@ double MultiplayerSynchronizer::get_delta_interval() const {
 
 void MultiplayerSynchronizer::set_replication_config(Ref<SceneReplicationConfig> p_config) {
 	replication_config = p_config;
+	property_accessors.clear();
 }
 
 Ref<SceneReplicationConfig> MultiplayerSynchronizer::get_replication_config() {
@@ -389,7 +422,7 @@ Error MultiplayerSynchronizer::_watch_changes(uint64_t p_usec) {
 		bool valid = false;
 		const Object *obj = _get_prop_target(node, prop);
 		ERR_CONTINUE_MSG(!obj, vformat("Node not found for property '%s'.", prop));
-		Variant v = obj->get_indexed(prop.get_subnames(), &valid);
+		Variant v = _get_prop_accessor(this, obj, prop)->get(obj, &valid);
 		ERR_CONTINUE_MSG(!valid, vformat("Property '%s' not found.", prop));
 		Watcher &w = ptr[idx];
 		if (w.prop != prop) {
@@ -448,6 +481,18 @@ List<NodePath> MultiplayerSynchronizer::get_delta_properties(uint64_t p_indexes)
 	return out;
 }
 
+LocalVector<SceneReplicationConfig::PropertyEncodingInfo> MultiplayerSynchronizer::get_delta_encodings(uint64_t p_indexes) {
+	LocalVector<SceneReplicationConfig::PropertyEncodingInfo> out;
+	ERR_FAIL_COND_V(replication_config.is_null(), out);
+	const LocalVector<SceneReplicationConfig::PropertyEncodingInfo> &watch_encodings = replication_config->get_watch_encodings();
+	for (uint32_t i = 0; i < watch_encodings.size(); i++) {
+		if (p_indexes & (1ULL << i)) {
+			out.push_back(watch_encodings[i]);
+		}
+	}
+	return out;
+}
+
 SceneReplicationConfig *MultiplayerSynchronizer::get_replication_config_ptr() const {
 	return replication_config.ptr();
 }
@@ -32,6 +32,7 @@
 
 #include "scene_replication_config.h"
 
+#include "core/object/class_db.h"
 #include "scene/main/node.h"
 
 class MultiplayerSynchronizer : public Node {
@@ -58,8 +59,10 @@ private:
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	bool interest_managed = false;
 	Vector<Watcher> watchers;
 	uint64_t last_watch_usec = 0;
+	HashMap<NodePath, PropertyAccessor> property_accessors; // Resolved for the class of each property's target object.
 
 	ObjectID root_node_cache;
 	uint64_t last_sync_usec = 0;
@@ -68,6 +71,7 @@ private:
 	bool sync_started = false;
 
 	static Object *_get_prop_target(Object *p_obj, const NodePath &p_prop);
+	static const PropertyAccessor *_get_prop_accessor(MultiplayerSynchronizer *p_sync, const Object *p_obj, const NodePath &p_prop);
 	void _start();
 	void _stop();
 	void _update_process();
@@ -78,8 +82,8 @@ protected:
 	void _notification(int p_what);
 
 public:
-	static Error get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs);
-	static Error set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state);
+	static Error get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs, MultiplayerSynchronizer *p_sync = nullptr);
+	static Error set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state, MultiplayerSynchronizer *p_sync = nullptr);
 
 	void reset();
 	Node *get_root_node();
@@ -115,9 +119,12 @@ public:
 	void add_visibility_filter(Callable p_callback);
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
+	void set_interest_managed(bool p_enabled);
+	bool is_interest_managed() const;
 
 	List<Variant> get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes);
 	List<NodePath> get_delta_properties(uint64_t p_indexes);
+	LocalVector<SceneReplicationConfig::PropertyEncodingInfo> get_delta_encodings(uint64_t p_indexes);
 	SceneReplicationConfig *get_replication_config_ptr() const;
 
 	MultiplayerSynchronizer();
@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*  scene_interest_grid.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_interest_grid.h"
+
+#include "core/error/error_macros.h"
+
+Vector3i SceneInterestGrid::_get_cell(const Vector3 &p_position) const {
+	return Vector3i(Math::floor(p_position.x / cell_size), Math::floor(p_position.y / cell_size), Math::floor(p_position.z / cell_size));
+}
+
+void SceneInterestGrid::_cell_insert(const ObjectID &p_id, Entry &r_entry) {
+	LocalVector<ObjectID> &cell = cells[r_entry.cell];
+	r_entry.slot = cell.size();
+	cell.push_back(p_id);
+}
+
+void SceneInterestGrid::_cell_remove(const Entry &p_entry) {
+	HashMap<Vector3i, LocalVector<ObjectID>>::Iterator E = cells.find(p_entry.cell);
+	ERR_FAIL_COND(!E); // Bug.
+	LocalVector<ObjectID> &cell = E->value;
+	ERR_FAIL_UNSIGNED_INDEX(p_entry.slot, cell.size()); // Bug.
+	const uint32_t last = cell.size() - 1;
+	if (p_entry.slot != last) {
+		// Swap with the last object, and fix its slot.
+		cell[p_entry.slot] = cell[last];
+		objects[cell[p_entry.slot]].slot = p_entry.slot;
+	}
+	cell.resize(last);
+	if (cell.is_empty()) {
+		cells.remove(E);
+	}
+}
+
+void SceneInterestGrid::set_cell_size(real_t p_size) {
+	ERR_FAIL_COND_MSG(p_size <= 0, "Interest cell size must be greater than 0.");
+	if (cell_size == p_size) {
+		return;
+	}
+	cell_size = p_size;
+	cells.clear();
+	for (KeyValue<ObjectID, Entry> &E : objects) {
+		E.value.cell = _get_cell(E.value.position);
+		_cell_insert(E.key, E.value);
+	}
+}
+
+void SceneInterestGrid::update(const ObjectID &p_id, const Vector3 &p_position) {
+	ERR_FAIL_COND(!p_position.is_finite());
+	HashMap<ObjectID, Entry>::Iterator E = objects.find(p_id);
+	if (!E) {
+		Entry &entry = objects[p_id];
+		entry.position = p_position;
+		entry.cell = _get_cell(p_position);
+		_cell_insert(p_id, entry);
+		return;
+	}
+	Entry &entry = E->value;
+	entry.position = p_position;
+	const Vector3i cell = _get_cell(p_position);
+	if (cell == entry.cell) {
+		return; // Most objects stay in their cell.
+	}
+	_cell_remove(entry);
+	entry.cell = cell;
+	_cell_insert(p_id, entry);
+}
+
+void SceneInterestGrid::remove(const ObjectID &p_id) {
+	HashMap<ObjectID, Entry>::Iterator E = objects.find(p_id);
+	if (!E) {
+		return;
+	}
+	_cell_remove(E->value);
+	objects.remove(E);
+}
+
+void SceneInterestGrid::clear() {
+	objects.clear();
+	cells.clear();
+}
+
+void SceneInterestGrid::query(const Vector3 &p_origin, real_t p_radius, HashSet<ObjectID> &r_result) const {
+	if (p_radius < 0 || objects.is_empty()) {
+		return;
+	}
+	const Vector3i from = _get_cell(p_origin - Vector3(p_radius, p_radius, p_radius));
+	const Vector3i to = _get_cell(p_origin + Vector3(p_radius, p_radius, p_radius));
+	const real_t radius_squared = p_radius * p_radius;
+	// Huge radii would visit more (mostly empty) cells than there are objects.
+	const int64_t cell_count = int64_t(to.x - from.x + 1) * (to.y - from.y + 1) * (to.z - from.z + 1);
+	if (cell_count > (int64_t)cells.size()) {
+		for (const KeyValue<Vector3i, LocalVector<ObjectID>> &E : cells) {
+			if (E.key.x < from.x || E.key.x > to.x || E.key.y < from.y || E.key.y > to.y || E.key.z < from.z || E.key.z > to.z) {
+				continue;
+			}
+			for (const ObjectID &id : E.value) {
+				if (objects[id].position.distance_squared_to(p_origin) <= radius_squared) {
+					r_result.insert(id);
+				}
+			}
+		}
+		return;
+	}
+	for (int x = from.x; x <= to.x; x++) {
+		for (int y = from.y; y <= to.y; y++) {
+			for (int z = from.z; z <= to.z; z++) {
+				const LocalVector<ObjectID> *cell = cells.getptr(Vector3i(x, y, z));
+				if (!cell) {
+					continue;
+				}
+				for (const ObjectID &id : *cell) {
+					if (objects[id].position.distance_squared_to(p_origin) <= radius_squared) {
+						r_result.insert(id);
+					}
+				}
+			}
+		}
+	}
+}
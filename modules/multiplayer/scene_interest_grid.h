@@ -0,0 +1,68 @@
+/**************************************************************************/
+/*  scene_interest_grid.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/vector3.h"
+#include "core/math/vector3i.h"
+#include "core/object/object_id.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+
+// Uniform grid of object positions, used for spatial interest management.
+// Objects are stored in hashed cells so moving them and querying an area only touches the cells involved.
+class SceneInterestGrid {
+	struct Entry {
+		Vector3 position;
+		Vector3i cell;
+		uint32_t slot = 0; // Index in the cell list.
+	};
+
+	real_t cell_size = 64;
+	HashMap<ObjectID, Entry> objects;
+	HashMap<Vector3i, LocalVector<ObjectID>> cells;
+
+	Vector3i _get_cell(const Vector3 &p_position) const;
+	void _cell_insert(const ObjectID &p_id, Entry &r_entry);
+	void _cell_remove(const Entry &p_entry);
+
+public:
+	void set_cell_size(real_t p_size);
+	real_t get_cell_size() const { return cell_size; }
+
+	void update(const ObjectID &p_id, const Vector3 &p_position);
+	void remove(const ObjectID &p_id);
+	bool has(const ObjectID &p_id) const { return objects.has(p_id); }
+	int size() const { return objects.size(); }
+	void clear();
+
+	void query(const Vector3 &p_origin, real_t p_radius, HashSet<ObjectID> &r_result) const;
+};
@@ -200,6 +200,15 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_sync_baselines_enabled(bool p_enabled);
+	bool is_sync_baselines_enabled() const;
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
+	void set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void clear_peer_interest(int p_peer);
+
 	SceneMultiplayer();
 	~SceneMultiplayer();
 };
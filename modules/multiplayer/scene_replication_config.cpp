@@ -30,7 +30,9 @@
 
 #include "scene_replication_config.h"
 
+#include "core/math/quaternion.h"
 #include "core/object/class_db.h"
+#include "scene/main/multiplayer_api.h"
 
 bool SceneReplicationConfig::_set(const StringName &p_name, const Variant &p_value) {
 	String prop_name = p_name;
@@ -54,6 +56,20 @@ bool SceneReplicationConfig::_set(const StringName &p_name, const Variant &p_val
 			ERR_FAIL_COND_V(mode < REPLICATION_MODE_NEVER || mode > REPLICATION_MODE_ON_CHANGE, false);
 			property_set_replication_mode(prop.name, mode);
 			return true;
+		} else if (what == "encoding") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::INT, false);
+			PropertyEncoding encoding = (PropertyEncoding)p_value.operator int();
+			ERR_FAIL_COND_V(encoding < PROPERTY_ENCODING_VARIANT || encoding > PROPERTY_ENCODING_PACKED, false);
+			property_set_encoding(prop.name, encoding);
+			return true;
+		} else if (what == "encoding_bits") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::INT, false);
+			property_set_encoding_bits(prop.name, p_value);
+			return true;
+		} else if (what == "encoding_range") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::VECTOR2, false);
+			property_set_encoding_range(prop.name, p_value);
+			return true;
 		}
 		ERR_FAIL_COND_V(p_value.get_type() != Variant::BOOL, false);
 		if (what == "spawn") {
@@ -89,16 +105,32 @@ bool SceneReplicationConfig::_get(const StringName &p_name, Variant &r_ret) cons
 		} else if (what == "replication_mode") {
 			r_ret = prop.mode;
 			return true;
+		} else if (what == "encoding") {
+			r_ret = prop.encoding.encoding;
+			return true;
+		} else if (what == "encoding_bits") {
+			r_ret = prop.encoding.bits;
+			return true;
+		} else if (what == "encoding_range") {
+			r_ret = prop.encoding.range;
+			return true;
 		}
 	}
 	return false;
 }
 
 void SceneReplicationConfig::_get_property_list(List<PropertyInfo> *p_list) const {
-	for (int i = 0; i < properties.size(); i++) {
+	int i = 0;
+	for (List<ReplicationProperty>::ConstIterator itr = properties.begin(); itr != properties.end(); ++itr, ++i) {
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/path", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/spawn", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::INT, "properties/" + itos(i) + "/replication_mode", PROPERTY_HINT_ENUM, "Never,Always,On Change", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		if (itr->encoding.encoding == PROPERTY_ENCODING_VARIANT) {
+			continue; // Keep existing resources unchanged.
+		}
+		p_list->push_back(PropertyInfo(Variant::INT, "properties/" + itos(i) + "/encoding", PROPERTY_HINT_ENUM, "Variant,Quantized,Quaternion,Packed", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		p_list->push_back(PropertyInfo(Variant::INT, "properties/" + itos(i) + "/encoding_bits", PROPERTY_HINT_RANGE, "1,32,1", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		p_list->push_back(PropertyInfo(Variant::VECTOR2, "properties/" + itos(i) + "/encoding_range", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 	}
 }
 
@@ -108,6 +140,8 @@ void SceneReplicationConfig::reset_state() {
 	sync_props.clear();
 	spawn_props.clear();
 	watch_props.clear();
+	sync_encodings.clear();
+	watch_encodings.clear();
 }
 
 TypedArray<NodePath> SceneReplicationConfig::get_properties() const {
@@ -224,6 +258,56 @@ void SceneReplicationConfig::property_set_replication_mode(const NodePath &p_pat
 	dirty = true;
 }
 
+SceneReplicationConfig::PropertyEncoding SceneReplicationConfig::property_get_encoding(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, PROPERTY_ENCODING_VARIANT);
+	return E->get().encoding.encoding;
+}
+
+void SceneReplicationConfig::property_set_encoding(const NodePath &p_path, PropertyEncoding p_encoding) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	if (E->get().encoding.encoding == p_encoding) {
+		return;
+	}
+	E->get().encoding.encoding = p_encoding;
+	dirty = true;
+}
+
+int SceneReplicationConfig::property_get_encoding_bits(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, 0);
+	return E->get().encoding.bits;
+}
+
+void SceneReplicationConfig::property_set_encoding_bits(const NodePath &p_path, int p_bits) {
+	ERR_FAIL_COND_MSG(p_bits < 1 || p_bits > 32, "Encoding bits must be between 1 and 32.");
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	if (E->get().encoding.bits == p_bits) {
+		return;
+	}
+	E->get().encoding.bits = p_bits;
+	dirty = true;
+}
+
+Vector2 SceneReplicationConfig::property_get_encoding_range(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, Vector2());
+	return E->get().encoding.range;
+}
+
+void SceneReplicationConfig::property_set_encoding_range(const NodePath &p_path, const Vector2 &p_range) {
+	ERR_FAIL_COND_MSG(!(p_range.x < p_range.y), "Encoding range minimum must be lower than its maximum.");
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	if (E->get().encoding.range == p_range) {
+		return;
+	}
+	E->get().encoding.range = p_range;
+	dirty = true;
+}
+
 void SceneReplicationConfig::_update() {
 	if (!dirty) {
 		return;
@@ -232,21 +316,36 @@ void SceneReplicationConfig::_update() {
 	sync_props.clear();
 	spawn_props.clear();
 	watch_props.clear();
+	sync_encodings.clear();
+	watch_encodings.clear();
+	bool sync_encoded = false;
+	bool watch_encoded = false;
 	for (const ReplicationProperty &prop : properties) {
 		if (prop.spawn) {
 			spawn_props.push_back(prop.name);
 		}
+		const bool encoded = prop.encoding.encoding != PROPERTY_ENCODING_VARIANT;
 		switch (prop.mode) {
 			case REPLICATION_MODE_ALWAYS:
 				sync_props.push_back(prop.name);
+				sync_encodings.push_back(prop.encoding);
+				sync_encoded = sync_encoded || encoded;
 				break;
 			case REPLICATION_MODE_ON_CHANGE:
 				watch_props.push_back(prop.name);
+				watch_encodings.push_back(prop.encoding);
+				watch_encoded = watch_encoded || encoded;
 				break;
 			default:
 				break;
 		}
 	}
+	if (!sync_encoded) {
+		sync_encodings.clear();
+	}
+	if (!watch_encoded) {
+		watch_encodings.clear();
+	}
 }
 
 const List<NodePath> &SceneReplicationConfig::get_spawn_properties() {
@@ -270,6 +369,290 @@ const List<NodePath> &SceneReplicationConfig::get_watch_properties() {
 	return watch_props;
 }
 
+const LocalVector<SceneReplicationConfig::PropertyEncodingInfo> &SceneReplicationConfig::get_sync_encodings() {
+	if (dirty) {
+		_update();
+	}
+	return sync_encodings;
+}
+
+const LocalVector<SceneReplicationConfig::PropertyEncodingInfo> &SceneReplicationConfig::get_watch_encodings() {
+	if (dirty) {
+		_update();
+	}
+	return watch_encodings;
+}
+
+// Bit level helpers, a null buffer only counts the bits.
+static void _write_bits(uint8_t *p_buffer, int &r_bit_ofs, uint64_t p_value, int p_bits) {
+	for (int i = 0; i < p_bits; i++) {
+		if (p_buffer) {
+			const uint8_t mask = 1 << ((r_bit_ofs + i) & 7);
+			if ((p_value >> i) & 1) {
+				p_buffer[(r_bit_ofs + i) >> 3] |= mask;
+			} else {
+				p_buffer[(r_bit_ofs + i) >> 3] &= ~mask;
+			}
+		}
+	}
+	r_bit_ofs += p_bits;
+}
+
+static bool _read_bits(const uint8_t *p_buffer, int p_len, int &r_bit_ofs, uint64_t &r_value, int p_bits) {
+	if (r_bit_ofs + p_bits > p_len * 8) {
+		return false;
+	}
+	r_value = 0;
+	for (int i = 0; i < p_bits; i++) {
+		if ((p_buffer[(r_bit_ofs + i) >> 3] >> ((r_bit_ofs + i) & 7)) & 1) {
+			r_value |= 1ULL << i;
+		}
+	}
+	r_bit_ofs += p_bits;
+	return true;
+}
+
+static uint64_t _quantize(double p_value, double p_min, double p_max, int p_bits) {
+	const uint64_t steps = (1ULL << p_bits) - 1;
+	const double t = CLAMP((p_value - p_min) / (p_max - p_min), 0.0, 1.0);
+	return MIN((uint64_t)Math::round(t * steps), steps);
+}
+
+static double _dequantize(uint64_t p_value, double p_min, double p_max, int p_bits) {
+	const uint64_t steps = (1ULL << p_bits) - 1;
+	return p_min + (p_max - p_min) * ((double)p_value / steps);
+}
+
+// Writes the "packed" flag followed by the value, or returns false when it must be sent as a Variant instead.
+static bool _pack_property(const Variant &p_value, const SceneReplicationConfig::PropertyEncodingInfo &p_info, uint8_t *p_buffer, int &r_bit_ofs) {
+	switch (p_info.encoding) {
+		case SceneReplicationConfig::PROPERTY_ENCODING_QUANTIZED: {
+			double comps[4];
+			int count = 0;
+			switch (p_value.get_type()) {
+				case Variant::FLOAT: {
+					comps[0] = p_value;
+					count = 1;
+				} break;
+				case Variant::VECTOR2: {
+					const Vector2 v = p_value;
+					comps[0] = v.x;
+					comps[1] = v.y;
+					count = 2;
+				} break;
+				case Variant::VECTOR3: {
+					const Vector3 v = p_value;
+					comps[0] = v.x;
+					comps[1] = v.y;
+					comps[2] = v.z;
+					count = 3;
+				} break;
+				case Variant::VECTOR4: {
+					const Vector4 v = p_value;
+					comps[0] = v.x;
+					comps[1] = v.y;
+					comps[2] = v.z;
+					comps[3] = v.w;
+					count = 4;
+				} break;
+				default:
+					return false;
+			}
+			const double min = p_info.range.x;
+			const double max = p_info.range.y;
+			for (int i = 0; i < count; i++) {
+				if (!Math::is_finite(comps[i]) || comps[i] < min || comps[i] > max) {
+					return false;
+				}
+			}
+			_write_bits(p_buffer, r_bit_ofs, 1, 1);
+			_write_bits(p_buffer, r_bit_ofs, count - 1, 2);
+			for (int i = 0; i < count; i++) {
+				_write_bits(p_buffer, r_bit_ofs, _quantize(comps[i], min, max, p_info.bits), p_info.bits);
+			}
+			return true;
+		}
+		case SceneReplicationConfig::PROPERTY_ENCODING_QUATERNION: {
+			if (p_value.get_type() != Variant::QUATERNION) {
+				return false;
+			}
+			const Quaternion q = p_value;
+			if (!q.is_finite() || !q.is_normalized()) {
+				return false;
+			}
+			// Smallest three: drop the largest component, the receiver rebuilds it from the unit length.
+			int largest = 0;
+			for (int i = 1; i < 4; i++) {
+				if (Math::abs(q.components[i]) > Math::abs(q.components[largest])) {
+					largest = i;
+				}
+			}
+			const double sign = q.components[largest] < 0 ? -1.0 : 1.0;
+			_write_bits(p_buffer, r_bit_ofs, 1, 1);
+			_write_bits(p_buffer, r_bit_ofs, largest, 2);
+			for (int i = 0; i < 4; i++) {
+				if (i != largest) {
+					_write_bits(p_buffer, r_bit_ofs, _quantize(q.components[i] * sign, -Math::SQRT12, Math::SQRT12, p_info.bits), p_info.bits);
+				}
+			}
+			return true;
+		}
+		case SceneReplicationConfig::PROPERTY_ENCODING_PACKED: {
+			if (p_value.get_type() == Variant::BOOL) {
+				_write_bits(p_buffer, r_bit_ofs, 1, 1);
+				_write_bits(p_buffer, r_bit_ofs, 0, 1);
+				_write_bits(p_buffer, r_bit_ofs, p_value.operator bool() ? 1 : 0, 1);
+				return true;
+			} else if (p_value.get_type() == Variant::INT) {
+				const int64_t value = p_value;
+				const int64_t min = (int64_t)p_info.range.x;
+				if (value < min || uint64_t(value) - uint64_t(min) > (1ULL << p_info.bits) - 1) {
+					return false;
+				}
+				_write_bits(p_buffer, r_bit_ofs, 1, 1);
+				_write_bits(p_buffer, r_bit_ofs, 1, 1);
+				_write_bits(p_buffer, r_bit_ofs, uint64_t(value) - uint64_t(min), p_info.bits);
+				return true;
+			}
+			return false;
+		}
+		default:
+			return false;
+	}
+}
+
+static bool _unpack_property(Variant &r_value, const SceneReplicationConfig::PropertyEncodingInfo &p_info, const uint8_t *p_buffer, int p_len, int &r_bit_ofs) {
+	uint64_t bits = 0;
+	switch (p_info.encoding) {
+		case SceneReplicationConfig::PROPERTY_ENCODING_QUANTIZED: {
+			if (!_read_bits(p_buffer, p_len, r_bit_ofs, bits, 2)) {
+				return false;
+			}
+			const int count = bits + 1;
+			double comps[4];
+			for (int i = 0; i < count; i++) {
+				if (!_read_bits(p_buffer, p_len, r_bit_ofs, bits, p_info.bits)) {
+					return false;
+				}
+				comps[i] = _dequantize(bits, p_info.range.x, p_info.range.y, p_info.bits);
+			}
+			switch (count) {
+				case 1:
+					r_value = comps[0];
+					break;
+				case 2:
+					r_value = Vector2(comps[0], comps[1]);
+					break;
+				case 3:
+					r_value = Vector3(comps[0], comps[1], comps[2]);
+					break;
+				default:
+					r_value = Vector4(comps[0], comps[1], comps[2], comps[3]);
+					break;
+			}
+			return true;
+		}
+		case SceneReplicationConfig::PROPERTY_ENCODING_QUATERNION: {
+			if (!_read_bits(p_buffer, p_len, r_bit_ofs, bits, 2)) {
+				return false;
+			}
+			const int largest = bits;
+			Quaternion q;
+			double sum = 0;
+			for (int i = 0; i < 4; i++) {
+				if (i == largest) {
+					continue;
+				}
+				if (!_read_bits(p_buffer, p_len, r_bit_ofs, bits, p_info.bits)) {
+					return false;
+				}
+				q.components[i] = _dequantize(bits, -Math::SQRT12, Math::SQRT12, p_info.bits);
+				sum += q.components[i] * q.components[i];
+			}
+			q.components[largest] = Math::sqrt(MAX(0.0, 1.0 - sum));
+			r_value = q.normalized();
+			return true;
+		}
+		case SceneReplicationConfig::PROPERTY_ENCODING_PACKED: {
+			if (!_read_bits(p_buffer, p_len, r_bit_ofs, bits, 1)) {
+				return false;
+			}
+			if (bits == 0) {
+				if (!_read_bits(p_buffer, p_len, r_bit_ofs, bits, 1)) {
+					return false;
+				}
+				r_value = bits != 0;
+				return true;
+			}
+			if (!_read_bits(p_buffer, p_len, r_bit_ofs, bits, p_info.bits)) {
+				return false;
+			}
+			r_value = int64_t(uint64_t((int64_t)p_info.range.x) + bits);
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+Error SceneReplicationConfig::encode_properties(const Variant **p_vars, const PropertyEncodingInfo *p_encodings, int p_count, uint8_t *p_buffer, int &r_len) {
+	if (!p_encodings) {
+		return MultiplayerAPI::encode_and_compress_variants(p_vars, p_count, p_buffer, r_len);
+	}
+
+	// The bit packed values come first, followed by the values that are sent as regular Variants.
+	r_len = 0;
+	int bit_ofs = 0;
+	LocalVector<const Variant *> fallback;
+	for (int i = 0; i < p_count; i++) {
+		if (p_encodings[i].encoding == PROPERTY_ENCODING_VARIANT) {
+			fallback.push_back(p_vars[i]);
+		} else if (!_pack_property(*p_vars[i], p_encodings[i], p_buffer, bit_ofs)) {
+			_write_bits(p_buffer, bit_ofs, 0, 1);
+			fallback.push_back(p_vars[i]);
+		}
+	}
+	_write_bits(p_buffer, bit_ofs, 0, (8 - (bit_ofs & 7)) & 7); // Zero padding.
+	const int packed_len = bit_ofs >> 3;
+	int variants_len = 0;
+	Error err = MultiplayerAPI::encode_and_compress_variants(fallback.ptr(), fallback.size(), p_buffer ? p_buffer + packed_len : nullptr, variants_len);
+	ERR_FAIL_COND_V(err != OK, err);
+	r_len = packed_len + variants_len;
+	return OK;
+}
+
+Error SceneReplicationConfig::decode_properties(Vector<Variant> &r_vars, const PropertyEncodingInfo *p_encodings, const uint8_t *p_buffer, int p_len, int &r_len) {
+	if (!p_encodings) {
+		return MultiplayerAPI::decode_and_decompress_variants(r_vars, p_buffer, p_len, r_len);
+	}
+
+	r_len = 0;
+	int bit_ofs = 0;
+	LocalVector<int> fallback;
+	for (int i = 0; i < r_vars.size(); i++) {
+		if (p_encodings[i].encoding == PROPERTY_ENCODING_VARIANT) {
+			fallback.push_back(i);
+			continue;
+		}
+		uint64_t packed = 0;
+		ERR_FAIL_COND_V_MSG(!_read_bits(p_buffer, p_len, bit_ofs, packed, 1), ERR_INVALID_DATA, "Invalid packet received. Size too small.");
+		if (!packed) {
+			fallback.push_back(i);
+			continue;
+		}
+		ERR_FAIL_COND_V_MSG(!_unpack_property(r_vars.write[i], p_encodings[i], p_buffer, p_len, bit_ofs), ERR_INVALID_DATA, "Invalid packet received. Unable to decode packed state variable.");
+	}
+	r_len = (bit_ofs + 7) >> 3;
+	for (const int &idx : fallback) {
+		ERR_FAIL_COND_V_MSG(r_len >= p_len, ERR_INVALID_DATA, "Invalid packet received. Size too small.");
+		int vlen;
+		Error err = MultiplayerAPI::decode_and_decompress_variant(r_vars.write[idx], &p_buffer[r_len], p_len - r_len, &vlen, false);
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Invalid packet received. Unable to decode state variable.");
+		r_len += vlen;
+	}
+	return OK;
+}
+
 void SceneReplicationConfig::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_properties"), &SceneReplicationConfig::get_properties);
 	ClassDB::bind_method(D_METHOD("add_property", "path", "index"), &SceneReplicationConfig::add_property, DEFVAL(-1));
@@ -280,11 +663,22 @@ void SceneReplicationConfig::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("property_set_spawn", "path", "enabled"), &SceneReplicationConfig::property_set_spawn);
 	ClassDB::bind_method(D_METHOD("property_get_replication_mode", "path"), &SceneReplicationConfig::property_get_replication_mode);
 	ClassDB::bind_method(D_METHOD("property_set_replication_mode", "path", "mode"), &SceneReplicationConfig::property_set_replication_mode);
+	ClassDB::bind_method(D_METHOD("property_get_encoding", "path"), &SceneReplicationConfig::property_get_encoding);
+	ClassDB::bind_method(D_METHOD("property_set_encoding", "path", "encoding"), &SceneReplicationConfig::property_set_encoding);
+	ClassDB::bind_method(D_METHOD("property_get_encoding_bits", "path"), &SceneReplicationConfig::property_get_encoding_bits);
+	ClassDB::bind_method(D_METHOD("property_set_encoding_bits", "path", "bits"), &SceneReplicationConfig::property_set_encoding_bits);
+	ClassDB::bind_method(D_METHOD("property_get_encoding_range", "path"), &SceneReplicationConfig::property_get_encoding_range);
+	ClassDB::bind_method(D_METHOD("property_set_encoding_range", "path", "range"), &SceneReplicationConfig::property_set_encoding_range);
 
 	BIND_ENUM_CONSTANT(REPLICATION_MODE_NEVER);
 	BIND_ENUM_CONSTANT(REPLICATION_MODE_ALWAYS);
 	BIND_ENUM_CONSTANT(REPLICATION_MODE_ON_CHANGE);
 
+	BIND_ENUM_CONSTANT(PROPERTY_ENCODING_VARIANT);
+	BIND_ENUM_CONSTANT(PROPERTY_ENCODING_QUANTIZED);
+	BIND_ENUM_CONSTANT(PROPERTY_ENCODING_QUATERNION);
+	BIND_ENUM_CONSTANT(PROPERTY_ENCODING_PACKED);
+
 	// Deprecated.
 	ClassDB::bind_method(D_METHOD("property_get_sync", "path"), &SceneReplicationConfig::property_get_sync);
 	ClassDB::bind_method(D_METHOD("property_set_sync", "path", "enabled"), &SceneReplicationConfig::property_set_sync);
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
 
 class SceneReplicationConfig : public Resource {
@@ -45,11 +46,25 @@ public:
 		REPLICATION_MODE_ON_CHANGE,
 	};
 
+	enum PropertyEncoding {
+		PROPERTY_ENCODING_VARIANT,
+		PROPERTY_ENCODING_QUANTIZED,
+		PROPERTY_ENCODING_QUATERNION,
+		PROPERTY_ENCODING_PACKED,
+	};
+
+	struct PropertyEncodingInfo {
+		PropertyEncoding encoding = PROPERTY_ENCODING_VARIANT;
+		int bits = 16;
+		Vector2 range = Vector2(-1024, 1024);
+	};
+
 private:
 	struct ReplicationProperty {
 		NodePath name;
 		bool spawn = true;
 		ReplicationMode mode = REPLICATION_MODE_ALWAYS;
+		PropertyEncodingInfo encoding;
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -66,6 +81,9 @@ private:
 	List<NodePath> spawn_props;
 	List<NodePath> sync_props;
 	List<NodePath> watch_props;
+	// Left empty when every property uses the plain Variant encoding.
+	LocalVector<PropertyEncodingInfo> sync_encodings;
+	LocalVector<PropertyEncodingInfo> watch_encodings;
 	bool dirty = false;
 
 	void _update();
@@ -99,11 +117,27 @@ public:
 	ReplicationMode property_get_replication_mode(const NodePath &p_path);
 	void property_set_replication_mode(const NodePath &p_path, ReplicationMode p_mode);
 
+	PropertyEncoding property_get_encoding(const NodePath &p_path);
+	void property_set_encoding(const NodePath &p_path, PropertyEncoding p_encoding);
+
+	int property_get_encoding_bits(const NodePath &p_path);
+	void property_set_encoding_bits(const NodePath &p_path, int p_bits);
+
+	Vector2 property_get_encoding_range(const NodePath &p_path);
+	void property_set_encoding_range(const NodePath &p_path, const Vector2 &p_range);
+
 	const List<NodePath> &get_spawn_properties();
 	const List<NodePath> &get_sync_properties();
 	const List<NodePath> &get_watch_properties();
+	const LocalVector<PropertyEncodingInfo> &get_sync_encodings();
+	const LocalVector<PropertyEncodingInfo> &get_watch_encodings();
+
+	// Passing no encodings falls back to MultiplayerAPI::encode_and_compress_variants, keeping the plain wire format.
+	static Error encode_properties(const Variant **p_vars, const PropertyEncodingInfo *p_encodings, int p_count, uint8_t *p_buffer, int &r_len);
+	static Error decode_properties(Vector<Variant> &r_vars, const PropertyEncodingInfo *p_encodings, const uint8_t *p_buffer, int p_len, int &r_len);
 
 	SceneReplicationConfig() {}
 };
 
 VARIANT_ENUM_CAST(SceneReplicationConfig::ReplicationMode);
+VARIANT_ENUM_CAST(SceneReplicationConfig::PropertyEncoding);
@@ -36,6 +36,8 @@
 #include "core/io/marshalls.h"
 #include "core/object/callable_mp.h"
 #include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/3d/node_3d.h"
 #include "scene/main/node.h"
 
 #define MAKE_ROOM(m_amount) \
@@ -87,7 +89,7 @@ void SceneReplicationInterface::_free_remotes(const PeerInfo &p_info) {
 	}
 }
 
-bool SceneReplicationInterface::_has_authority(const Node *p_node) {
+bool SceneReplicationInterface::_has_authority(const Node *p_node) const {
 	return multiplayer->has_multiplayer_peer() && p_node->get_multiplayer_authority() == multiplayer->get_unique_id();
 }
 
@@ -112,6 +114,8 @@ void SceneReplicationInterface::on_reset() {
 		_free_remotes(E.value);
 	}
 	peers_info.clear();
+	interest_grid.clear();
+	recv_baselines.clear();
 	// Tracked nodes are cleared on deletion, here we only reset the ids so they can be later re-assigned.
 	for (KeyValue<ObjectID, TrackedNode> &E : tracked_nodes) {
 		TrackedNode &tobj = E.value;
@@ -142,13 +146,21 @@ void SceneReplicationInterface::on_network_process() {
 
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
+	encoded_states.clear();
+	encoded_syncs.clear();
+	encoded_deltas.clear();
+	_update_interest();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		const HashSet<ObjectID> to_sync(E.value.sync_nodes);
 		if (to_sync.is_empty()) {
 			continue; // Nothing to sync
 		}
-		uint16_t sync_net_time = ++E.value.last_sent_sync;
-		_send_sync(E.key, to_sync, sync_net_time, usec);
+		if (sync_baselines) {
+			_send_sync_baselines(E.key, E.value, to_sync, usec);
+		} else {
+			uint16_t sync_net_time = ++E.value.last_sent_sync;
+			_send_sync(E.key, to_sync, sync_net_time, usec);
+		}
 		_send_delta(E.key, to_sync, usec, E.value.last_watch_usecs);
 	}
 }
@@ -258,7 +270,7 @@ Error SceneReplicationInterface::on_replication_start(Object *p_obj, Variant p_c
 			if (consumed > 0) {
 				pending_buffer += consumed;
 				pending_buffer_size -= consumed;
-				err = MultiplayerSynchronizer::set_state(props, node, vars);
+				err = MultiplayerSynchronizer::set_state(props, node, vars, sync);
 				ERR_FAIL_COND_V(err, err);
 			}
 		}
@@ -279,9 +291,13 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	TrackedNode &tobj = _track(oid);
 	tobj.synchronizers.erase(sid);
 	sync_nodes.erase(sid);
+	interest_grid.remove(sid);
+	recv_baselines.erase(sid);
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(sid);
 		E.value.last_watch_usecs.erase(sid);
+		E.value.interest_syncs.erase(sid);
+		E.value.sync_baselines.erase(sid);
 		if (sync->get_net_id()) {
 			E.value.recv_sync_ids.erase(sync->get_net_id());
 		}
@@ -301,6 +317,73 @@ void SceneReplicationInterface::_visibility_changed(int p_peer, ObjectID p_sid)
 	_update_sync_visibility(p_peer, sync);
 }
 
+bool SceneReplicationInterface::_is_visible_to(MultiplayerSynchronizer *p_sync, int p_peer) const {
+	if (p_sync->is_interest_managed() && _has_authority(p_sync)) {
+		// Only visible to peers whose interest area contains it.
+		// Interest is only tracked for synchronizers we have authority over, so it doesn't restrict remote ones.
+		const PeerInfo *info = p_peer > 0 ? peers_info.getptr(p_peer) : nullptr;
+		if (!info || !info->interest_syncs.has(p_sync->get_instance_id())) {
+			return false;
+		}
+	}
+	return p_sync->is_visible_to(p_peer);
+}
+
+void SceneReplicationInterface::_update_interest() {
+	// Track the positions of the interest managed synchronizers we have authority over.
+	for (const ObjectID &sid : sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		Node *node = sync ? sync->get_root_node() : nullptr;
+		if (!node || !sync->is_interest_managed() || !_has_authority(sync)) {
+			interest_grid.remove(sid);
+			continue;
+		}
+		if (const Node3D *node_3d = Object::cast_to<Node3D>(node)) {
+			interest_grid.update(sid, node_3d->get_global_position());
+		} else if (const Node2D *node_2d = Object::cast_to<Node2D>(node)) {
+			const Vector2 position = node_2d->get_global_position();
+			interest_grid.update(sid, Vector3(position.x, position.y, 0));
+		} else {
+			interest_grid.remove(sid);
+		}
+	}
+
+	// Only update the visibility of synchronizers entering or leaving each peer's area.
+	LocalVector<ObjectID> changed;
+	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		PeerInfo &info = E.value;
+		if (!info.has_interest && info.interest_syncs.is_empty()) {
+			continue;
+		}
+		HashSet<ObjectID> in_area;
+		if (info.has_interest) {
+			interest_grid.query(info.interest_origin, info.interest_radius, in_area);
+		}
+		changed.clear();
+		for (const ObjectID &sid : info.interest_syncs) {
+			if (!in_area.has(sid)) {
+				changed.push_back(sid);
+			}
+		}
+		for (const ObjectID &sid : in_area) {
+			if (!info.interest_syncs.has(sid)) {
+				changed.push_back(sid);
+			}
+		}
+		if (changed.is_empty()) {
+			continue;
+		}
+		info.interest_syncs = std::move(in_area);
+		for (const ObjectID &sid : changed) {
+			MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+			if (!sync || !sync->get_root_node()) {
+				continue;
+			}
+			_visibility_changed(E.key, sid);
+		}
+	}
+}
+
 bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer) const {
 	if (!tracked_nodes.has(p_oid)) {
 		return true; // Untracked nodes are always visible to RPCs.
@@ -332,7 +415,7 @@ bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer
 			// RPC visibility is composed using OR when multiple synchronizers are present.
 			// Note that we don't really care about authority here which may lead to unexpected
 			// results when using multiple synchronizers to control the same node.
-			if (sync->is_visible_to(p_peer)) {
+			if (_is_visible_to(sync, p_peer)) {
 				return true;
 			}
 		}
@@ -347,11 +430,11 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 	}
 
 	const ObjectID &sid = p_sync->get_instance_id();
-	bool is_visible = p_sync->is_visible_to(p_peer);
+	bool is_visible = _is_visible_to(p_sync, p_peer);
 	if (p_peer == 0) {
 		for (KeyValue<int, PeerInfo> &E : peers_info) {
 			// Might be visible to this specific peer.
-			bool is_visible_to_peer = is_visible || p_sync->is_visible_to(E.key);
+			bool is_visible_to_peer = is_visible || _is_visible_to(p_sync, E.key);
 			if (is_visible_to_peer == E.value.sync_nodes.has(sid)) {
 				continue;
 			}
@@ -360,6 +443,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 			} else {
 				E.value.sync_nodes.erase(sid);
 				E.value.last_watch_usecs.erase(sid);
+				E.value.sync_baselines.erase(sid);
 			}
 		}
 		return OK;
@@ -373,6 +457,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 		} else {
 			peers_info[p_peer].sync_nodes.erase(sid);
 			peers_info[p_peer].last_watch_usecs.erase(sid);
+			peers_info[p_peer].sync_baselines.erase(sid);
 		}
 		return OK;
 	}
@@ -396,7 +481,7 @@ Error SceneReplicationInterface::_update_spawn_visibility(int p_peer, const Obje
 			continue;
 		}
 		// Spawn visibility is composed using OR when multiple synchronizers are present.
-		if (sync->is_visible_to(p_peer)) {
+		if (_is_visible_to(sync, p_peer)) {
 			is_visible = true;
 			break;
 		}
@@ -707,6 +792,69 @@ MultiplayerSynchronizer *SceneReplicationInterface::_find_synchronizer(int p_pee
 	return sync;
 }
 
+Error SceneReplicationInterface::_encode_state(const Variant **p_vars, const SceneReplicationConfig::PropertyEncodingInfo *p_encodings, int p_count, EncodedState &r_state) {
+	int size;
+	Error err = SceneReplicationConfig::encode_properties(p_vars, p_encodings, p_count, nullptr, size);
+	ERR_FAIL_COND_V(err != OK, err);
+	r_state.offset = encoded_states.size();
+	encoded_states.resize(r_state.offset + size);
+	err = SceneReplicationConfig::encode_properties(p_vars, p_encodings, p_count, encoded_states.ptr() + r_state.offset, size);
+	ERR_FAIL_COND_V(err != OK, err);
+	r_state.size = size;
+	return OK;
+}
+
+const SceneReplicationInterface::EncodedState &SceneReplicationInterface::_get_encoded_sync(MultiplayerSynchronizer *p_sync, Node *p_node) {
+	const ObjectID oid = p_sync->get_instance_id();
+	if (const EncodedState *cached = encoded_syncs.getptr(oid)) {
+		return *cached;
+	}
+
+	EncodedState &state = encoded_syncs[oid];
+	Vector<Variant> vars;
+	Vector<const Variant *> varp;
+	SceneReplicationConfig *config = p_sync->get_replication_config_ptr();
+	const List<NodePath> props(config->get_sync_properties());
+	Error err = MultiplayerSynchronizer::get_state(props, p_node, vars, varp, p_sync);
+	ERR_FAIL_COND_V_MSG(err != OK, state, "Unable to retrieve sync state.");
+	const LocalVector<SceneReplicationConfig::PropertyEncodingInfo> &encodings = config->get_sync_encodings();
+	err = _encode_state(varp.ptrw(), encodings.is_empty() ? nullptr : encodings.ptr(), varp.size(), state);
+	ERR_FAIL_COND_V_MSG(err != OK, state, "Unable to encode sync state.");
+	return state;
+}
+
+const SceneReplicationInterface::EncodedState &SceneReplicationInterface::_get_encoded_delta(MultiplayerSynchronizer *p_sync, uint64_t p_usec, uint64_t p_last_usec) {
+	// Peers that received the previous changes at the same time get the same delta.
+	LocalVector<EncodedState> &states = encoded_deltas[p_sync->get_instance_id()];
+	for (const EncodedState &cached : states) {
+		if (cached.last_watch_usec == p_last_usec) {
+			return cached;
+		}
+	}
+
+	states.push_back(EncodedState());
+	EncodedState &state = states[states.size() - 1];
+	state.last_watch_usec = p_last_usec;
+
+	List<Variant> delta = p_sync->get_delta_state(p_usec, p_last_usec, state.indexes);
+	if (!delta.size()) {
+		return state; // Nothing to update.
+	}
+
+	Vector<const Variant *> varp;
+	varp.resize(delta.size());
+	const Variant **vptr = varp.ptrw();
+	int i = 0;
+	for (const Variant &v : delta) {
+		vptr[i] = &v;
+		i++;
+	}
+	const LocalVector<SceneReplicationConfig::PropertyEncodingInfo> encodings = p_sync->get_delta_encodings(state.indexes);
+	Error err = _encode_state(vptr, encodings.is_empty() ? nullptr : encodings.ptr(), varp.size(), state);
+	ERR_FAIL_COND_V_MSG(err != OK, state, "Unable to encode delta state.");
+	return state;
+}
+
 void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs) {
 	MAKE_ROOM(/* header */ 1 + /* element */ 4 + 8 + 4 + delta_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
@@ -720,25 +868,12 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			continue;
 		}
 		uint64_t last_usec = p_last_watch_usecs.has(oid) ? p_last_watch_usecs[oid] : 0;
-		uint64_t indexes;
-		List<Variant> delta = sync->get_delta_state(p_usec, last_usec, indexes);
-
-		if (!delta.size()) {
+		const EncodedState &state = _get_encoded_delta(sync, p_usec, last_usec);
+		if (state.size < 0) {
 			continue; // Nothing to update.
 		}
 
-		Vector<const Variant *> varp;
-		varp.resize(delta.size());
-		const Variant **vptr = varp.ptrw();
-		int i = 0;
-		for (const Variant &v : delta) {
-			vptr[i] = &v;
-			i++;
-		}
-		int size;
-		Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
-		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
-
+		const int size = state.size;
 		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
 
 		if (ofs + 4 + 8 + 4 + size > delta_mtu) {
@@ -748,9 +883,9 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 		}
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
-			ofs += encode_uint64(indexes, &ptr[ofs]);
+			ofs += encode_uint64(state.indexes, &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), &ptr[ofs], size);
+			memcpy(&ptr[ofs], encoded_states.ptr() + state.offset, size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -784,11 +919,12 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 		ERR_FAIL_COND_V(props.is_empty(), ERR_INVALID_DATA);
 		Vector<Variant> vars;
 		vars.resize(props.size());
+		const LocalVector<SceneReplicationConfig::PropertyEncodingInfo> encodings = sync->get_delta_encodings(indexes);
 		int consumed = 0;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, p_buffer + ofs, size, consumed);
+		Error err = SceneReplicationConfig::decode_properties(vars, encodings.is_empty() ? nullptr : encodings.ptr(), p_buffer + ofs, size, consumed);
 		ERR_FAIL_COND_V(err != OK, err);
 		ERR_FAIL_COND_V(uint32_t(consumed) != size, ERR_INVALID_DATA);
-		err = MultiplayerSynchronizer::set_state(props, node, vars);
+		err = MultiplayerSynchronizer::set_state(props, node, vars, sync);
 		ERR_FAIL_COND_V(err != OK, err);
 		ofs += size;
 		sync->emit_signal(SNAME("delta_synchronized"));
@@ -806,7 +942,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 	int ofs = 1;
 	ofs += encode_uint16(p_sync_net_time, &ptr[1]);
 	// Can only send updates for already notified nodes.
-	// This is a lazy implementation, we could optimize much more here with by grouping by replication config.
+	// States are encoded once per tick, only the packet layout differs between peers.
 	for (const ObjectID &oid : p_synchronizers) {
 		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(oid);
 		ERR_CONTINUE(!sync || !sync->get_replication_config_ptr() || !_has_authority(sync));
@@ -821,14 +957,11 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 			// The path based sync is not yet confirmed, skipping.
 			continue;
 		}
-		int size;
-		Vector<Variant> vars;
-		Vector<const Variant *> varp;
-		const List<NodePath> props(sync->get_replication_config_ptr()->get_sync_properties());
-		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
-		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
-		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
+		const EncodedState &state = _get_encoded_sync(sync, node);
+		if (state.size < 0) {
+			continue; // Could not be encoded.
+		}
+		const int size = state.size;
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
 		if (ofs + 4 + 4 + size > sync_mtu) {
@@ -839,7 +972,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			memcpy(&ptr[ofs], encoded_states.ptr() + state.offset, size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -853,11 +986,19 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 }
 
 Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	if (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_2_SHIFT)) {
+		ERR_FAIL_COND_V_MSG(p_buffer_len != 3, ERR_INVALID_DATA, "Invalid sync acknowledgment received");
+		_on_sync_ack(p_from, decode_uint16(&p_buffer[1]));
+		return OK;
+	}
 	ERR_FAIL_COND_V_MSG(p_buffer_len < 11, ERR_INVALID_DATA, "Invalid sync packet received");
 	bool is_delta = (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT)) != 0;
 	if (is_delta) {
 		return on_delta_receive(p_from, p_buffer, p_buffer_len);
 	}
+	if (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT)) {
+		return _on_sync_baselines_receive(p_from, p_buffer, p_buffer_len);
+	}
 	uint16_t time = decode_uint16(&p_buffer[1]);
 	int ofs = 3;
 	while (ofs + 8 < p_buffer_len) {
@@ -883,16 +1024,9 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 			ofs += size;
 			continue;
 		}
-		const List<NodePath> props(sync->get_replication_config_ptr()->get_sync_properties());
-		Vector<Variant> vars;
-		vars.resize(props.size());
-		int consumed;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
-		ERR_FAIL_COND_V(err, err);
-		err = MultiplayerSynchronizer::set_state(props, node, vars);
+		Error err = _apply_sync_state(sync, node, &p_buffer[ofs], size);
 		ERR_FAIL_COND_V(err, err);
 		ofs += size;
-		sync->emit_signal(SNAME("synchronized"));
 #ifdef DEBUG_ENABLED
 		_profile_node_data("sync_in", sync->get_instance_id(), size);
 #endif
@@ -900,6 +1034,194 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 	return OK;
 }
 
+Error SceneReplicationInterface::_apply_sync_state(MultiplayerSynchronizer *p_sync, Node *p_node, const uint8_t *p_state, int p_size) {
+	SceneReplicationConfig *config = p_sync->get_replication_config_ptr();
+	const List<NodePath> props(config->get_sync_properties());
+	const LocalVector<SceneReplicationConfig::PropertyEncodingInfo> &encodings = config->get_sync_encodings();
+	Vector<Variant> vars;
+	vars.resize(props.size());
+	int consumed;
+	Error err = SceneReplicationConfig::decode_properties(vars, encodings.is_empty() ? nullptr : encodings.ptr(), p_state, p_size, consumed);
+	ERR_FAIL_COND_V(err, err);
+	err = MultiplayerSynchronizer::set_state(props, p_node, vars, p_sync);
+	ERR_FAIL_COND_V(err, err);
+	p_sync->emit_signal(SNAME("synchronized"));
+	return OK;
+}
+
+void SceneReplicationInterface::_send_sync_baselines(int p_peer, PeerInfo &r_info, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec) {
+	MAKE_ROOM(/* header */ 3 + /* element */ 4 + 1 + 2 + 4 + sync_mtu);
+	uint8_t *ptr = packet_cache.ptrw();
+	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT);
+	if (r_info.sent_packets.is_empty()) {
+		r_info.sent_packets.resize(SYNC_PACKET_HISTORY);
+	}
+	// Each packet has its own sequence, so it can be acknowledged on its own.
+	uint16_t seq = ++r_info.last_sent_sync;
+	SentPacket *packet = &r_info.sent_packets[seq % SYNC_PACKET_HISTORY];
+	packet->seq = seq;
+	packet->syncs.clear();
+	int ofs = 1;
+	ofs += encode_uint16(seq, &ptr[1]);
+	for (const ObjectID &oid : p_synchronizers) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(oid);
+		ERR_CONTINUE(!sync || !sync->get_replication_config_ptr() || !_has_authority(sync));
+		if (!sync->update_outbound_sync_time(p_usec)) {
+			continue; // nothing to sync.
+		}
+
+		Node *node = sync->get_root_node();
+		ERR_CONTINUE(!node);
+		uint32_t net_id = sync->get_net_id();
+		if (!_verify_synchronizer(p_peer, sync, net_id)) {
+			// The path based sync is not yet confirmed, skipping.
+			continue;
+		}
+		const EncodedState &state = _get_encoded_sync(sync, node);
+		if (state.size < 0) {
+			continue; // Could not be encoded.
+		}
+		const uint8_t *data = encoded_states.ptr() + state.offset;
+
+		SceneSyncBaselines::Outbound &baseline = r_info.sync_baselines[oid];
+		if (baseline.is_acked(data, state.size)) {
+			continue; // The peer acknowledged this state and nothing else was sent since.
+		}
+		uint16_t base_seq = 0;
+		const uint8_t *base = baseline.get_diff_base(state.size, base_seq);
+		int size = base ? SceneSyncBaselines::encode_diff(data, base, state.size, nullptr) : state.size;
+		if (base && size >= state.size) {
+			base = nullptr;
+			size = state.size;
+		}
+		// TODO Handle single state above MTU.
+		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		if (ofs + 4 + 1 + 2 + 4 + size > sync_mtu) {
+			// Send what we got, and reset write.
+			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+			seq = ++r_info.last_sent_sync;
+			packet = &r_info.sent_packets[seq % SYNC_PACKET_HISTORY];
+			packet->seq = seq;
+			packet->syncs.clear();
+			encode_uint16(seq, &ptr[1]);
+			ofs = 3;
+		}
+		ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
+		ptr[ofs++] = base ? 1 : 0;
+		if (base) {
+			ofs += encode_uint16(base_seq, &ptr[ofs]);
+		}
+		ofs += encode_uint32(size, &ptr[ofs]);
+		if (base) {
+			SceneSyncBaselines::encode_diff(data, base, state.size, &ptr[ofs]);
+		} else {
+			memcpy(&ptr[ofs], data, size);
+		}
+		ofs += size;
+
+		// Keep the state until the peer acknowledges (or misses) it.
+		baseline.push_sent(seq, data, state.size);
+		packet->syncs.push_back(oid);
+#ifdef DEBUG_ENABLED
+		_profile_node_data("sync_out", oid, size);
+#endif
+	}
+	if (ofs > 3) {
+		// Got some left over to send.
+		_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+	}
+}
+
+Error SceneReplicationInterface::_on_sync_baselines_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	const uint16_t seq = decode_uint16(&p_buffer[1]);
+	// Only acknowledge packets whose states were all stored, since they become baselines for the sender.
+	bool complete = true;
+	LocalVector<uint8_t> state;
+	int ofs = 3;
+	while (ofs + 4 + 1 + 4 <= p_buffer_len) {
+		uint32_t net_id = decode_uint32(&p_buffer[ofs]);
+		ofs += 4;
+		const uint8_t kind = p_buffer[ofs++];
+		ERR_FAIL_COND_V(kind > 1, ERR_INVALID_DATA);
+		uint16_t base_seq = 0;
+		if (kind) {
+			ERR_FAIL_COND_V(ofs + 2 + 4 > p_buffer_len, ERR_INVALID_DATA);
+			base_seq = decode_uint16(&p_buffer[ofs]);
+			ofs += 2;
+		}
+		uint32_t size = decode_uint32(&p_buffer[ofs]);
+		ofs += 4;
+		ERR_FAIL_COND_V(size > uint32_t(p_buffer_len - ofs), ERR_INVALID_DATA);
+		const uint8_t *payload = &p_buffer[ofs];
+		ofs += size;
+
+		MultiplayerSynchronizer *sync = _find_synchronizer(p_from, net_id);
+		if (!sync) {
+			// Not received yet.
+			complete = false;
+			continue;
+		}
+		Node *node = sync->get_root_node();
+		if (sync->get_multiplayer_authority() != p_from || !node) {
+			// Not valid for me.
+			complete = false;
+			ERR_CONTINUE_MSG(true, "Ignoring sync data from non-authority or for missing node.");
+		}
+		SceneSyncBaselines::Inbound &history = recv_baselines[sync->get_instance_id()];
+		if (kind) {
+			const LocalVector<uint8_t> *base = history.get_state(base_seq);
+			if (!base) {
+				// Baseline is gone, wait for the sender to send the full state.
+				complete = false;
+				continue;
+			}
+			state.resize(base->size());
+			if (!SceneSyncBaselines::decode_diff(payload, size, base->ptr(), base->size(), state.ptr())) {
+				complete = false;
+				ERR_CONTINUE_MSG(true, "Invalid sync diff received.");
+			}
+		} else {
+			state.resize(size);
+			memcpy(state.ptr(), payload, size);
+		}
+		history.push(seq, state.ptr(), state.size());
+
+		if (!sync->update_inbound_sync_time(seq)) {
+			continue; // State is too old, but still usable as a baseline.
+		}
+		Error err = _apply_sync_state(sync, node, state.ptr(), state.size());
+		ERR_FAIL_COND_V(err, err);
+#ifdef DEBUG_ENABLED
+		_profile_node_data("sync_in", sync->get_instance_id(), size);
+#endif
+	}
+	if (complete) {
+		uint8_t ack[3];
+		ack[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_2_SHIFT);
+		encode_uint16(seq, &ack[1]);
+		_send_raw(ack, 3, p_from, false);
+	}
+	return OK;
+}
+
+void SceneReplicationInterface::_on_sync_ack(int p_from, uint16_t p_seq) {
+	PeerInfo *info = peers_info.getptr(p_from);
+	if (!info || info->sent_packets.is_empty()) {
+		return;
+	}
+	SentPacket &packet = info->sent_packets[p_seq % SYNC_PACKET_HISTORY];
+	if (packet.seq != p_seq) {
+		return; // Too old.
+	}
+	for (const ObjectID &oid : packet.syncs) {
+		SceneSyncBaselines::Outbound *baseline = info->sync_baselines.getptr(oid);
+		if (baseline) {
+			baseline->ack(p_seq);
+		}
+	}
+	packet.syncs.clear();
+}
+
 void SceneReplicationInterface::set_max_sync_packet_size(int p_size) {
 	ERR_FAIL_COND_MSG(p_size < 128, "Sync maximum packet size must be at least 128 bytes.");
 	sync_mtu = p_size;
@@ -917,3 +1239,34 @@ void SceneReplicationInterface::set_max_delta_packet_size(int p_size) {
 int SceneReplicationInterface::get_max_delta_packet_size() const {
 	return delta_mtu;
 }
+
+void SceneReplicationInterface::set_sync_baselines_enabled(bool p_enabled) {
+	sync_baselines = p_enabled;
+}
+
+bool SceneReplicationInterface::is_sync_baselines_enabled() const {
+	return sync_baselines;
+}
+
+void SceneReplicationInterface::set_interest_cell_size(real_t p_size) {
+	interest_grid.set_cell_size(p_size);
+}
+
+real_t SceneReplicationInterface::get_interest_cell_size() const {
+	return interest_grid.get_cell_size();
+}
+
+void SceneReplicationInterface::set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius) {
+	ERR_FAIL_COND_MSG(p_radius < 0, "Interest radius must be greater or equal to 0.");
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_MSG(info, vformat("Unknown peer: %d.", p_peer));
+	info->has_interest = true;
+	info->interest_origin = p_origin;
+	info->interest_radius = p_radius;
+}
+
+void SceneReplicationInterface::clear_peer_interest(int p_peer) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_MSG(info, vformat("Unknown peer: %d.", p_peer));
+	info->has_interest = false;
+}
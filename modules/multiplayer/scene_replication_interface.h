@@ -32,6 +32,8 @@
 
 #include "multiplayer_spawner.h"
 #include "multiplayer_synchronizer.h"
+#include "scene_interest_grid.h"
+#include "scene_sync_baselines.h"
 
 #include "core/object/ref_counted.h"
 #include "core/templates/rb_set.h"
@@ -60,6 +62,14 @@ private:
 		}
 	};
 
+	// Sync states are diffed against the last state acknowledged by each peer, when baselines are enabled.
+	static constexpr int SYNC_PACKET_HISTORY = 64; // Must divide 65536.
+
+	struct SentPacket {
+		uint16_t seq = 0;
+		LocalVector<ObjectID> syncs;
+	};
+
 	struct PeerInfo {
 		HashSet<ObjectID> sync_nodes;
 		HashSet<ObjectID> spawn_nodes;
@@ -67,6 +77,16 @@ private:
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
+
+		// Spatial interest management.
+		bool has_interest = false;
+		Vector3 interest_origin;
+		real_t interest_radius = 0;
+		HashSet<ObjectID> interest_syncs; // Interest managed synchronizers inside the area.
+
+		// Sync baselines.
+		HashMap<ObjectID, SceneSyncBaselines::Outbound> sync_baselines;
+		LocalVector<SentPacket> sent_packets; // Indexed by sequence modulo SYNC_PACKET_HISTORY.
 	};
 
 	// Replication state.
@@ -75,6 +95,8 @@ private:
 	HashMap<ObjectID, TrackedNode> tracked_nodes;
 	RBSet<ObjectID> spawned_nodes;
 	HashSet<ObjectID> sync_nodes;
+	SceneInterestGrid interest_grid;
+	HashMap<ObjectID, SceneSyncBaselines::Inbound> recv_baselines; // Last states received for each synchronizer.
 
 	// Pending local spawn information (handles spawning nested nodes during ready).
 	HashSet<ObjectID> spawn_queue;
@@ -92,22 +114,45 @@ private:
 	PackedByteArray packet_cache;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
+	bool sync_baselines = false;
+
+	// Synchronizer states encoded once per network tick, and copied into the packets of every peer that receives them.
+	struct EncodedState {
+		uint64_t last_watch_usec = 0; // Deltas depend on when the peer last received them.
+		uint64_t indexes = 0;
+		int offset = 0;
+		int size = -1; // Nothing to send.
+	};
+
+	LocalVector<uint8_t> encoded_states;
+	HashMap<ObjectID, EncodedState> encoded_syncs;
+	HashMap<ObjectID, LocalVector<EncodedState>> encoded_deltas;
 
 	TrackedNode &_track(const ObjectID &p_id);
 	void _untrack(const ObjectID &p_id);
 	void _node_ready(const ObjectID &p_oid);
 
-	bool _has_authority(const Node *p_node);
+	bool _has_authority(const Node *p_node) const;
 	bool _verify_synchronizer(int p_peer, MultiplayerSynchronizer *p_sync, uint32_t &r_net_id);
 	MultiplayerSynchronizer *_find_synchronizer(int p_peer, uint32_t p_net_ida);
 
+	Error _encode_state(const Variant **p_vars, const SceneReplicationConfig::PropertyEncodingInfo *p_encodings, int p_count, EncodedState &r_state);
+	const EncodedState &_get_encoded_sync(MultiplayerSynchronizer *p_sync, Node *p_node);
+	const EncodedState &_get_encoded_delta(MultiplayerSynchronizer *p_sync, uint64_t p_usec, uint64_t p_last_usec);
+
 	void _send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
+	void _send_sync_baselines(int p_peer, PeerInfo &r_info, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec);
 	void _send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs);
 	Error _make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len);
 	Error _make_despawn_packet(Node *p_node, int &r_len);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
+	Error _apply_sync_state(MultiplayerSynchronizer *p_sync, Node *p_node, const uint8_t *p_state, int p_size);
+	Error _on_sync_baselines_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
+	void _on_sync_ack(int p_from, uint16_t p_seq);
 
 	void _visibility_changed(int p_peer, ObjectID p_oid);
+	bool _is_visible_to(MultiplayerSynchronizer *p_sync, int p_peer) const;
+	void _update_interest();
 	Error _update_sync_visibility(int p_peer, MultiplayerSynchronizer *p_sync);
 	Error _update_spawn_visibility(int p_peer, const ObjectID &p_oid);
 	void _free_remotes(const PeerInfo &p_info);
@@ -146,6 +191,15 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_sync_baselines_enabled(bool p_enabled);
+	bool is_sync_baselines_enabled() const;
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
+	void set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void clear_peer_interest(int p_peer);
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
@@ -0,0 +1,168 @@
+/**************************************************************************/
+/*  scene_sync_baselines.cpp                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_sync_baselines.h"
+
+#include <cstring>
+
+bool SceneSyncBaselines::Outbound::is_acked(const uint8_t *p_state, int p_size) const {
+	// Only when nothing else was sent since, or the receiver may be holding a newer state.
+	return has_acked && sent_since_ack == 0 && acked.state.size() == uint32_t(p_size) && memcmp(p_state, acked.state.ptr(), p_size) == 0;
+}
+
+const uint8_t *SceneSyncBaselines::Outbound::get_diff_base(int p_size, uint16_t &r_seq) const {
+	// The receiver drops its oldest states first, so the acknowledged one is kept while fewer than WINDOW were sent after it.
+	if (!has_acked || acked.state.size() != uint32_t(p_size) || sent_since_ack >= WINDOW) {
+		return nullptr;
+	}
+	r_seq = acked.seq;
+	return acked.state.ptr();
+}
+
+void SceneSyncBaselines::Outbound::push_sent(uint16_t p_seq, const uint8_t *p_state, int p_size) {
+	if (sent.size() >= WINDOW) {
+		// Too many states after it for the receiver to still have it.
+		sent.remove_at(0);
+	}
+	sent.push_back(Snapshot());
+	Snapshot &snapshot = sent[sent.size() - 1];
+	snapshot.seq = p_seq;
+	snapshot.state.resize(p_size);
+	memcpy(snapshot.state.ptr(), p_state, p_size);
+	sent_since_ack++;
+}
+
+bool SceneSyncBaselines::Outbound::ack(uint16_t p_seq) {
+	for (uint32_t i = 0; i < sent.size(); i++) {
+		if (sent[i].seq != p_seq) {
+			continue;
+		}
+		// States sent before the new baseline are no longer needed.
+		acked = std::move(sent[i]);
+		has_acked = true;
+		for (uint32_t j = i + 1; j < sent.size(); j++) {
+			sent[j - i - 1] = std::move(sent[j]);
+		}
+		sent.resize(sent.size() - i - 1);
+		sent_since_ack = sent.size();
+		return true;
+	}
+	return false; // Already superseded by a newer acknowledgment, or too old.
+}
+
+const LocalVector<uint8_t> *SceneSyncBaselines::Inbound::get_state(uint16_t p_seq) const {
+	for (int i = int(snapshots.size()) - 1; i >= 0; i--) {
+		if (snapshots[i].seq == p_seq) {
+			return &snapshots[i].state;
+		}
+	}
+	return nullptr;
+}
+
+void SceneSyncBaselines::Inbound::push(uint16_t p_seq, const uint8_t *p_state, int p_size) {
+	// Keep sorted so late packets don't evict newer states.
+	uint32_t pos = snapshots.size();
+	while (pos > 0 && int16_t(p_seq - snapshots[pos - 1].seq) <= 0) {
+		pos--;
+	}
+	if (pos < snapshots.size() && snapshots[pos].seq == p_seq) {
+		snapshots[pos].state.resize(p_size);
+		memcpy(snapshots[pos].state.ptr(), p_state, p_size);
+		return;
+	}
+	snapshots.insert(pos, Snapshot());
+	snapshots[pos].seq = p_seq;
+	snapshots[pos].state.resize(p_size);
+	memcpy(snapshots[pos].state.ptr(), p_state, p_size);
+	if (snapshots.size() > WINDOW) {
+		snapshots.remove_at(0);
+	}
+}
+
+// Diffs are the XOR of the state with its baseline, where runs of zeroes are skipped.
+// Each run starts with a byte: 0x80 | (length - 1) for unchanged bytes, or (length - 1) followed by the XORed bytes.
+// Trailing unchanged bytes are omitted, a null output only computes the size.
+int SceneSyncBaselines::encode_diff(const uint8_t *p_state, const uint8_t *p_base, int p_size, uint8_t *r_diff) {
+	int end = p_size;
+	while (end > 0 && p_state[end - 1] == p_base[end - 1]) {
+		end--;
+	}
+	int len = 0;
+	int i = 0;
+	while (i < end) {
+		int run = 0;
+		if (p_state[i] == p_base[i]) {
+			while (i + run < end && run < 128 && p_state[i + run] == p_base[i + run]) {
+				run++;
+			}
+			if (r_diff) {
+				r_diff[len] = 0x80 | (run - 1);
+			}
+			len++;
+		} else {
+			while (i + run < end && run < 128 && p_state[i + run] != p_base[i + run]) {
+				run++;
+			}
+			if (r_diff) {
+				r_diff[len] = run - 1;
+				for (int j = 0; j < run; j++) {
+					r_diff[len + 1 + j] = p_state[i + j] ^ p_base[i + j];
+				}
+			}
+			len += 1 + run;
+		}
+		i += run;
+	}
+	return len;
+}
+
+bool SceneSyncBaselines::decode_diff(const uint8_t *p_diff, int p_diff_size, const uint8_t *p_base, int p_size, uint8_t *r_state) {
+	memcpy(r_state, p_base, p_size);
+	int pos = 0;
+	int i = 0;
+	while (i < p_diff_size) {
+		const uint8_t head = p_diff[i++];
+		const int run = (head & 0x7F) + 1;
+		if (pos + run > p_size) {
+			return false;
+		}
+		if (!(head & 0x80)) {
+			if (i + run > p_diff_size) {
+				return false;
+			}
+			for (int j = 0; j < run; j++) {
+				r_state[pos + j] ^= p_diff[i + j];
+			}
+			i += run;
+		}
+		pos += run;
+	}
+	return true;
+}
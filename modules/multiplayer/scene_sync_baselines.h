@@ -0,0 +1,69 @@
+/**************************************************************************/
+/*  scene_sync_baselines.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/local_vector.h"
+
+// Bookkeeping for sync states sent as diffs against the last state acknowledged by the receiver.
+// Sequences are those of the sync packets carrying each state.
+class SceneSyncBaselines {
+public:
+	static constexpr int WINDOW = 32; // States kept by the receiver for each synchronizer.
+
+	struct Snapshot {
+		uint16_t seq = 0;
+		LocalVector<uint8_t> state;
+	};
+
+	// Sender side, for one synchronizer and peer.
+	struct Outbound {
+		Snapshot acked;
+		bool has_acked = false;
+		LocalVector<Snapshot> sent; // Sent after the acknowledged one, oldest first.
+		uint32_t sent_since_ack = 0; // Also counts states dropped from `sent`.
+
+		bool is_acked(const uint8_t *p_state, int p_size) const;
+		const uint8_t *get_diff_base(int p_size, uint16_t &r_seq) const;
+		void push_sent(uint16_t p_seq, const uint8_t *p_state, int p_size);
+		bool ack(uint16_t p_seq);
+	};
+
+	// Receiver side, for one synchronizer.
+	struct Inbound {
+		LocalVector<Snapshot> snapshots; // Sorted by sequence, oldest first.
+
+		const LocalVector<uint8_t> *get_state(uint16_t p_seq) const;
+		void push(uint16_t p_seq, const uint8_t *p_state, int p_size);
+	};
+
+	static int encode_diff(const uint8_t *p_state, const uint8_t *p_base, int p_size, uint8_t *r_diff);
+	static bool decode_diff(const uint8_t *p_diff, int p_diff_size, const uint8_t *p_base, int p_size, uint8_t *r_state);
+};
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*  test_scene_interest_grid.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../scene_interest_grid.h"
+
+#include "core/math/random_pcg.h"
+#include "tests/test_macros.h"
+
+namespace TestSceneInterestGrid {
+
+TEST_CASE("[Multiplayer][SceneInterestGrid] Update and remove") {
+	SceneInterestGrid grid;
+	grid.set_cell_size(10);
+	grid.update(ObjectID(uint64_t(1)), Vector3(1, 1, 1));
+	grid.update(ObjectID(uint64_t(2)), Vector3(15, 1, 1));
+	grid.update(ObjectID(uint64_t(3)), Vector3(-25, 1, 1));
+	CHECK(grid.size() == 3);
+
+	HashSet<ObjectID> result;
+	grid.query(Vector3(), 5, result);
+	CHECK(result.size() == 1);
+	CHECK(result.has(ObjectID(uint64_t(1))));
+
+	// Moving to another cell.
+	grid.update(ObjectID(uint64_t(2)), Vector3(2, -2, 0));
+	result.clear();
+	grid.query(Vector3(), 5, result);
+	CHECK(result.size() == 2);
+
+	grid.remove(ObjectID(uint64_t(1)));
+	CHECK_FALSE(grid.has(ObjectID(uint64_t(1))));
+	result.clear();
+	grid.query(Vector3(), 5, result);
+	CHECK(result.size() == 1);
+	CHECK(result.has(ObjectID(uint64_t(2))));
+
+	// Changing the cell size keeps the objects.
+	grid.set_cell_size(3);
+	result.clear();
+	grid.query(Vector3(), 100, result);
+	CHECK(result.size() == 2);
+}
+
+TEST_CASE("[Multiplayer][SceneInterestGrid] Queries match brute force with 100 peers and 20000 objects") {
+	const int object_count = 20000;
+	const int peer_count = 100;
+	const real_t world_size = 4096;
+	const real_t radius = 150;
+
+	RandomPCG rng(42);
+	SceneInterestGrid grid;
+	grid.set_cell_size(radius);
+	LocalVector<Vector3> positions;
+	positions.resize(object_count);
+	for (int i = 0; i < object_count; i++) {
+		positions[i] = Vector3(rng.random(0.0, world_size), rng.random(0.0, world_size), rng.random(0.0, 64.0));
+		grid.update(ObjectID(uint64_t(i + 1)), positions[i]);
+	}
+	// Move half of the objects, updating the grid incrementally.
+	for (int i = 0; i < object_count; i += 2) {
+		positions[i] += Vector3(rng.random(-200.0, 200.0), rng.random(-200.0, 200.0), 0);
+		grid.update(ObjectID(uint64_t(i + 1)), positions[i]);
+	}
+	CHECK(grid.size() == object_count);
+
+	int mismatches = 0;
+	for (int p = 0; p < peer_count; p++) {
+		const Vector3 origin = Vector3(rng.random(0.0, world_size), rng.random(0.0, world_size), 32);
+		HashSet<ObjectID> result;
+		grid.query(origin, radius, result);
+		int expected = 0;
+		for (int i = 0; i < object_count; i++) {
+			if (positions[i].distance_squared_to(origin) <= radius * radius) {
+				expected++;
+				if (!result.has(ObjectID(uint64_t(i + 1)))) {
+					mismatches++;
+				}
+			}
+		}
+		if (int(result.size()) != expected) {
+			mismatches++;
+		}
+	}
+	CHECK(mismatches == 0);
+}
+
+} // namespace TestSceneInterestGrid
@@ -59,6 +59,7 @@ TEST_CASE("[Multiplayer][SceneMultiplayer] Defaults") {
 	CHECK(scene_multiplayer->is_server_relay_enabled());
 	CHECK_EQ(scene_multiplayer->get_max_sync_packet_size(), 1350);
 	CHECK_EQ(scene_multiplayer->get_max_delta_packet_size(), 65535);
+	CHECK_FALSE(scene_multiplayer->is_sync_baselines_enabled());
 	CHECK(scene_multiplayer->is_server());
 }
 
@@ -0,0 +1,138 @@
+/**************************************************************************/
+/*  test_scene_replication_config.h                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../scene_replication_config.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSceneReplicationConfig {
+
+static Ref<SceneReplicationConfig> _make_config() {
+	Ref<SceneReplicationConfig> config;
+	config.instantiate();
+	config->add_property(NodePath(":position"));
+	config->add_property(NodePath(":quaternion"));
+	config->add_property(NodePath(":visible"));
+	config->add_property(NodePath(":state"));
+	return config;
+}
+
+static Vector<uint8_t> _encode(const Vector<Variant> &p_values, const SceneReplicationConfig::PropertyEncodingInfo *p_encodings) {
+	Vector<const Variant *> varp;
+	for (const Variant &v : p_values) {
+		varp.push_back(&v);
+	}
+	Vector<uint8_t> buffer;
+	int len = 0;
+	Error err = SceneReplicationConfig::encode_properties(varp.ptrw(), p_encodings, varp.size(), nullptr, len);
+	CHECK(err == OK);
+	buffer.resize(len);
+	err = SceneReplicationConfig::encode_properties(varp.ptrw(), p_encodings, varp.size(), buffer.ptrw(), len);
+	CHECK(err == OK);
+	CHECK(len == buffer.size());
+	return buffer;
+}
+
+static Vector<Variant> _decode(const Vector<uint8_t> &p_buffer, const SceneReplicationConfig::PropertyEncodingInfo *p_encodings, int p_count) {
+	Vector<Variant> values;
+	values.resize(p_count);
+	int consumed = 0;
+	Error err = SceneReplicationConfig::decode_properties(values, p_encodings, p_buffer.ptr(), p_buffer.size(), consumed);
+	CHECK(err == OK);
+	CHECK(consumed == p_buffer.size());
+	return values;
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationConfig] Default encoding") {
+	Ref<SceneReplicationConfig> config = _make_config();
+	CHECK(config->property_get_encoding(NodePath(":position")) == SceneReplicationConfig::PROPERTY_ENCODING_VARIANT);
+	CHECK(config->get_sync_properties().size() == 4);
+	// Plain configurations keep the Variant wire format.
+	CHECK(config->get_sync_encodings().is_empty());
+	CHECK(config->get_watch_encodings().is_empty());
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationConfig] Encoded properties bandwidth") {
+	Ref<SceneReplicationConfig> config = _make_config();
+	config->property_set_encoding(NodePath(":position"), SceneReplicationConfig::PROPERTY_ENCODING_QUANTIZED);
+	config->property_set_encoding_range(NodePath(":position"), Vector2(-1024, 1024));
+	config->property_set_encoding_bits(NodePath(":position"), 16);
+	config->property_set_encoding(NodePath(":quaternion"), SceneReplicationConfig::PROPERTY_ENCODING_QUATERNION);
+	config->property_set_encoding_bits(NodePath(":quaternion"), 12);
+	config->property_set_encoding(NodePath(":visible"), SceneReplicationConfig::PROPERTY_ENCODING_PACKED);
+	config->property_set_encoding(NodePath(":state"), SceneReplicationConfig::PROPERTY_ENCODING_PACKED);
+	config->property_set_encoding_range(NodePath(":state"), Vector2(0, 8));
+	config->property_set_encoding_bits(NodePath(":state"), 3);
+
+	const LocalVector<SceneReplicationConfig::PropertyEncodingInfo> &encodings = config->get_sync_encodings();
+	REQUIRE(encodings.size() == 4);
+
+	const Quaternion rotation = Quaternion(Vector3(0, 1, 0), 0.75) * Quaternion(Vector3(1, 0, 0), -0.3);
+	Vector<Variant> values;
+	values.push_back(Vector3(12.5, -300.25, 1000));
+	values.push_back(rotation);
+	values.push_back(true);
+	values.push_back(5);
+
+	const Vector<uint8_t> plain = _encode(values, nullptr);
+	const Vector<uint8_t> packed = _encode(values, encodings.ptr());
+
+	SUBCASE("Packed state stays small") {
+		// 4 flags, 2 + 3 * 16 position bits, 2 + 3 * 12 rotation bits, 2 bool bits and 1 + 3 enum bits.
+		CHECK(packed.size() == 13);
+		CHECK(packed.size() * 2 < plain.size());
+	}
+
+	SUBCASE("Values round-trip within the configured precision") {
+		const Vector<Variant> decoded = _decode(packed, encodings.ptr(), values.size());
+		const double step = 2048.0 / ((1 << 16) - 1);
+		const Vector3 position = decoded[0];
+		CHECK(position.distance_to(values[0]) <= step * 2);
+		const Quaternion decoded_rotation = decoded[1];
+		CHECK(decoded_rotation.is_normalized());
+		CHECK(Math::abs(decoded_rotation.dot(rotation)) > 0.9999);
+		CHECK(decoded[2] == Variant(true));
+		CHECK(decoded[3] == Variant(5));
+	}
+
+	SUBCASE("Unsupported values fall back to Variants") {
+		values.write[0] = Vector3(5000, 0, 0);
+		values.write[3] = 42;
+		const Vector<uint8_t> fallback = _encode(values, encodings.ptr());
+		const Vector<Variant> decoded = _decode(fallback, encodings.ptr(), values.size());
+		CHECK(decoded[0] == values[0]);
+		CHECK(decoded[3] == values[3]);
+		CHECK(decoded[2] == Variant(true));
+	}
+}
+
+} // namespace TestSceneReplicationConfig
@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*  test_scene_replication_interface.h                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../multiplayer_synchronizer.h"
+#include "../scene_cache_interface.h"
+#include "../scene_multiplayer.h"
+#include "../scene_replication_interface.h"
+
+#include "scene/2d/node_2d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "tests/test_macros.h"
+
+namespace TestSceneReplicationInterface {
+
+TEST_CASE("[Multiplayer][SceneReplicationInterface][SceneTree] Interest management visibility") {
+	Ref<SceneMultiplayer> scene_multiplayer;
+	scene_multiplayer.instantiate();
+	Ref<SceneCacheInterface> cache;
+	cache.instantiate(scene_multiplayer.ptr());
+	Ref<SceneReplicationInterface> replicator;
+	replicator.instantiate(scene_multiplayer.ptr(), cache.ptr());
+
+	Node2D *node = memnew(Node2D);
+	node->set_position(Vector2(100, 0));
+	MultiplayerSynchronizer *sync = memnew(MultiplayerSynchronizer);
+	Ref<SceneReplicationConfig> config;
+	config.instantiate();
+	sync->set_replication_config(config);
+	sync->set_interest_managed(true);
+	node->add_child(sync);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	replicator->on_peer_change(2, true);
+	const ObjectID oid = node->get_instance_id();
+
+	SUBCASE("Owned synchronizers are only visible inside the peer's interest area") {
+		REQUIRE_EQ(replicator->on_replication_start(node, sync), OK);
+		CHECK_FALSE(replicator->is_rpc_visible(oid, 2));
+
+		replicator->set_peer_interest(2, Vector3(90, 0, 0), 20);
+		replicator->on_network_process();
+		CHECK(replicator->is_rpc_visible(oid, 2));
+
+		replicator->set_peer_interest(2, Vector3(-500, 0, 0), 20);
+		replicator->on_network_process();
+		CHECK_FALSE(replicator->is_rpc_visible(oid, 2));
+	}
+
+	SUBCASE("Remote synchronizers are not restricted by interest") {
+		// Like a client calling an RPC on a node placed in the scene and owned by the server.
+		node->set_multiplayer_authority(2);
+		REQUIRE_EQ(replicator->on_replication_start(node, sync), OK);
+		CHECK(replicator->is_rpc_visible(oid, 2));
+
+		replicator->on_network_process();
+		CHECK(replicator->is_rpc_visible(oid, 2));
+	}
+
+	CHECK_EQ(replicator->on_replication_stop(node, sync), OK);
+	replicator->on_peer_change(2, false);
+	memdelete(node);
+}
+
+} // namespace TestSceneReplicationInterface
@@ -0,0 +1,227 @@
+/**************************************************************************/
+/*  test_scene_sync_baselines.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../scene_sync_baselines.h"
+
+#include "core/math/random_pcg.h"
+#include "tests/test_macros.h"
+
+namespace TestSceneSyncBaselines {
+
+static LocalVector<uint8_t> round_trip(const LocalVector<uint8_t> &p_state, const LocalVector<uint8_t> &p_base, int &r_diff_size) {
+	r_diff_size = SceneSyncBaselines::encode_diff(p_state.ptr(), p_base.ptr(), p_state.size(), nullptr);
+	LocalVector<uint8_t> diff;
+	diff.resize(r_diff_size);
+	CHECK(SceneSyncBaselines::encode_diff(p_state.ptr(), p_base.ptr(), p_state.size(), diff.ptr()) == r_diff_size);
+	LocalVector<uint8_t> decoded;
+	decoded.resize(p_base.size());
+	CHECK(SceneSyncBaselines::decode_diff(diff.ptr(), diff.size(), p_base.ptr(), p_base.size(), decoded.ptr()));
+	return decoded;
+}
+
+static bool equals(const LocalVector<uint8_t> &p_a, const LocalVector<uint8_t> &p_b) {
+	return p_a.size() == p_b.size() && memcmp(p_a.ptr(), p_b.ptr(), p_a.size()) == 0;
+}
+
+static LocalVector<uint8_t> make_state(int p_size, uint8_t p_value) {
+	LocalVector<uint8_t> state;
+	state.resize(p_size);
+	for (int i = 0; i < p_size; i++) {
+		state[i] = p_value;
+	}
+	return state;
+}
+
+TEST_CASE("[Multiplayer][SceneSyncBaselines] Diff round trip") {
+	const LocalVector<uint8_t> base = make_state(600, 7);
+	int diff_size = 0;
+
+	SUBCASE("Unchanged states have an empty diff") {
+		round_trip(base, base, diff_size);
+		CHECK(diff_size == 0);
+	}
+
+	SUBCASE("Runs longer than 128 bytes") {
+		// 300 changed bytes, then 300 unchanged bytes ending with a changed one.
+		LocalVector<uint8_t> state(base);
+		for (int i = 0; i < 300; i++) {
+			state[i] = 0x80 | (i & 0x7F);
+		}
+		state[599] = 1;
+		CHECK(equals(round_trip(state, base, diff_size), state));
+		// Three literal runs (128 + 128 + 44), three skipped runs (128 + 128 + 43), and a final literal byte.
+		CHECK(diff_size == (1 + 128) * 2 + (1 + 44) + 3 + (1 + 1));
+	}
+
+	SUBCASE("Trailing unchanged bytes are omitted") {
+		LocalVector<uint8_t> state(base);
+		state[10] = 0;
+		CHECK(equals(round_trip(state, base, diff_size), state));
+		CHECK(diff_size == 1 + (1 + 1));
+	}
+
+	SUBCASE("Random states") {
+		RandomPCG rng(42);
+		for (int iteration = 0; iteration < 100; iteration++) {
+			LocalVector<uint8_t> state(base);
+			for (uint32_t i = 0; i < state.size(); i++) {
+				if (rng.randf() < 0.3) {
+					state[i] = rng.rand() & 0xFF;
+				}
+			}
+			CHECK(equals(round_trip(state, base, diff_size), state));
+		}
+	}
+}
+
+TEST_CASE("[Multiplayer][SceneSyncBaselines] Malformed diffs are rejected") {
+	const LocalVector<uint8_t> base = make_state(16, 0);
+	LocalVector<uint8_t> state(base);
+	for (int i = 4; i < 12; i++) {
+		state[i] = i;
+	}
+	LocalVector<uint8_t> diff;
+	diff.resize(SceneSyncBaselines::encode_diff(state.ptr(), base.ptr(), state.size(), nullptr));
+	SceneSyncBaselines::encode_diff(state.ptr(), base.ptr(), state.size(), diff.ptr());
+	LocalVector<uint8_t> decoded;
+	decoded.resize(base.size());
+
+	SUBCASE("Truncated literal run") {
+		CHECK_FALSE(SceneSyncBaselines::decode_diff(diff.ptr(), diff.size() - 1, base.ptr(), base.size(), decoded.ptr()));
+	}
+
+	SUBCASE("Runs past the end of the state") {
+		const uint8_t skip_past_end[] = { 0x80 | 15, 0x80 | 0 };
+		CHECK_FALSE(SceneSyncBaselines::decode_diff(skip_past_end, 2, base.ptr(), base.size(), decoded.ptr()));
+		const uint8_t literal_past_end[] = { 0x80 | 14, 1, 0xFF, 0xFF };
+		CHECK_FALSE(SceneSyncBaselines::decode_diff(literal_past_end, 4, base.ptr(), base.size(), decoded.ptr()));
+	}
+
+	SUBCASE("Diffs against a smaller baseline") {
+		CHECK_FALSE(SceneSyncBaselines::decode_diff(diff.ptr(), diff.size(), base.ptr(), 8, decoded.ptr()));
+	}
+}
+
+TEST_CASE("[Multiplayer][SceneSyncBaselines] Sender baselines") {
+	const LocalVector<uint8_t> state_a = make_state(8, 1);
+	const LocalVector<uint8_t> state_b = make_state(8, 2);
+	SceneSyncBaselines::Outbound outbound;
+	uint16_t base_seq = 0;
+
+	// Nothing is acknowledged yet, so the full state is sent.
+	CHECK_FALSE(outbound.is_acked(state_a.ptr(), state_a.size()));
+	CHECK(outbound.get_diff_base(state_a.size(), base_seq) == nullptr);
+	outbound.push_sent(1, state_a.ptr(), state_a.size());
+
+	SUBCASE("Unchanged acknowledged states are not sent again") {
+		CHECK(outbound.ack(1));
+		CHECK(outbound.is_acked(state_a.ptr(), state_a.size()));
+		CHECK_FALSE(outbound.is_acked(state_b.ptr(), state_b.size()));
+
+		// Long after, as the packet sequence doesn't matter while nothing is sent.
+		CHECK(outbound.is_acked(state_a.ptr(), state_a.size()));
+		CHECK(outbound.get_diff_base(state_a.size(), base_seq) != nullptr);
+		CHECK(base_seq == 1);
+	}
+
+	SUBCASE("Out of order acknowledgments keep the newest baseline") {
+		outbound.push_sent(2, state_b.ptr(), state_b.size());
+		outbound.push_sent(3, state_a.ptr(), state_a.size());
+		CHECK(outbound.ack(3));
+		CHECK(outbound.sent.is_empty());
+		CHECK_FALSE(outbound.ack(2));
+		CHECK_FALSE(outbound.ack(1));
+		CHECK(outbound.get_diff_base(state_a.size(), base_seq) != nullptr);
+		CHECK(base_seq == 3);
+		CHECK(outbound.is_acked(state_a.ptr(), state_a.size()));
+	}
+
+	SUBCASE("Acknowledging an older state keeps the newer ones pending") {
+		outbound.push_sent(2, state_b.ptr(), state_b.size());
+		CHECK(outbound.ack(1));
+		CHECK(outbound.sent.size() == 1);
+		// The receiver might already hold state B, so state A must still be sent.
+		CHECK_FALSE(outbound.is_acked(state_a.ptr(), state_a.size()));
+		CHECK(outbound.get_diff_base(state_a.size(), base_seq) != nullptr);
+		CHECK(base_seq == 1);
+	}
+
+	SUBCASE("Falls back to full states once the receiver may have dropped the baseline") {
+		CHECK(outbound.ack(1));
+		// Packet sequences far apart don't matter, only the states sent for this synchronizer.
+		for (int i = 0; i < SceneSyncBaselines::WINDOW - 1; i++) {
+			outbound.push_sent(1000 + i * 100, state_b.ptr(), state_b.size());
+			CHECK(outbound.get_diff_base(state_b.size(), base_seq) != nullptr);
+		}
+		outbound.push_sent(50000, state_b.ptr(), state_b.size());
+		CHECK(outbound.get_diff_base(state_b.size(), base_seq) == nullptr);
+
+		// Until a newer state is acknowledged.
+		CHECK(outbound.ack(50000));
+		CHECK(outbound.get_diff_base(state_b.size(), base_seq) != nullptr);
+		CHECK(base_seq == 50000);
+	}
+
+	SUBCASE("States of a different size are sent in full") {
+		CHECK(outbound.ack(1));
+		const LocalVector<uint8_t> larger = make_state(12, 1);
+		CHECK_FALSE(outbound.is_acked(larger.ptr(), larger.size()));
+		CHECK(outbound.get_diff_base(larger.size(), base_seq) == nullptr);
+	}
+}
+
+TEST_CASE("[Multiplayer][SceneSyncBaselines] Receiver baselines") {
+	SceneSyncBaselines::Inbound inbound;
+	const LocalVector<uint8_t> state = make_state(4, 3);
+
+	SUBCASE("Missing baselines are not found") {
+		inbound.push(10, state.ptr(), state.size());
+		CHECK(inbound.get_state(10) != nullptr);
+		CHECK(inbound.get_state(9) == nullptr);
+	}
+
+	SUBCASE("Keeps the newest states") {
+		for (int i = 0; i < SceneSyncBaselines::WINDOW + 8; i++) {
+			inbound.push(uint16_t(65530 + i), state.ptr(), state.size()); // Wraps around.
+		}
+		CHECK(inbound.snapshots.size() == uint32_t(SceneSyncBaselines::WINDOW));
+		CHECK(inbound.get_state(uint16_t(65530 + 7)) == nullptr);
+		CHECK(inbound.get_state(uint16_t(65530 + 8)) != nullptr);
+
+		// A late packet doesn't evict a newer state.
+		inbound.push(65500, state.ptr(), state.size());
+		CHECK(inbound.get_state(65500) == nullptr);
+		CHECK(inbound.get_state(uint16_t(65530 + 8)) != nullptr);
+	}
+}
+
+} // namespace TestSceneSyncBaselines
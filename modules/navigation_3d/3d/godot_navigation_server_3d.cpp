@@ -1457,6 +1457,65 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer3D::query_paths(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_query_parameters.size() != p_query_results.size(), "The query parameters and query results arrays must have the same size.");
+
+	const uint32_t query_count = p_query_parameters.size();
+
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D> query_tasks;
+	query_tasks.resize(query_count);
+	LocalVector<NavMap3D *> query_maps;
+	query_maps.resize(query_count);
+
+	for (uint32_t i = 0; i < query_count; i++) {
+		query_maps[i] = nullptr;
+
+		Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		Ref<NavigationPathQueryResult3D> query_result = p_query_results[i];
+		ERR_CONTINUE(query_parameters.is_null());
+		ERR_CONTINUE(query_result.is_null());
+
+		NavMap3D *map = map_owner.get_or_null(query_parameters->get_map());
+		ERR_CONTINUE(map == nullptr);
+
+		NavMeshQueries3D::query_task_set_parameters(query_tasks[i], query_parameters);
+		query_tasks[i].query_parameters = query_parameters;
+		query_tasks[i].query_result = query_result;
+		query_maps[i] = map;
+	}
+
+	// Run all queries of a map together so they share one map iteration.
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D *> map_query_tasks;
+	map_query_tasks.reserve(query_count);
+
+	for (uint32_t i = 0; i < query_count; i++) {
+		NavMap3D *map = query_maps[i];
+		if (map == nullptr) {
+			continue;
+		}
+
+		map_query_tasks.clear();
+		for (uint32_t j = i; j < query_count; j++) {
+			if (query_maps[j] == map) {
+				map_query_tasks.push_back(&query_tasks[j]);
+				query_maps[j] = nullptr;
+			}
+		}
+
+		map->query_paths(map_query_tasks.ptr(), map_query_tasks.size());
+	}
+
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D &query_task : query_tasks) {
+		if (query_task.query_result.is_valid()) {
+			NavMeshQueries3D::query_task_write_result(query_task, query_task.query_result);
+		}
+	}
+
+	if (p_callback.is_valid()) {
+		NavMeshQueries3D::emit_callback(p_callback);
+	}
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
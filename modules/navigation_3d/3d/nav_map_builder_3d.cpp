@@ -70,6 +70,8 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_cluster_graph(r_build);
+
 	_build_update_map_iteration(r_build);
 }
 
@@ -392,6 +394,87 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_cluster_graph(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	LocalVector<PolygonCluster> &clusters = map_iteration->clusters;
+	LocalVector<LocalVector<uint32_t>> &cluster_neighbors = map_iteration->cluster_neighbors;
+	LocalVector<uint32_t> &polygon_clusters = map_iteration->polygon_clusters;
+
+	clusters.clear();
+	cluster_neighbors.clear();
+	polygon_clusters.clear();
+	polygon_clusters.reserve(r_build.polygon_count);
+
+	// The region clusters are built with the region iterations and only change with them,
+	// so here they are just offset into a single map wide graph.
+	HashMap<const NavBaseIteration3D *, uint32_t> navbase_cluster_offsets;
+
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		const uint32_t cluster_offset = clusters.size();
+		navbase_cluster_offsets[region.ptr()] = cluster_offset;
+
+		for (uint32_t cluster_index = 0; cluster_index < region->cluster_positions.size(); cluster_index++) {
+			PolygonCluster cluster;
+			cluster.position = region->cluster_positions[cluster_index];
+			cluster.owner = region.ptr();
+			clusters.push_back(cluster);
+
+			cluster_neighbors.push_back(LocalVector<uint32_t>());
+			LocalVector<uint32_t> &neighbors = cluster_neighbors[cluster_neighbors.size() - 1];
+			for (const uint32_t region_neighbor : region->cluster_neighbors[cluster_index]) {
+				neighbors.push_back(cluster_offset + region_neighbor);
+			}
+		}
+
+		for (const uint32_t polygon_cluster : region->polygon_clusters) {
+			polygon_clusters.push_back(cluster_offset + polygon_cluster);
+		}
+	}
+
+	// Each link polygon is a cluster on its own.
+	for (const Polygon &link_polygon : map_iteration->navlink_polygons) {
+		navbase_cluster_offsets[link_polygon.owner] = clusters.size();
+		polygon_clusters.push_back(clusters.size());
+
+		PolygonCluster cluster;
+		cluster.owner = link_polygon.owner;
+		if (!link_polygon.vertices.is_empty()) {
+			cluster.position = (link_polygon.vertices[0] + link_polygon.vertices[link_polygon.vertices.size() - 1]) * 0.5;
+		}
+		clusters.push_back(cluster);
+		cluster_neighbors.push_back(LocalVector<uint32_t>());
+	}
+
+	DEV_ASSERT(polygon_clusters.size() == (uint32_t)r_build.polygon_count);
+
+	// Connect clusters across region edges, edge connections and links.
+	for (const KeyValue<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>> &E : map_iteration->navbases_polygons_external_connections) {
+		const NavBaseIteration3D *navbase = E.key;
+		const bool navbase_is_region = navbase->get_type() == NavigationEnums3D::PathSegmentType::PATH_SEGMENT_TYPE_REGION;
+		const uint32_t navbase_cluster_offset = navbase_cluster_offsets[navbase];
+
+		for (uint32_t polygon_index = 0; polygon_index < E.value.size(); polygon_index++) {
+			uint32_t cluster_index = navbase_cluster_offset;
+			if (navbase_is_region) {
+				cluster_index += static_cast<const NavRegionIteration3D *>(navbase)->polygon_clusters[polygon_index];
+			}
+
+			for (const Connection &connection : E.value[polygon_index]) {
+				const NavBaseIteration3D *connection_owner = connection.polygon->owner;
+				uint32_t connected_cluster_index = navbase_cluster_offsets[connection_owner];
+				if (connection_owner->get_type() == NavigationEnums3D::PathSegmentType::PATH_SEGMENT_TYPE_REGION) {
+					connected_cluster_index += static_cast<const NavRegionIteration3D *>(connection_owner)->polygon_clusters[connection.polygon->id];
+				}
+
+				if (connected_cluster_index != cluster_index && !cluster_neighbors[cluster_index].has(connected_cluster_index)) {
+					cluster_neighbors[cluster_index].push_back(connected_cluster_index);
+				}
+			}
+		}
+	}
+}
+
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
@@ -425,6 +508,10 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_buil
 		}
 
 		DEV_ASSERT(p_path_query_slot.path_corridor.size() == p_path_query_slot.poly_to_id.size());
+
+		p_path_query_slot.traversable_clusters.clear();
+		p_path_query_slot.cluster_corridor.clear();
+		p_path_query_slot.cluster_corridor.resize(map_iteration->clusters.size());
 	}
 
 	map_iteration->path_query_slots_mutex.unlock();
@@ -89,6 +89,12 @@ struct NavMapIteration3D {
 
 	HashMap<NavRegion3D *, Ref<NavRegionIteration3D>> region_ptr_to_region_iteration;
 
+	// The abstract graph used by hierarchical pathfinding, assembled from the region clusters.
+	LocalVector<Nav3D::PolygonCluster> clusters;
+	LocalVector<LocalVector<uint32_t>> cluster_neighbors;
+	// The cluster of each polygon, indexed like the path query slot polygon ids.
+	LocalVector<uint32_t> polygon_clusters;
+
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
@@ -103,6 +109,9 @@ struct NavMapIteration3D {
 		navbases_polygons_external_connections.clear();
 		navlink_polygons.clear();
 		region_ptr_to_region_iteration.clear();
+		clusters.clear();
+		cluster_neighbors.clear();
+		polygon_clusters.clear();
 	}
 };
 
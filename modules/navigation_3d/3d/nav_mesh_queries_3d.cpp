@@ -150,88 +150,97 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	ERR_FAIL_COND(p_query_parameters.is_null());
 	ERR_FAIL_COND(p_query_result.is_null());
 
-	using namespace NavigationDefaults3D;
-
 	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
-	query_task.start_position = p_query_parameters->get_start_position();
-	query_task.target_position = p_query_parameters->get_target_position();
-	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
+	query_task_set_parameters(query_task, p_query_parameters);
 	query_task.callback = p_callback;
 
+	map->query_path(query_task);
+
+	query_task_write_result(query_task, p_query_result);
+
+	if (query_task.callback.is_valid()) {
+		if (emit_callback(query_task.callback)) {
+			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_DISPATCHED;
+		} else {
+			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_FAILED;
+		}
+	}
+}
+
+void NavMeshQueries3D::query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters) {
+	p_query_task.start_position = p_query_parameters->get_start_position();
+	p_query_task.target_position = p_query_parameters->get_target_position();
+	p_query_task.navigation_layers = p_query_parameters->get_navigation_layers();
+
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
 
 	uint32_t _excluded_region_count = _excluded_regions.size();
 	uint32_t _included_region_count = _included_regions.size();
 
-	query_task.exclude_regions = _excluded_region_count > 0;
-	query_task.include_regions = _included_region_count > 0;
+	p_query_task.exclude_regions = _excluded_region_count > 0;
+	p_query_task.include_regions = _included_region_count > 0;
 
-	if (query_task.exclude_regions) {
-		query_task.excluded_regions.resize(_excluded_region_count);
+	if (p_query_task.exclude_regions) {
+		p_query_task.excluded_regions.resize(_excluded_region_count);
 		for (uint32_t i = 0; i < _excluded_region_count; i++) {
-			query_task.excluded_regions[i] = _excluded_regions[i];
+			p_query_task.excluded_regions[i] = _excluded_regions[i];
 		}
 	}
 
-	if (query_task.include_regions) {
-		query_task.included_regions.resize(_included_region_count);
+	if (p_query_task.include_regions) {
+		p_query_task.included_regions.resize(_included_region_count);
 		for (uint32_t i = 0; i < _included_region_count; i++) {
-			query_task.included_regions[i] = _included_regions[i];
+			p_query_task.included_regions[i] = _included_regions[i];
 		}
 	}
 
 	switch (p_query_parameters->get_pathfinding_algorithm()) {
 		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR: {
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			p_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+		} break;
+		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR: {
+			p_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathfindingAlgorithm - fallback to default");
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			p_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 	}
 
 	switch (p_query_parameters->get_path_postprocessing()) {
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_NONE: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathPostProcessing - fallback to default");
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 	}
 
-	query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
-	query_task.simplify_path = p_query_parameters->get_simplify_path();
-	query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
-	query_task.path_return_max_length = p_query_parameters->get_path_return_max_length();
-	query_task.path_return_max_radius = p_query_parameters->get_path_return_max_radius();
-	query_task.path_search_max_polygons = p_query_parameters->get_path_search_max_polygons();
-	query_task.path_search_max_distance = p_query_parameters->get_path_search_max_distance();
-	query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
-
-	map->query_path(query_task);
+	p_query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
+	p_query_task.simplify_path = p_query_parameters->get_simplify_path();
+	p_query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
+	p_query_task.path_return_max_length = p_query_parameters->get_path_return_max_length();
+	p_query_task.path_return_max_radius = p_query_parameters->get_path_return_max_radius();
+	p_query_task.path_search_max_polygons = p_query_parameters->get_path_search_max_polygons();
+	p_query_task.path_search_max_distance = p_query_parameters->get_path_search_max_distance();
+	p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+}
 
+void NavMeshQueries3D::query_task_write_result(const NavMeshPathQueryTask3D &p_query_task, Ref<NavigationPathQueryResult3D> p_query_result) {
 	p_query_result->set_data(
-			query_task.path_points,
-			query_task.path_meta_point_types,
-			query_task.path_meta_point_rids,
-			query_task.path_meta_point_owners);
-	p_query_result->set_path_length(query_task.path_length);
-
-	if (query_task.callback.is_valid()) {
-		if (emit_callback(query_task.callback)) {
-			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_DISPATCHED;
-		} else {
-			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_FAILED;
-		}
-	}
+			p_query_task.path_points,
+			p_query_task.path_meta_point_types,
+			p_query_task.path_meta_point_rids,
+			p_query_task.path_meta_point_owners);
+	p_query_result->set_path_length(p_query_task.path_length);
 }
 
 void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
@@ -293,8 +302,14 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	Vector3 new_entry = Geometry3D::get_closest_point_to_segment(p_least_cost_poly.entry, p_connection.pathway_start, p_connection.pathway_end);
 	real_t new_traveled_distance = p_least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost + p_poly_enter_cost + p_least_cost_poly.traveled_distance;
 
+	const uint32_t neighbor_poly_id = p_query_task.path_query_slot->poly_to_id[p_connection.polygon];
+	if (p_query_task.use_cluster_corridor && !p_query_task.path_query_slot->cluster_corridor[(*p_query_task.polygon_clusters)[neighbor_poly_id]].in_corridor) {
+		// Outside of the cluster route found by the hierarchical search.
+		return;
+	}
+
 	// Check if the neighbor polygon has already been processed.
-	NavigationPoly &neighbor_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[p_connection.polygon]];
+	NavigationPoly &neighbor_poly = navigation_polys[neighbor_poly_id];
 	if (new_traveled_distance < neighbor_poly.traveled_distance) {
 		// Add the polygon to the heap of polygons to traverse next.
 		neighbor_poly.back_navigation_poly_id = p_least_cost_id;
@@ -316,6 +331,101 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	}
 }
 
+bool NavMeshQueries3D::_query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	p_query_task.use_cluster_corridor = false;
+
+	const LocalVector<PolygonCluster> &clusters = p_map_iteration.clusters;
+	const LocalVector<LocalVector<uint32_t>> &cluster_neighbors = p_map_iteration.cluster_neighbors;
+	LocalVector<NavigationCluster> &navigation_clusters = p_query_task.path_query_slot->cluster_corridor;
+
+	if (clusters.is_empty() || navigation_clusters.size() != clusters.size()) {
+		return false;
+	}
+
+	p_query_task.polygon_clusters = &p_map_iteration.polygon_clusters;
+
+	const uint32_t begin_cluster_id = p_map_iteration.polygon_clusters[p_query_task.path_query_slot->poly_to_id[p_query_task.begin_polygon]];
+	const uint32_t end_cluster_id = p_map_iteration.polygon_clusters[p_query_task.path_query_slot->poly_to_id[p_query_task.end_polygon]];
+	if (begin_cluster_id == end_cluster_id) {
+		// Nothing to gain, the polygon search stays local anyway.
+		return false;
+	}
+
+	const Vector3 end_point = p_query_task.end_position;
+
+	Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer> &traversable_clusters = p_query_task.path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+
+	for (NavigationCluster &navigation_cluster : navigation_clusters) {
+		navigation_cluster.reset();
+	}
+
+	// A* over the abstract cluster graph, with the same cost model as the polygon search.
+	navigation_clusters[begin_cluster_id].traveled_distance = 0.0;
+	uint32_t least_cost_id = begin_cluster_id;
+	bool found_route = false;
+
+	while (true) {
+		const PolygonCluster &least_cost_cluster = clusters[least_cost_id];
+		const NavigationCluster &least_cost_navigation_cluster = navigation_clusters[least_cost_id];
+
+		for (const uint32_t neighbor_id : cluster_neighbors[least_cost_id]) {
+			const PolygonCluster &neighbor_cluster = clusters[neighbor_id];
+			if (!_query_task_is_connection_owner_usable(p_query_task, neighbor_cluster.owner)) {
+				continue;
+			}
+
+			real_t new_traveled_distance = least_cost_navigation_cluster.traveled_distance + least_cost_cluster.position.distance_to(neighbor_cluster.position) * least_cost_cluster.owner->get_travel_cost();
+			if (neighbor_cluster.owner != least_cost_cluster.owner) {
+				new_traveled_distance += neighbor_cluster.owner->get_enter_cost();
+			}
+
+			NavigationCluster &neighbor_navigation_cluster = navigation_clusters[neighbor_id];
+			if (new_traveled_distance < neighbor_navigation_cluster.traveled_distance) {
+				neighbor_navigation_cluster.back_navigation_cluster_id = least_cost_id;
+				neighbor_navigation_cluster.traveled_distance = new_traveled_distance;
+				neighbor_navigation_cluster.distance_to_destination = neighbor_cluster.position.distance_to(end_point) * neighbor_cluster.owner->get_travel_cost();
+
+				if (neighbor_navigation_cluster.traversable_cluster_index != traversable_clusters.INVALID_INDEX) {
+					traversable_clusters.shift(neighbor_navigation_cluster.traversable_cluster_index);
+				} else {
+					traversable_clusters.push(&neighbor_navigation_cluster);
+				}
+			}
+		}
+
+		if (traversable_clusters.is_empty()) {
+			break;
+		}
+
+		least_cost_id = traversable_clusters.pop() - navigation_clusters.ptr();
+		if (least_cost_id == end_cluster_id) {
+			found_route = true;
+			break;
+		}
+	}
+
+	traversable_clusters.clear();
+
+	if (!found_route) {
+		// Let the polygon search find the closest reachable position on its own.
+		return false;
+	}
+
+	// Open the clusters along the route, and their direct neighbors to leave the refining search some room.
+	int cluster_id = end_cluster_id;
+	while (cluster_id != -1) {
+		navigation_clusters[cluster_id].in_corridor = true;
+		for (const uint32_t neighbor_id : cluster_neighbors[cluster_id]) {
+			navigation_clusters[neighbor_id].in_corridor = true;
+		}
+		cluster_id = navigation_clusters[cluster_id].back_navigation_cluster_id;
+	}
+
+	p_query_task.use_cluster_corridor = true;
+	return true;
+}
+
 void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const Polygon *begin_poly = p_query_task.begin_polygon;
@@ -400,6 +510,13 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (p_query_task.use_cluster_corridor && !path_search_max_reached) {
+				// The end polygon is not reachable inside the cluster corridor, let the caller search the whole map instead.
+				p_query_task.use_cluster_corridor = false;
+				p_query_task.cluster_corridor_failed = true;
+				return;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -530,8 +647,17 @@ void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D
 		return;
 	}
 
+	if (p_query_task.pathfinding_algorithm == PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR) {
+		_query_task_build_cluster_corridor(p_query_task, p_map_iteration);
+	}
+
 	_query_task_build_path_corridor(p_query_task, p_map_iteration);
 
+	if (p_query_task.cluster_corridor_failed) {
+		p_query_task.cluster_corridor_failed = false;
+		_query_task_build_path_corridor(p_query_task, p_map_iteration);
+	}
+
 	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
 		_query_task_process_path_result_limits(p_query_task);
 		return;
@@ -51,6 +51,8 @@ void NavRegionBuilder3D::build_iteration(NavRegionIterationBuild3D &r_build) {
 
 	_build_step_merge_edge_connection_pairs(r_build);
 
+	_build_step_polygon_clusters(r_build);
+
 	_build_update_iteration(r_build);
 }
 
@@ -256,6 +258,97 @@ void NavRegionBuilder3D::_build_step_merge_edge_connection_pairs(NavRegionIterat
 	}
 }
 
+void NavRegionBuilder3D::_build_step_polygon_clusters(NavRegionIterationBuild3D &r_build) {
+	Ref<NavRegionIteration3D> region_iteration = r_build.region_iteration;
+
+	const LocalVector<Nav3D::Polygon> &navmesh_polygons = region_iteration->navmesh_polygons;
+	const LocalVector<LocalVector<Connection>> &internal_connections = region_iteration->internal_connections;
+
+	LocalVector<uint32_t> &polygon_clusters = region_iteration->polygon_clusters;
+	LocalVector<Vector3> &cluster_positions = region_iteration->cluster_positions;
+	LocalVector<LocalVector<uint32_t>> &cluster_neighbors = region_iteration->cluster_neighbors;
+
+	const uint32_t polygon_count = navmesh_polygons.size();
+
+	polygon_clusters.resize(polygon_count);
+	for (uint32_t &polygon_cluster : polygon_clusters) {
+		polygon_cluster = UINT32_MAX;
+	}
+	cluster_positions.clear();
+	cluster_neighbors.clear();
+
+	// Grow clusters breadth-first over the internal connections so that each cluster is a compact,
+	// connected patch of polygons.
+	LocalVector<uint32_t> polygon_queue;
+	polygon_queue.reserve(NavigationDefaults3D::NAV_MESH_CLUSTER_POLYGON_COUNT);
+
+	for (uint32_t seed_index = 0; seed_index < polygon_count; seed_index++) {
+		if (polygon_clusters[seed_index] != UINT32_MAX) {
+			continue;
+		}
+
+		const uint32_t cluster_index = cluster_positions.size();
+
+		polygon_queue.clear();
+		polygon_queue.push_back(seed_index);
+		polygon_clusters[seed_index] = cluster_index;
+
+		Vector3 area_weighted_center;
+		real_t cluster_area = 0.0;
+		Vector3 vertex_center;
+		uint32_t vertex_count = 0;
+
+		for (uint32_t queue_index = 0; queue_index < polygon_queue.size(); queue_index++) {
+			const uint32_t polygon_index = polygon_queue[queue_index];
+			const Polygon &polygon = navmesh_polygons[polygon_index];
+
+			if (!polygon.vertices.is_empty()) {
+				Vector3 polygon_center;
+				for (const Vector3 &vertex : polygon.vertices) {
+					polygon_center += vertex;
+				}
+				vertex_center += polygon_center;
+				vertex_count += polygon.vertices.size();
+
+				polygon_center /= polygon.vertices.size();
+				area_weighted_center += polygon_center * polygon.surface_area;
+				cluster_area += polygon.surface_area;
+			}
+
+			for (const Connection &connection : internal_connections[polygon_index]) {
+				if (polygon_queue.size() >= (uint32_t)NavigationDefaults3D::NAV_MESH_CLUSTER_POLYGON_COUNT) {
+					break;
+				}
+				const uint32_t connected_index = connection.polygon->id;
+				if (polygon_clusters[connected_index] == UINT32_MAX) {
+					polygon_clusters[connected_index] = cluster_index;
+					polygon_queue.push_back(connected_index);
+				}
+			}
+		}
+
+		if (cluster_area > 0.0) {
+			cluster_positions.push_back(area_weighted_center / cluster_area);
+		} else if (vertex_count > 0) {
+			cluster_positions.push_back(vertex_center / vertex_count);
+		} else {
+			cluster_positions.push_back(Vector3());
+		}
+	}
+
+	// Connect clusters that share at least one polygon edge.
+	cluster_neighbors.resize(cluster_positions.size());
+	for (uint32_t polygon_index = 0; polygon_index < polygon_count; polygon_index++) {
+		const uint32_t cluster_index = polygon_clusters[polygon_index];
+		for (const Connection &connection : internal_connections[polygon_index]) {
+			const uint32_t connected_cluster_index = polygon_clusters[connection.polygon->id];
+			if (connected_cluster_index != cluster_index && !cluster_neighbors[cluster_index].has(connected_cluster_index)) {
+				cluster_neighbors[cluster_index].push_back(connected_cluster_index);
+			}
+		}
+	}
+}
+
 void NavRegionBuilder3D::_build_update_iteration(NavRegionIterationBuild3D &r_build) {
 	ERR_FAIL_NULL(r_build.region);
 	// Stub. End of the build.
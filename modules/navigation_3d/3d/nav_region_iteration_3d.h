@@ -78,6 +78,12 @@ public:
 	AABB bounds;
 	LocalVector<Nav3D::ConnectableEdge> external_edges;
 
+	// Clusters of connected polygons used by hierarchical pathfinding.
+	// They only depend on the region navmesh, so they are rebuilt together with the region iteration.
+	LocalVector<uint32_t> polygon_clusters;
+	LocalVector<Vector3> cluster_positions;
+	LocalVector<LocalVector<uint32_t>> cluster_neighbors;
+
 	const Transform3D &get_transform() const { return transform; }
 	real_t get_surface_area() const { return surface_area; }
 	AABB get_bounds() const { return bounds; }
@@ -85,6 +91,9 @@ public:
 
 	virtual ~NavRegionIteration3D() override {
 		external_edges.clear();
+		polygon_clusters.clear();
+		cluster_positions.clear();
+		cluster_neighbors.clear();
 		navmesh_polygons.clear();
 		internal_connections.clear();
 	}
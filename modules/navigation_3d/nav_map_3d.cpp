@@ -68,6 +68,11 @@ using namespace Nav3D;
 	NavMapIterationRead3D iteration_read_lock(map_iteration); \
 	iteration_slot_rwlock.read_unlock();
 
+// Below this amount of agents building the avoidance kd-trees on a single thread is cheaper than dispatching it.
+constexpr uint32_t AVOIDANCE_THREADED_TREE_BUILD_MIN_AGENTS = 1024;
+// Depth at which the avoidance kd-trees are split into subtrees built in parallel, giving up to 2^depth subtrees.
+constexpr size_t AVOIDANCE_THREADED_TREE_BUILD_DEPTH = 5;
+
 void NavMap3D::set_up(Vector3 p_up) {
 	if (up == p_up) {
 		return;
@@ -151,34 +156,67 @@ void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task
 
 	GET_MAP_ITERATION();
 
-	map_iteration.path_query_slots_semaphore.wait();
+	_query_path_on_iteration(p_query_task, map_iteration);
+}
+
+void NavMap3D::query_paths(NavMeshQueries3D::NavMeshPathQueryTask3D **p_query_tasks, uint32_t p_query_task_count) {
+	if (iteration_id == 0 || p_query_task_count == 0) {
+		return;
+	}
+
+	// The whole batch runs against the same map iteration, which stays read locked until all queries are done.
+	GET_MAP_ITERATION();
+
+	PathQueryBatch batch;
+	batch.map_iteration = &map_iteration;
+	batch.query_tasks = p_query_tasks;
+
+	if (!use_threads || p_query_task_count == 1) {
+		for (uint32_t i = 0; i < p_query_task_count; i++) {
+			_query_path_on_iteration(*p_query_tasks[i], map_iteration);
+		}
+		return;
+	}
+
+	// No point in using more threads than there are path query slots, they would just wait on each other.
+	const int task_count = MIN(map_iteration.path_query_slots.size(), p_query_task_count);
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::_query_path_batch_step, &batch, p_query_task_count, task_count, true, SNAME("NavigationPathQueries3D"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void NavMap3D::_query_path_batch_step(uint32_t p_index, PathQueryBatch *p_batch) {
+	_query_path_on_iteration(*p_batch->query_tasks[p_index], *p_batch->map_iteration);
+}
 
-	map_iteration.path_query_slots_mutex.lock();
-	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
+void NavMap3D::_query_path_on_iteration(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task, NavMapIteration3D &p_map_iteration) {
+	p_map_iteration.path_query_slots_semaphore.wait();
+
+	p_map_iteration.path_query_slots_mutex.lock();
+	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : p_map_iteration.path_query_slots) {
 		if (!p_path_query_slot.in_use) {
 			p_path_query_slot.in_use = true;
 			p_query_task.path_query_slot = &p_path_query_slot;
 			break;
 		}
 	}
-	map_iteration.path_query_slots_mutex.unlock();
+	p_map_iteration.path_query_slots_mutex.unlock();
 
 	if (p_query_task.path_query_slot == nullptr) {
-		map_iteration.path_query_slots_semaphore.post();
+		p_map_iteration.path_query_slots_semaphore.post();
 		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
 	}
 
-	p_query_task.map_up = map_iteration.map_up;
+	p_query_task.map_up = p_map_iteration.map_up;
 
-	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
+	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, p_map_iteration);
 
-	map_iteration.path_query_slots_mutex.lock();
+	p_map_iteration.path_query_slots_mutex.lock();
 	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
-	map_iteration.path_query_slots[used_slot_index].in_use = false;
+	p_map_iteration.path_query_slots[used_slot_index].in_use = false;
 	p_query_task.path_query_slot = nullptr;
-	map_iteration.path_query_slots_mutex.unlock();
+	p_map_iteration.path_query_slots_mutex.unlock();
 
-	map_iteration.path_query_slots_semaphore.post();
+	p_map_iteration.path_query_slots_semaphore.post();
 }
 
 Vector3 NavMap3D::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
@@ -570,7 +608,16 @@ void NavMap3D::_update_rvo_agents_tree_2d() {
 	for (NavAgent3D *agent : active_2d_avoidance_agents) {
 		raw_agents.push_back(agent->get_rvo_agent_2d());
 	}
-	rvo_simulation_2d.kdTree_->buildAgentTree(raw_agents);
+
+	if (use_threads && avoidance_use_multiple_threads && raw_agents.size() >= AVOIDANCE_THREADED_TREE_BUILD_MIN_AGENTS) {
+		// The subtrees below the top levels cover disjoint ranges, the resulting tree is the same as a serial build.
+		std::vector<RVO2D::KdTree2D::AgentSubtree> subtrees;
+		rvo_simulation_2d.kdTree_->buildAgentTreeTop(raw_agents, AVOIDANCE_THREADED_TREE_BUILD_DEPTH, subtrees);
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::_build_rvo_agent_subtree_2d, subtrees.data(), subtrees.size(), -1, true, SNAME("RVOAgentsTree2D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		rvo_simulation_2d.kdTree_->buildAgentTree(raw_agents);
+	}
 }
 
 void NavMap3D::_update_rvo_agents_tree_3d() {
@@ -580,7 +627,24 @@ void NavMap3D::_update_rvo_agents_tree_3d() {
 	for (NavAgent3D *agent : active_3d_avoidance_agents) {
 		raw_agents.push_back(agent->get_rvo_agent_3d());
 	}
-	rvo_simulation_3d.kdTree_->buildAgentTree(raw_agents);
+
+	if (use_threads && avoidance_use_multiple_threads && raw_agents.size() >= AVOIDANCE_THREADED_TREE_BUILD_MIN_AGENTS) {
+		// The subtrees below the top levels cover disjoint ranges, the resulting tree is the same as a serial build.
+		std::vector<RVO3D::KdTree3D::AgentSubtree> subtrees;
+		rvo_simulation_3d.kdTree_->buildAgentTreeTop(raw_agents, AVOIDANCE_THREADED_TREE_BUILD_DEPTH, subtrees);
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::_build_rvo_agent_subtree_3d, subtrees.data(), subtrees.size(), -1, true, SNAME("RVOAgentsTree3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		rvo_simulation_3d.kdTree_->buildAgentTree(raw_agents);
+	}
+}
+
+void NavMap3D::_build_rvo_agent_subtree_2d(uint32_t p_index, RVO2D::KdTree2D::AgentSubtree *p_subtrees) {
+	rvo_simulation_2d.kdTree_->buildAgentSubtree(p_subtrees[p_index]);
+}
+
+void NavMap3D::_build_rvo_agent_subtree_3d(uint32_t p_index, RVO3D::KdTree3D::AgentSubtree *p_subtrees) {
+	rvo_simulation_3d.kdTree_->buildAgentSubtree(p_subtrees[p_index]);
 }
 
 void NavMap3D::_update_rvo_simulation() {
@@ -593,18 +657,16 @@ void NavMap3D::_update_rvo_simulation() {
 	}
 }
 
+// Only reads the positions and velocities of the other agents, which are not changed
+// before all agents computed their new velocity, so the result does not depend on the thread count.
 void NavMap3D::compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent) {
 	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
 	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-	(*(agent + index))->update();
 }
 
 void NavMap3D::compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent) {
 	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
 	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-	(*(agent + index))->update();
 }
 
 void NavMap3D::step(double p_delta_time) {
@@ -619,10 +681,13 @@ void NavMap3D::step(double p_delta_time) {
 			for (NavAgent3D *agent : active_2d_avoidance_agents) {
 				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
 				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-				agent->update();
 			}
 		}
+
+		for (NavAgent3D *agent : active_2d_avoidance_agents) {
+			agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+			agent->update();
+		}
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
@@ -633,10 +698,13 @@ void NavMap3D::step(double p_delta_time) {
 			for (NavAgent3D *agent : active_3d_avoidance_agents) {
 				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
 				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-				agent->update();
 			}
 		}
+
+		for (NavAgent3D *agent : active_3d_avoidance_agents) {
+			agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
+			agent->update();
+		}
 	}
 }
 
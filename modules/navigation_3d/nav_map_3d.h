@@ -138,6 +138,11 @@ class NavMap3D : public NavRid3D {
 
 	int path_query_slots_max = 4;
 
+	struct PathQueryBatch {
+		NavMapIteration3D *map_iteration = nullptr;
+		NavMeshQueries3D::NavMeshPathQueryTask3D **query_tasks = nullptr;
+	};
+
 	bool use_async_iterations = true;
 
 	uint32_t iteration_slot_index = 0;
@@ -198,6 +203,7 @@ public:
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+	void query_paths(NavMeshQueries3D::NavMeshPathQueryTask3D **p_query_tasks, uint32_t p_query_task_count);
 
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
@@ -278,9 +284,15 @@ private:
 
 	void compute_single_step(uint32_t index, NavAgent3D **agent);
 
+	void _query_path_on_iteration(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task, NavMapIteration3D &p_map_iteration);
+	void _query_path_batch_step(uint32_t p_index, PathQueryBatch *p_batch);
+
 	void compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent);
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent);
 
+	void _build_rvo_agent_subtree_2d(uint32_t p_index, RVO2D::KdTree2D::AgentSubtree *p_subtrees);
+	void _build_rvo_agent_subtree_3d(uint32_t p_index, RVO3D::KdTree3D::AgentSubtree *p_subtrees);
+
 	void _sync_avoidance();
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
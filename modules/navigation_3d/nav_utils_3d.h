@@ -171,6 +171,63 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+struct PolygonCluster {
+	/// Area weighted center of the cluster polygons, used as the cluster position in the abstract graph.
+	Vector3 position;
+
+	/// Navigation region or link that contains the polygons of this cluster.
+	const NavBaseIteration3D *owner = nullptr;
+};
+
+struct NavigationCluster {
+	/// Index in the heap of traversable clusters.
+	uint32_t traversable_cluster_index = UINT32_MAX;
+
+	/// The cluster this one was reached from.
+	int back_navigation_cluster_id = -1;
+
+	/// The distance traveled until now (g cost).
+	real_t traveled_distance = FLT_MAX;
+	/// The distance to the destination (h cost).
+	real_t distance_to_destination = 0.0;
+
+	/// True if the polygons of this cluster can be used by the refining polygon search.
+	bool in_corridor = false;
+
+	/// The total travel cost (f cost).
+	real_t total_travel_cost() const {
+		return traveled_distance + distance_to_destination;
+	}
+
+	void reset() {
+		traversable_cluster_index = UINT32_MAX;
+		back_navigation_cluster_id = -1;
+		traveled_distance = FLT_MAX;
+		distance_to_destination = 0.0;
+		in_corridor = false;
+	}
+};
+
+struct NavClusterTravelCostGreaterThan {
+	// Returns `true` if the travel cost of `a` is higher than that of `b`.
+	bool operator()(const NavigationCluster *p_cluster_a, const NavigationCluster *p_cluster_b) const {
+		real_t f_cost_a = p_cluster_a->total_travel_cost();
+		real_t f_cost_b = p_cluster_b->total_travel_cost();
+
+		if (f_cost_a != f_cost_b) {
+			return f_cost_a > f_cost_b;
+		} else {
+			return p_cluster_a->distance_to_destination > p_cluster_b->distance_to_destination;
+		}
+	}
+};
+
+struct NavClusterHeapIndexer {
+	void operator()(NavigationCluster *p_cluster, uint32_t p_heap_index) const {
+		p_cluster->traversable_cluster_index = p_heap_index;
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
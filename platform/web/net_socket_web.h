@@ -65,6 +65,7 @@ public:
 
 	virtual Error set_broadcasting_enabled(bool p_enabled) override { return ERR_UNAVAILABLE; }
 	virtual void set_blocking_enabled(bool p_enabled) override {}
+	virtual bool is_blocking_enabled() const override { return false; }
 	virtual void set_ipv6_only_enabled(bool p_enabled) override {}
 	virtual void set_tcp_no_delay_enabled(bool p_enabled) override {}
 	virtual void set_reuse_address_enabled(bool p_enabled) override {}
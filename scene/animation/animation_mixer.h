@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/object/class_db.h"
 #include "core/templates/a_hash_map.h"
 #include "scene/animation/tween.h"
 #include "scene/main/node.h"
@@ -223,7 +224,7 @@ protected:
 	struct TrackCacheValue : public TrackCache {
 		Variant init_value;
 		Variant value;
-		Vector<StringName> subpath;
+		PropertyAccessor property; // The animated property, resolved for the class of the object when the cache is built.
 
 		// TODO: There are many boolean, can be packed into one integer.
 		bool is_init = false;
@@ -238,7 +239,7 @@ protected:
 				TrackCache(p_other),
 				init_value(p_other.init_value),
 				value(p_other.value),
-				subpath(p_other.subpath),
+				property(p_other.property),
 				is_init(p_other.is_init),
 				use_continuous(p_other.use_continuous),
 				use_discrete(p_other.use_discrete),
@@ -624,7 +624,7 @@ void PropertyTweener::start() {
 
 	if (do_continue) {
 		if (Math::is_zero_approx(delay)) {
-			initial_val = target_instance->get_indexed(property);
+			initial_val = property.get(target_instance);
 		} else {
 			do_continue_delayed = true;
 		}
@@ -654,7 +654,7 @@ bool PropertyTweener::step(double &r_delta) {
 		r_delta = 0;
 		return true;
 	} else if (do_continue_delayed && !Math::is_zero_approx(delay)) {
-		initial_val = target_instance->get_indexed(property);
+		initial_val = property.get(target_instance);
 		delta_val = Animation::subtract_variant(final_val, initial_val);
 		do_continue_delayed = false;
 	}
@@ -666,18 +666,18 @@ bool PropertyTweener::step(double &r_delta) {
 		if (custom_method.is_valid()) {
 			const Variant t = tween->interpolate_variant(0.0, 1.0, time, duration, trans_type, ease_type);
 			double result = _get_custom_interpolated_value(t);
-			target_instance->set_indexed(property, Animation::interpolate_variant(initial_val, final_val, result));
+			property.set(target_instance, Animation::interpolate_variant(initial_val, final_val, result));
 		} else {
-			target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+			property.set(target_instance, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
 		}
 		r_delta = 0;
 		return true;
 	} else {
 		if (custom_method.is_valid()) {
 			double final_t = _get_custom_interpolated_value(1.0);
-			target_instance->set_indexed(property, Animation::interpolate_variant(initial_val, final_val, final_t));
+			property.set(target_instance, Animation::interpolate_variant(initial_val, final_val, final_t));
 		} else {
-			target_instance->set_indexed(property, final_val);
+			property.set(target_instance, final_val);
 		}
 		r_delta = elapsed_time - delay - duration;
 		_finish();
@@ -707,8 +707,8 @@ void PropertyTweener::_bind_methods() {
 
 PropertyTweener::PropertyTweener(const Object *p_target, const Vector<StringName> &p_property, const Variant &p_to, double p_duration) {
 	target = p_target->get_instance_id();
-	property = p_property;
-	initial_val = p_target->get_indexed(property);
+	property = ClassDB::get_property_accessor(p_target->get_class_name(), p_property);
+	initial_val = property.get(p_target);
 	base_final_val = p_to;
 	final_val = base_final_val;
 	duration = p_duration;
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 #include "core/variant/type_info.h"
 
@@ -227,7 +228,7 @@ protected:
 
 private:
 	ObjectID target;
-	Vector<StringName> property;
+	PropertyAccessor property;
 	Variant initial_val;
 	Variant base_final_val;
 	Variant final_val;
@@ -3958,6 +3958,8 @@ void Node::_bind_methods() {
 	BIND_CONSTANT(NOTIFICATION_DISABLED);
 	BIND_CONSTANT(NOTIFICATION_ENABLED);
 	BIND_CONSTANT(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
+	BIND_CONSTANT(NOTIFICATION_SCENE_INSTANCE_POOLED);
+	BIND_CONSTANT(NOTIFICATION_SCENE_INSTANCE_RECYCLED);
 
 	BIND_CONSTANT(NOTIFICATION_EDITOR_PRE_SAVE);
 	BIND_CONSTANT(NOTIFICATION_EDITOR_POST_SAVE);
@@ -475,6 +475,8 @@ public:
 		NOTIFICATION_DISABLED = 28,
 		NOTIFICATION_ENABLED = 29,
 		NOTIFICATION_RESET_PHYSICS_INTERPOLATION = 2001, // A GodotSpace Odyssey.
+		NOTIFICATION_SCENE_INSTANCE_POOLED = 2002,
+		NOTIFICATION_SCENE_INSTANCE_RECYCLED = 2003,
 		// Keep these linked to Node.
 
 		NOTIFICATION_ACCESSIBILITY_UPDATE = 3000,
@@ -4107,6 +4107,69 @@ void Animation::_bind_methods() {
 	BIND_ENUM_CONSTANT(FIND_MODE_EXACT);
 }
 
+uint64_t Animation::get_estimated_memory_usage() const {
+	uint64_t size = sizeof(Animation) + tracks.size() * sizeof(Track *);
+
+	for (const Track *track : tracks) {
+		switch (track->type) {
+			case TYPE_POSITION_3D: {
+				const PositionTrack *tt = static_cast<const PositionTrack *>(track);
+				size += sizeof(PositionTrack) + tt->positions.size() * sizeof(TKey<Vector3>);
+			} break;
+			case TYPE_ROTATION_3D: {
+				const RotationTrack *rt = static_cast<const RotationTrack *>(track);
+				size += sizeof(RotationTrack) + rt->rotations.size() * sizeof(TKey<Quaternion>);
+			} break;
+			case TYPE_SCALE_3D: {
+				const ScaleTrack *st = static_cast<const ScaleTrack *>(track);
+				size += sizeof(ScaleTrack) + st->scales.size() * sizeof(TKey<Vector3>);
+			} break;
+			case TYPE_BLEND_SHAPE: {
+				const BlendShapeTrack *bst = static_cast<const BlendShapeTrack *>(track);
+				size += sizeof(BlendShapeTrack) + bst->blend_shapes.size() * sizeof(TKey<float>);
+			} break;
+			case TYPE_VALUE: {
+				const ValueTrack *vt = static_cast<const ValueTrack *>(track);
+				size += sizeof(ValueTrack) + vt->values.size() * sizeof(Key);
+				for (const TKey<Variant> &key : vt->values) {
+					size += Resource::get_variant_estimated_memory_usage(key.value);
+				}
+			} break;
+			case TYPE_METHOD: {
+				const MethodTrack *mt = static_cast<const MethodTrack *>(track);
+				size += sizeof(MethodTrack) + mt->methods.size() * sizeof(MethodKey);
+				for (const MethodKey &key : mt->methods) {
+					for (const Variant &param : key.params) {
+						size += Resource::get_variant_estimated_memory_usage(param);
+					}
+				}
+			} break;
+			case TYPE_BEZIER: {
+				const BezierTrack *bt = static_cast<const BezierTrack *>(track);
+				size += sizeof(BezierTrack) + bt->values.size() * sizeof(TKey<BezierKey>);
+			} break;
+			case TYPE_AUDIO: {
+				// Streams are resources of their own.
+				const AudioTrack *ad = static_cast<const AudioTrack *>(track);
+				size += sizeof(AudioTrack) + ad->values.size() * sizeof(TKey<AudioKey>);
+			} break;
+			case TYPE_ANIMATION: {
+				const AnimationTrack *an = static_cast<const AnimationTrack *>(track);
+				size += sizeof(AnimationTrack) + an->values.size() * sizeof(TKey<StringName>);
+			} break;
+		}
+	}
+
+	// Compressed tracks keep their keys in pages instead.
+	for (const Compression::Page &page : compression.pages) {
+		size += sizeof(Compression::Page) + page.data.size();
+	}
+	size += compression.bounds.size() * sizeof(AABB);
+	size += marker_names.size() * sizeof(MarkerKey);
+
+	return size;
+}
+
 void Animation::clear() {
 	for (uint32_t i = 0; i < tracks.size(); i++) {
 		memdelete(tracks[i]);
@@ -525,6 +525,10 @@ void AudioStreamWAV::set_data(const Vector<uint8_t> &p_data) {
 	AudioServer::get_singleton()->unlock();
 }
 
+uint64_t AudioStreamWAV::get_estimated_memory_usage() const {
+	return sizeof(AudioStreamWAV) + data.size();
+}
+
 Vector<uint8_t> AudioStreamWAV::get_data() const {
 	return Vector<uint8_t>(data);
 }
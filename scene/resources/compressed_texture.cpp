@@ -208,6 +208,11 @@ int CompressedTexture2D::get_height() const {
 	return h;
 }
 
+uint64_t CompressedTexture2D::get_estimated_memory_usage() const {
+	// Mipmaps are not tracked here, assume they exist to stay within the budget.
+	return sizeof(CompressedTexture2D) + Image::get_image_data_size(w, h, format, true);
+}
+
 RID CompressedTexture2D::get_rid() const {
 	if (!texture.is_valid()) {
 		texture = RS::get_singleton()->texture_2d_placeholder_create();
@@ -94,6 +94,7 @@ public:
 	int get_width() const override;
 	int get_height() const override;
 	virtual RID get_rid() const override;
+	virtual uint64_t get_estimated_memory_usage() const override;
 
 	virtual void set_path(const String &p_path, bool p_take_over) override;
 
@@ -129,6 +129,10 @@ int ImageTexture::get_height() const {
 	return h;
 }
 
+uint64_t ImageTexture::get_estimated_memory_usage() const {
+	return sizeof(ImageTexture) + Image::get_image_data_size(w, h, format, mipmaps);
+}
+
 RID ImageTexture::get_rid() const {
 	if (texture.is_null()) {
 		// We are in trouble, create something temporary.
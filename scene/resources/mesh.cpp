@@ -2011,6 +2011,29 @@ RID ArrayMesh::get_rid() const {
 	return mesh;
 }
 
+uint64_t ArrayMesh::get_estimated_memory_usage() const {
+	uint64_t size = sizeof(ArrayMesh);
+	const RenderingServer *rs = RenderingServer::get_singleton();
+	if (!rs) {
+		return size;
+	}
+
+	// The surface arrays live in the RenderingServer, their size follows from the format.
+	for (const Surface &surface : surfaces) {
+		uint32_t offsets[RSE::ARRAY_MAX];
+		uint32_t vertex_stride = 0;
+		uint32_t normal_tangent_stride = 0;
+		uint32_t attribute_stride = 0;
+		uint32_t skin_stride = 0;
+		rs->mesh_surface_make_offsets_from_format(surface.format & ~RSE::ARRAY_FORMAT_INDEX, surface.array_length, 0, offsets, vertex_stride, normal_tangent_stride, attribute_stride, skin_stride);
+
+		size += uint64_t(surface.array_length) * (vertex_stride + normal_tangent_stride + attribute_stride + skin_stride);
+		size += uint64_t(surface.array_length) * (vertex_stride + normal_tangent_stride) * blend_shapes.size();
+		size += uint64_t(surface.index_array_length) * rs->mesh_surface_get_format_index_stride(surface.format, surface.array_length);
+	}
+	return size;
+}
+
 AABB ArrayMesh::get_aabb() const {
 	return aabb;
 }
@@ -152,6 +152,60 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
+const SceneState::InstantiationPlan &SceneState::_get_instantiation_plan() const {
+	if (instantiation_plan_ready.is_set()) {
+		return instantiation_plan;
+	}
+
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_ready.is_set()) {
+		return instantiation_plan;
+	}
+
+	instantiation_plan.nodes.clear();
+	instantiation_plan.nodes.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		InstantiationPlan::NodeInfo &info = instantiation_plan.nodes[i];
+
+		// Only nodes created from a native class are planned, anything coming from another scene may be of any type.
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size()) {
+			continue;
+		}
+		const StringName &type = names[n.type];
+		info.creation_func = ClassDB::get_native_creation_func(type);
+		if (!info.creation_func) {
+			continue;
+		}
+
+		info.properties.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			const NodeData::Property &prop = n.properties[j];
+			if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name < 0 || prop.name >= names.size() || prop.value < 0 || prop.value >= variants.size()) {
+				continue;
+			}
+
+			// Objects and containers may need to be duplicated or retyped for each instance.
+			const Variant::Type value_type = variants[prop.value].get_type();
+			if (value_type == Variant::OBJECT || value_type == Variant::ARRAY || value_type == Variant::DICTIONARY || names[prop.name] == CoreStringName(script)) {
+				continue;
+			}
+
+			info.properties[j] = ClassDB::get_property_accessor(type, names[prop.name]);
+		}
+	}
+
+	instantiation_plan_ready.set();
+	return instantiation_plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_ready.clear();
+	instantiation_plan.nodes.clear();
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -199,8 +253,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	bool deep_search_warned = false;
 
+	// The editor needs the generic path, which also records edits and keeps values around for inspection.
+	const InstantiationPlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		plan = &_get_instantiation_plan();
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
+		const InstantiationPlan::NodeInfo *planned_node = nullptr;
 
 		Node *parent = nullptr;
 		String old_parent_path;
@@ -315,9 +376,17 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			// Node belongs to this scene and must be created.
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *obj = nullptr;
+			if (plan && plan->nodes[i].creation_func) {
+				obj = plan->nodes[i].creation_func(true);
+			} else {
+				obj = ClassDB::instantiate(snames[n.type]);
+			}
 
 			node = Object::cast_to<Node>(obj);
+			if (node && plan && plan->nodes[i].creation_func) {
+				planned_node = &plan->nodes[i];
+			}
 
 			if (!node) {
 				if (obj) {
@@ -373,6 +442,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 					ERR_FAIL_INDEX_V(nprops[j].value, prop_count, nullptr);
 
+					// A script may intercept any property, so it must go through Object::set().
+					if (planned_node && planned_node->properties[j].has_setter() && planned_node->properties[j].is_compatible(node)) {
+						planned_node->properties[j].set(node, props[nprops[j].value]);
+						continue;
+					}
+
 					if (nprops[j].name & FLAG_PATH_PROPERTY_IS_NODE) {
 						if (!Engine::get_singleton()->is_editor_hint() && node->get_scene_instance_load_placeholder()) {
 							// We cannot know if the referenced nodes exist yet, so instead of deferring, we write the NodePaths directly.
@@ -1445,6 +1520,7 @@ void SceneState::clear() {
 	ids.clear();
 	id_paths.clear();
 	base_scene_idx = -1;
+	_clear_instantiation_plan();
 }
 
 Error SceneState::copy_from(const Ref<SceneState> &p_scene_state) {
@@ -1657,6 +1733,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("names"));
 	ERR_FAIL_COND(!p_dictionary.has("variants"));
 	ERR_FAIL_COND(!p_dictionary.has("node_count"));
+
+	_clear_instantiation_plan();
 	ERR_FAIL_COND(!p_dictionary.has("nodes"));
 	ERR_FAIL_COND(!p_dictionary.has("conn_count"));
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
@@ -1881,6 +1959,32 @@ Dictionary SceneState::get_bundled_scene() const {
 	return d;
 }
 
+uint64_t SceneState::get_estimated_memory_usage() const {
+	uint64_t size = sizeof(SceneState);
+	size += names.size() * sizeof(StringName);
+	size += node_paths.size() * sizeof(NodePath);
+	size += editable_instances.size() * sizeof(NodePath);
+
+	for (const Variant &variant : variants) {
+		size += Resource::get_variant_estimated_memory_usage(variant);
+		// Built-in resources are only kept alive by the scene, external ones are cached on their own.
+		const Ref<Resource> resource = variant;
+		if (resource.is_valid() && resource->is_built_in()) {
+			size += resource->get_estimated_memory_usage();
+		}
+	}
+
+	for (const NodeData &node : nodes) {
+		size += sizeof(NodeData) + node.properties.size() * sizeof(NodeData::Property) + node.groups.size() * sizeof(int);
+	}
+
+	for (const ConnectionData &connection : connections) {
+		size += sizeof(ConnectionData) + connection.binds.size() * sizeof(int);
+	}
+
+	return size;
+}
+
 int SceneState::get_node_count() const {
 	return nodes.size();
 }
@@ -2313,6 +2417,8 @@ int SceneState::add_node_path(const NodePath &p_path, const PackedInt32Array &p_
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index, int32_t p_unique_id) {
+	_clear_instantiation_plan();
+
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -2332,6 +2438,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	ERR_FAIL_INDEX(p_node, nodes.size());
 	ERR_FAIL_INDEX(p_name, names.size());
 	ERR_FAIL_INDEX(p_value, variants.size());
+	_clear_instantiation_plan();
 
 	NodeData::Property prop;
 	prop.name = p_name;
@@ -2351,6 +2458,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
 	base_scene_idx = p_idx;
+	_clear_instantiation_plan();
 }
 
 void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method, int p_flags, int p_unbinds, const Vector<int> &p_binds) {
@@ -2462,7 +2570,11 @@ SceneState::SceneState() {
 
 ////////////////
 
+SafeNumeric<uint64_t> PackedScene::pool_hits;
+SafeNumeric<uint64_t> PackedScene::pool_misses;
+
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
+	clear_pool();
 	state->set_bundled_scene(p_scene);
 }
 
@@ -2471,10 +2583,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	clear_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	clear_pool();
 	state->clear();
 }
 
@@ -2528,6 +2642,7 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 }
 
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	clear_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2536,6 +2651,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_pool();
 	state.instantiate();
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2543,6 +2659,196 @@ void PackedScene::recreate_state() {
 #endif
 }
 
+void PackedScene::_capture_pool_defaults(const Node *p_node) {
+	PoolNodeDefaults defaults;
+	defaults.type = p_node->get_class_name();
+	defaults.script = p_node->get_script();
+	defaults.child_count = p_node->get_child_count(true);
+
+	List<PropertyInfo> plist;
+	p_node->get_property_list(&plist);
+	for (const PropertyInfo &pi : plist) {
+		if (!(pi.usage & PROPERTY_USAGE_STORAGE) || pi.name == CoreStringName(script)) {
+			continue;
+		}
+		if (pi.hint == PROPERTY_HINT_NODE_TYPE) {
+			continue; // Points into this instance, can't be carried over to another one.
+		}
+
+		Variant value = p_node->get(pi.name);
+		if (value.get_type() == Variant::OBJECT) {
+			Ref<Resource> res = value;
+			if (value.get_validated_object() && (res.is_null() || res->is_local_to_scene())) {
+				continue; // Nodes and resources owned by this instance alone.
+			}
+		} else if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+			value = value.duplicate(true);
+		}
+		defaults.properties.push_back(Pair<StringName, Variant>(pi.name, value));
+	}
+	pool_defaults.push_back(defaults);
+
+	for (int i = 0; i < defaults.child_count; i++) {
+		_capture_pool_defaults(p_node->get_child(i, true));
+	}
+}
+
+bool PackedScene::_matches_pool_defaults(const Node *p_node, uint32_t &r_index) const {
+	if (r_index >= pool_defaults.size()) {
+		return false;
+	}
+
+	const PoolNodeDefaults &defaults = pool_defaults[r_index++];
+	if (p_node->get_class_name() != defaults.type || p_node->get_script() != defaults.script || p_node->get_child_count(true) != defaults.child_count) {
+		return false;
+	}
+
+	for (int i = 0; i < defaults.child_count; i++) {
+		if (!_matches_pool_defaults(p_node->get_child(i, true), r_index)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void PackedScene::_restore_pool_defaults(Node *p_node, const LocalVector<PoolNodeDefaults> &p_defaults, uint32_t &r_index) {
+	const PoolNodeDefaults &defaults = p_defaults[r_index++];
+	for (const Pair<StringName, Variant> &E : defaults.properties) {
+		if (p_node->get(E.first) == E.second) {
+			continue;
+		}
+		if (E.second.get_type() == Variant::ARRAY || E.second.get_type() == Variant::DICTIONARY) {
+			p_node->set(E.first, E.second.duplicate(true));
+		} else {
+			p_node->set(E.first, E.second);
+		}
+	}
+
+	for (int i = 0; i < defaults.child_count; i++) {
+		_restore_pool_defaults(p_node->get_child(i, true), p_defaults, r_index);
+	}
+}
+
+Node *PackedScene::acquire_instance() {
+	Node *node = nullptr;
+	{
+		MutexLock lock(pool_mutex);
+		while (!node && !pool.is_empty()) {
+			// Skips instances that were freed while pooled.
+			node = ObjectDB::get_instance<Node>(pool[pool.size() - 1]);
+			pool.resize(pool.size() - 1);
+		}
+	}
+
+	if (node) {
+		pool_hits.increment();
+		node->propagate_notification(Node::NOTIFICATION_SCENE_INSTANCE_RECYCLED);
+		return node;
+	}
+
+	node = instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+	pool_misses.increment();
+
+	MutexLock lock(pool_mutex);
+	if (pool_defaults.is_empty()) {
+		// Taken before the caller gets to modify the instance, so it matches what the scene stores.
+		_capture_pool_defaults(node);
+	}
+	return node;
+}
+
+void PackedScene::release_instance(Node *p_instance) {
+	ERR_FAIL_NULL(p_instance);
+	ERR_FAIL_COND_MSG(p_instance->is_queued_for_deletion(), "Can't release an instance that is queued for deletion.");
+	ERR_FAIL_COND_MSG(!is_built_in() && p_instance->get_scene_file_path() != get_path(), vformat("The node \"%s\" is not an instance of \"%s\".", p_instance->get_name(), get_path()));
+
+	if (p_instance->get_parent()) {
+		p_instance->get_parent()->remove_child(p_instance);
+		// Removal fails while the parent is busy adding or removing children, or inside a physics callback.
+		ERR_FAIL_COND_MSG(p_instance->get_parent(), vformat("Can't release the node \"%s\" while it can't be removed from its parent. Use call_deferred() instead.", p_instance->get_name()));
+	}
+	p_instance->propagate_notification(Node::NOTIFICATION_SCENE_INSTANCE_POOLED);
+
+	LocalVector<PoolNodeDefaults> defaults;
+	{
+		MutexLock lock(pool_mutex);
+		uint32_t index = 0;
+		if ((int)pool.size() < pool_size && _matches_pool_defaults(p_instance, index) && index == pool_defaults.size()) {
+			defaults = pool_defaults;
+		}
+	}
+
+	if (!defaults.is_empty()) {
+		// Setters may run script code that uses the pool, so the lock isn't held here.
+		uint32_t index = 0;
+		_restore_pool_defaults(p_instance, defaults, index);
+
+		MutexLock lock(pool_mutex);
+		if ((int)pool.size() < pool_size) {
+			pool.push_back(p_instance->get_instance_id());
+			return;
+		}
+	}
+
+	// Full pool, or the instance no longer has the structure of the scene.
+	// Freed at the end of the frame, since the caller may be the instance itself.
+	p_instance->queue_free();
+}
+
+void PackedScene::clear_pool() {
+	LocalVector<ObjectID> to_free;
+	{
+		MutexLock lock(pool_mutex);
+		to_free = std::move(pool);
+		pool.clear();
+		pool_defaults.clear();
+	}
+
+	for (const ObjectID &id : to_free) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int PackedScene::get_pooled_instance_count() const {
+	MutexLock lock(pool_mutex);
+	int count = 0;
+	for (const ObjectID &id : pool) {
+		if (ObjectDB::get_instance(id)) {
+			count++;
+		}
+	}
+	return count;
+}
+
+void PackedScene::set_pool_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+
+	LocalVector<ObjectID> to_free;
+	{
+		MutexLock lock(pool_mutex);
+		pool_size = p_size;
+		while ((int)pool.size() > pool_size) {
+			to_free.push_back(pool[pool.size() - 1]);
+			pool.resize(pool.size() - 1);
+		}
+	}
+
+	for (const ObjectID &id : to_free) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int PackedScene::get_pool_size() const {
+	return pool_size;
+}
+
 #ifdef TOOLS_ENABLED
 HashSet<StringName> PackedScene::get_scene_groups(const String &p_path) {
 	{
@@ -2593,6 +2899,10 @@ HashSet<StringName> PackedScene::get_scene_groups(const String &p_path) {
 }
 #endif
 
+uint64_t PackedScene::get_estimated_memory_usage() const {
+	return sizeof(PackedScene) + state->get_estimated_memory_usage();
+}
+
 Ref<SceneState> PackedScene::get_state() const {
 	return state;
 }
@@ -2618,6 +2928,13 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
 
+	ClassDB::bind_method(D_METHOD("acquire_instance"), &PackedScene::acquire_instance);
+	ClassDB::bind_method(D_METHOD("release_instance", "instance"), &PackedScene::release_instance);
+	ClassDB::bind_method(D_METHOD("clear_pool"), &PackedScene::clear_pool);
+	ClassDB::bind_method(D_METHOD("get_pooled_instance_count"), &PackedScene::get_pooled_instance_count);
+	ClassDB::bind_method(D_METHOD("set_pool_size", "size"), &PackedScene::set_pool_size);
+	ClassDB::bind_method(D_METHOD("get_pool_size"), &PackedScene::get_pool_size);
+
 	ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "_bundled", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE | PROPERTY_USAGE_INTERNAL), "_set_bundled_scene", "_get_bundled_scene");
 
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_DISABLED);
@@ -2629,3 +2946,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state.instantiate();
 }
+
+PackedScene::~PackedScene() {
+	clear_pool();
+}
@@ -31,6 +31,8 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/object/class_db.h"
+#include "core/templates/pair.h"
 #include "scene/main/node.h"
 
 class PackedScene;
@@ -92,6 +94,24 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// What instantiate() can resolve once and reuse at runtime: native constructors and property setters.
+	// Entries left empty go through the generic path.
+	struct InstantiationPlan {
+		struct NodeInfo {
+			Object *(*creation_func)(bool) = nullptr;
+			LocalVector<PropertyAccessor> properties;
+		};
+
+		LocalVector<NodeInfo> nodes;
+	};
+
+	mutable InstantiationPlan instantiation_plan;
+	mutable SafeFlag instantiation_plan_ready;
+	mutable BinaryMutex instantiation_plan_mutex;
+
+	const InstantiationPlan &_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map, HashSet<int32_t> &ids_saved);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -162,6 +182,8 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
 
+	uint64_t get_estimated_memory_usage() const;
+
 	Array setup_resources_in_array(Array &array_to_scan, const SceneState::NodeData &n, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *node, const StringName sname, int i, Node **ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Dictionary setup_resources_in_dictionary(Dictionary &p_dictionary_to_scan, const SceneState::NodeData &p_n, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *p_node, const StringName p_sname, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Variant make_local_resource(Variant &value, const SceneState::NodeData &p_node_data, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *p_node, const StringName p_sname, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
@@ -249,6 +271,26 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	// What a fresh instance looks like, in pre-order, so released instances can be checked and reset.
+	struct PoolNodeDefaults {
+		StringName type;
+		Variant script;
+		int child_count = 0;
+		LocalVector<Pair<StringName, Variant>> properties;
+	};
+
+	LocalVector<PoolNodeDefaults> pool_defaults;
+	LocalVector<ObjectID> pool; // User code may free pooled instances, so they are looked up on the way out.
+	int pool_size = 64;
+	mutable Mutex pool_mutex;
+
+	static SafeNumeric<uint64_t> pool_hits;
+	static SafeNumeric<uint64_t> pool_misses;
+
+	void _capture_pool_defaults(const Node *p_node);
+	bool _matches_pool_defaults(const Node *p_node, uint32_t &r_index) const;
+	static void _restore_pool_defaults(Node *p_node, const LocalVector<PoolNodeDefaults> &p_defaults, uint32_t &r_index);
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -275,6 +317,17 @@ public:
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
+	Node *acquire_instance();
+	void release_instance(Node *p_instance);
+	void clear_pool();
+	int get_pooled_instance_count() const;
+
+	void set_pool_size(int p_size);
+	int get_pool_size() const;
+
+	static uint64_t get_pool_hit_count() { return pool_hits.get(); }
+	static uint64_t get_pool_miss_count() { return pool_misses.get(); }
+
 	virtual void reload_from_file() override;
 
 	virtual void set_path(const String &p_path, bool p_take_over = false) override;
@@ -288,9 +341,11 @@ public:
 
 	static HashSet<StringName> get_scene_groups(const String &p_path);
 #endif
+	virtual uint64_t get_estimated_memory_usage() const override;
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
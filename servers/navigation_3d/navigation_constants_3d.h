@@ -34,6 +34,7 @@ namespace NavigationEnums3D {
 
 enum PathfindingAlgorithm {
 	PATHFINDING_ALGORITHM_ASTAR = 0,
+	PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR,
 };
 
 enum PathPostProcessing {
@@ -74,6 +75,11 @@ constexpr float EDGE_CONNECTION_MARGIN = 0.25f;
 constexpr float LINK_CONNECTION_RADIUS = 1.0f;
 constexpr int path_search_max_polygons = 4096;
 
+// Hierarchical pathfinding.
+
+// Upper bound of connected polygons grouped in a single cluster of the abstract graph.
+constexpr int NAV_MESH_CLUSTER_POLYGON_COUNT = 64;
+
 // Agent.
 
 constexpr float AVOIDANCE_AGENT_HEIGHT = 1.0;
@@ -34,6 +34,7 @@ TEST_FORCE_LINK(test_file_access)
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "tests/test_utils.h"
 
 namespace TestFileAccess {
@@ -297,4 +298,151 @@ TEST_CASE("[FileAccess] Cursor positioning") {
 	}
 }
 
+TEST_CASE("[FileAccess] Memory mapping") {
+	const String path = TestUtils::get_temp_path("file_access_mapping.bin");
+	const Vector<uint8_t> contents = String("Mapped file contents.").to_utf8_buffer();
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(contents);
+
+		ERR_PRINT_OFF;
+		CHECK_MESSAGE(f->map_read_only() != OK, "Files open for writing can't be mapped.");
+		ERR_PRINT_ON;
+		CHECK(f->get_mapped_data().is_empty());
+	}
+
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_mapped_data().is_empty());
+	if (f->map_read_only() != OK) {
+		return; // Not supported on this platform.
+	}
+
+	Span<uint8_t> mapped = f->get_mapped_data();
+	REQUIRE(mapped.size() == (uint64_t)contents.size());
+	CHECK(memcmp(mapped.ptr(), contents.ptr(), contents.size()) == 0);
+
+	// Regular reads keep working alongside the mapping.
+	CHECK(f->get_buffer(contents.size()) == contents);
+
+	f->close();
+	CHECK(f->get_mapped_data().is_empty());
+}
+
+TEST_CASE("[FileAccess] Compressed files with readahead") {
+	const String path = TestUtils::get_temp_path("file_access_compressed_readahead.bin");
+
+	// Spans several blocks, with a partial last one.
+	Vector<uint8_t> contents;
+	contents.resize(1024 * 9 + 100);
+	for (int i = 0; i < contents.size(); i++) {
+		contents.write[i] = (i * 7 + i / 300) % 251;
+	}
+
+	const int previous_readahead_blocks = FileAccessCompressed::readahead_blocks;
+	FileAccessCompressed::readahead_blocks = 3;
+
+	const Compression::Mode modes[] = { Compression::MODE_FASTLZ, Compression::MODE_DEFLATE, Compression::MODE_ZSTD, Compression::MODE_GZIP };
+	for (Compression::Mode mode : modes) {
+		{
+			Ref<FileAccessCompressed> fac;
+			fac.instantiate();
+			fac->configure("GCPF", mode, 1024);
+			REQUIRE(fac->open_internal(path, FileAccess::WRITE) == OK);
+			Ref<FileAccess> f = fac;
+			f->store_buffer(contents);
+		}
+
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		fac->configure("GCPF", mode);
+		REQUIRE(fac->open_internal(path, FileAccess::READ) == OK);
+		Ref<FileAccess> f = fac;
+
+		// Sequential reads, crossing blocks in uneven steps.
+		Vector<uint8_t> read_back;
+		while (!f->eof_reached()) {
+			read_back.append_array(f->get_buffer(700));
+		}
+		CHECK_MESSAGE(read_back == contents, vformat("Sequential reads should match the written data (mode %d).", mode));
+
+		// Random access, going back and forth over blocks that were read ahead.
+		const uint64_t positions[] = { 5000, 100, 9000, 2047, 2048, 9216 };
+		for (uint64_t position : positions) {
+			f->seek(position);
+			CHECK(f->get_position() == position);
+			CHECK_MESSAGE(f->get_8() == contents[position], vformat("Byte at %d should match the written data (mode %d).", position, mode));
+		}
+	}
+
+	FileAccessCompressed::readahead_blocks = previous_readahead_blocks;
+	DirAccess::remove_file_or_error(path);
+}
+
+TEST_CASE("[FileAccess] Compressed files with a Zstandard dictionary") {
+	// Small, similar files, like text resources.
+	Vector<Vector<uint8_t>> samples;
+	for (int i = 0; i < 32; i++) {
+		samples.push_back(vformat("[gd_resource type=\"StandardMaterial3D\" format=3 uid=\"uid://sample%d\"]\n\n[resource]\nalbedo_color = Color(%d, 0.5, 0.25, 1)\nroughness = 0.%d\nmetallic_specular = 0.5\n", i, i % 2, i).to_utf8_buffer());
+	}
+	const Vector<uint8_t> dictionary = Compression::build_zstd_dictionary(samples, 4096);
+	REQUIRE(!dictionary.is_empty());
+	CHECK(dictionary.size() <= 4096);
+	const uint32_t dictionary_id = Compression::add_zstd_dictionary(dictionary);
+	REQUIRE(dictionary_id != 0);
+	CHECK(Compression::has_zstd_dictionary(dictionary_id));
+	CHECK_MESSAGE(Compression::add_zstd_dictionary(dictionary) == dictionary_id, "Adding the same dictionary again should give the same ID.");
+
+	const Vector<uint8_t> contents = String("[gd_resource type=\"StandardMaterial3D\" format=3 uid=\"uid://other\"]\n\n[resource]\nalbedo_color = Color(1, 0.5, 0.25, 1)\nroughness = 0.75\nmetallic_specular = 0.5\n").to_utf8_buffer();
+
+	Vector<uint8_t> compressed;
+	compressed.resize(Compression::get_max_compressed_buffer_size(contents.size(), Compression::MODE_ZSTD));
+	const int64_t plain_size = Compression::compress(compressed.ptrw(), contents.ptr(), contents.size(), Compression::MODE_ZSTD);
+	const int64_t dictionary_size = Compression::compress(compressed.ptrw(), contents.ptr(), contents.size(), Compression::MODE_ZSTD, dictionary_id);
+	REQUIRE(plain_size > 0);
+	REQUIRE(dictionary_size > 0);
+	CHECK_MESSAGE(dictionary_size < plain_size, "Small buffers similar to the dictionary should compress better with it.");
+
+	Vector<uint8_t> decompressed;
+	decompressed.resize(contents.size());
+	CHECK(Compression::decompress(decompressed.ptrw(), decompressed.size(), compressed.ptr(), dictionary_size, Compression::MODE_ZSTD, dictionary_id) == contents.size());
+	CHECK(decompressed == contents);
+
+	const String path = TestUtils::get_temp_path("file_access_compressed_dictionary.bin");
+	{
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		fac->configure("GCPF", Compression::MODE_ZSTD, 64, dictionary_id);
+		REQUIRE(fac->open_internal(path, FileAccess::WRITE) == OK);
+		Ref<FileAccess> f = fac;
+		f->store_buffer(contents);
+	}
+
+	Ref<FileAccessCompressed> fac;
+	fac.instantiate();
+	fac->configure("GCPF");
+	REQUIRE(fac->open_internal(path, FileAccess::READ) == OK);
+	Ref<FileAccess> f = fac;
+	CHECK(f->get_buffer(contents.size()) == contents);
+	f->seek(100);
+	CHECK(f->get_8() == contents[100]);
+	f->close();
+
+	DirAccess::remove_file_or_error(path);
+
+	// A dictionary that would start with the trained dictionary magic number gets a leading byte, within budget.
+	Vector<uint8_t> magic_sample;
+	magic_sample.resize(64);
+	magic_sample.fill(1);
+	magic_sample.write[0] = 0x37;
+	magic_sample.write[1] = 0xA4;
+	magic_sample.write[2] = 0x30;
+	magic_sample.write[3] = 0xEC;
+	const Vector<uint8_t> magic_dictionary = Compression::build_zstd_dictionary({ magic_sample }, 16);
+	REQUIRE(magic_dictionary.size() == 16);
+	CHECK(magic_dictionary[0] == 0);
+	CHECK(magic_dictionary[1] == 0x37);
+}
+
 } // namespace TestFileAccess
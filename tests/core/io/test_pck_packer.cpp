@@ -33,6 +33,8 @@
 TEST_FORCE_LINK(test_pck_packer)
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_pack.h"
+#include "core/io/marshalls.h"
 #include "core/io/pck_packer.h"
 #include "core/os/os.h"
 #include "tests/test_utils.h"
@@ -120,4 +122,90 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			"The generated non-empty PCK file shouldn't be too large.");
 }
 
+TEST_CASE("[PCKPacker] Mount a PCK file through its path index") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_indexed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file_from_buffer("indexed/first.txt", String("First").to_utf8_buffer()) == OK);
+	REQUIRE(pck_packer.add_file_from_buffer("indexed/sub/second.txt", String("Second").to_utf8_buffer()) == OK);
+	REQUIRE(pck_packer.add_file_from_buffer("indexed/sub/ünïcödé.txt", String("Third").to_utf8_buffer()) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(PACK_HEADER_FLAGS_POS);
+	CHECK_MESSAGE(
+			(f->get_32() & PACK_PATH_INDEX),
+			"A PCK without an encrypted directory or removals should have a path index.");
+	f.unref();
+
+	PackedData *packed_data = PackedData::get_singleton();
+	REQUIRE(packed_data->add_pack(output_pck_path, false, 0) == OK);
+
+	CHECK(packed_data->has_path("res://indexed/first.txt"));
+	CHECK(packed_data->has_path("res://indexed//sub/./second.txt"));
+	CHECK(packed_data->has_path("res://indexed/sub/ünïcödé.txt"));
+	CHECK_FALSE(packed_data->has_path("res://indexed/missing.txt"));
+	CHECK_FALSE(packed_data->has_path("res://indexed/sub/unicode.txt"));
+	CHECK(packed_data->get_size("res://indexed/sub/second.txt") == 6);
+
+	Ref<FileAccess> second = packed_data->try_open_path("res://indexed/sub/second.txt");
+	REQUIRE(second.is_valid());
+	CHECK(second->get_as_utf8_string() == "Second");
+	second.unref();
+
+	Ref<DirAccess> sub_dir = packed_data->try_open_directory("res://indexed/sub");
+	REQUIRE(sub_dir.is_valid());
+	CHECK(sub_dir->file_exists("second.txt"));
+	CHECK(sub_dir->file_exists("ünïcödé.txt"));
+	sub_dir.unref();
+
+	packed_data->clear();
+}
+
+TEST_CASE("[PCKPacker] Pack a PCK file with removals without a path index") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_removal.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file_from_buffer("kept.txt", String("Kept").to_utf8_buffer()) == OK);
+	REQUIRE(pck_packer.add_file_removal("removed.txt") == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(PACK_HEADER_FLAGS_POS);
+	CHECK_MESSAGE(
+			!(f->get_32() & PACK_PATH_INDEX),
+			"Removals need the directory to be read, so there should be no path index.");
+}
+
+TEST_CASE("[PCKPacker] Build a path index") {
+	Vector<String> paths;
+	for (int i = 0; i < 1000; i++) {
+		paths.push_back(vformat("dir_%d/file_%d.res", i % 7, i));
+	}
+
+	Vector<uint8_t> index;
+	REQUIRE(PackedData::build_path_index(paths, index));
+
+	const uint8_t *r = index.ptr();
+	const uint32_t count = decode_uint32(r);
+	const uint32_t bucket_count = decode_uint32(r + 4);
+	REQUIRE(count == 1000);
+	REQUIRE(index.size() == 8 + bucket_count * 4 + count * 16);
+
+	// Every path must be found in the one slot it can be stored in.
+	for (const String &path : paths) {
+		uint64_t hash = PackedData::hash_index_path(path);
+		uint32_t displacement = decode_uint32(r + 8 + (hash % bucket_count) * 4);
+		uint64_t slot = hash64_murmur3_64(hash, displacement) % count;
+		CHECK(decode_uint64(r + 8 + bucket_count * 4 + slot * 16) == hash);
+	}
+
+	paths.push_back("dir_0/file_0.res");
+	CHECK_MESSAGE(
+			!PackedData::build_path_index(paths, index),
+			"Duplicate paths can't be indexed.");
+}
+
 } // namespace TestPCKPacker
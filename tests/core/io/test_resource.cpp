@@ -33,6 +33,7 @@
 TEST_FORCE_LINK(test_resource)
 
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/class_db.h"
@@ -628,4 +629,83 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	resource_c->remove_meta("next");
 }
 
+TEST_CASE("[Resource] Retaining released resources in the cache") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Retained");
+	const String save_path = TestUtils::get_temp_path("resource_retained.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+	resource.unref();
+
+	const uint64_t budget = ResourceCache::get_retention_budget();
+	ResourceCache::set_retention_budget(1024 * 1024);
+	const uint64_t hits = ResourceCache::get_hit_count();
+	const uint64_t misses = ResourceCache::get_miss_count();
+	const uint64_t evictions = ResourceCache::get_eviction_count();
+
+	ObjectID loaded_id = ResourceLoader::load(save_path)->get_instance_id();
+	CHECK(ResourceCache::get_miss_count() == misses + 1);
+	CHECK_MESSAGE(
+			ResourceCache::has(save_path),
+			"The resource should stay cached after being released, as it fits in the budget.");
+	CHECK(ResourceCache::get_retained_size() > 0);
+
+	Ref<Resource> loaded_resource = ResourceLoader::load(save_path);
+	CHECK(ResourceCache::get_hit_count() == hits + 1);
+	CHECK_MESSAGE(
+			loaded_resource->get_instance_id() == loaded_id,
+			"Loading the resource again should return the retained instance.");
+	loaded_resource.unref();
+
+	ResourceCache::set_retention_budget(1);
+	CHECK(ResourceCache::get_eviction_count() == evictions + 1);
+	CHECK(ResourceCache::get_retained_size() == 0);
+	CHECK_MESSAGE(
+			!ResourceCache::has(save_path),
+			"The resource should be freed once it no longer fits in the budget.");
+
+	ResourceCache::set_retention_budget(budget);
+}
+
+TEST_CASE("[Resource] Loading binary sub-resources with sub-threads") {
+	Ref<Resource> shared_resource = memnew(Resource);
+	shared_resource->set_name("Shared");
+	shared_resource->set_meta("values", PackedInt32Array({ 1, 2, 3 }));
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Main");
+	Array children;
+	for (int i = 0; i < 8; i++) {
+		Ref<Resource> child_resource = memnew(Resource);
+		child_resource->set_name(vformat("Child %d", i));
+		child_resource->set_meta("shared", shared_resource);
+		child_resource->set_meta("transform", Transform3D(Basis(), Vector3(i, i * 2, i * 3)));
+		children.push_back(child_resource);
+	}
+	resource->set_meta("children", children);
+	const String save_path = TestUtils::get_temp_path("resource_sub_threads.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	Error err = ERR_BUG;
+	const Ref<Resource> loaded_resource = loader->load(save_path, save_path, &err, true, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+	REQUIRE(loaded_resource.is_valid());
+	CHECK(loaded_resource->get_name() == "Main");
+
+	const Array loaded_children = loaded_resource->get_meta("children");
+	REQUIRE(loaded_children.size() == 8);
+	const Ref<Resource> loaded_shared_resource = Ref<Resource>(loaded_children[0])->get_meta("shared");
+	REQUIRE(loaded_shared_resource.is_valid());
+	CHECK(loaded_shared_resource->get_meta("values") == Variant(PackedInt32Array({ 1, 2, 3 })));
+	for (int i = 0; i < 8; i++) {
+		const Ref<Resource> loaded_child_resource = loaded_children[i];
+		REQUIRE(loaded_child_resource.is_valid());
+		CHECK(loaded_child_resource->get_name() == vformat("Child %d", i));
+		CHECK(loaded_child_resource->get_meta("transform") == Variant(Transform3D(Basis(), Vector3(i, i * 2, i * 3))));
+		CHECK_MESSAGE(
+				loaded_child_resource->get_meta("shared") == Variant(loaded_shared_resource),
+				"Sub-resources parsed on different threads should share the same instance.");
+	}
+}
+
 } // namespace TestResource
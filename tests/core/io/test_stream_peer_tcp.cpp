@@ -62,6 +62,7 @@ public:
 
 	virtual Error set_broadcasting_enabled(bool p_enabled) override;
 	virtual void set_blocking_enabled(bool p_enabled) override;
+	virtual bool is_blocking_enabled() const override;
 	virtual void set_ipv6_only_enabled(bool p_enabled) override;
 	virtual void set_tcp_no_delay_enabled(bool p_enabled) override;
 	virtual void set_reuse_address_enabled(bool p_enabled) override;
@@ -193,6 +194,10 @@ void MockNetSocket::set_blocking_enabled(bool p_enabled) {
 	blocking_enabled = p_enabled;
 }
 
+bool MockNetSocket::is_blocking_enabled() const {
+	return blocking_enabled;
+}
+
 void MockNetSocket::set_ipv6_only_enabled(bool p_enabled) {}
 
 void MockNetSocket::set_tcp_no_delay_enabled(bool p_enabled) {}
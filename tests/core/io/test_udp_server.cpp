@@ -32,6 +32,7 @@
 
 TEST_FORCE_LINK(test_udp_server)
 
+#include "core/io/net_socket.h"
 #include "core/io/packet_peer_udp.h"
 #include "core/io/udp_server.h"
 #include "core/os/os.h"
@@ -197,6 +198,115 @@ TEST_CASE("[UDPServer] Handle multiple clients at the same time") {
 	server->stop();
 }
 
+TEST_CASE("[UDPServer] Receive more packets than fit in a single batch") {
+	Ref<UDPServer> server = create_server(LOCALHOST, PORT);
+	Ref<PacketPeerUDP> client = create_client(LOCALHOST, PORT);
+
+	// Enough packets to span several receive batches on both ends.
+	const int packet_count = 50;
+	for (int i = 0; i < packet_count; i++) {
+		CHECK_EQ(client->put_var(i), Error::OK);
+	}
+
+	Ref<PacketPeerUDP> client_from_server = accept_connection(server);
+	wait_for_condition([&]() {
+		return server->poll() != Error::OK || client_from_server->get_available_packet_count() == packet_count;
+	});
+	REQUIRE_EQ(client_from_server->get_available_packet_count(), packet_count);
+	for (int i = 0; i < packet_count; i++) {
+		Variant received;
+		CHECK_EQ(client_from_server->get_var(received), Error::OK);
+		CHECK_EQ(int(received), i);
+	}
+
+	// And back, through the connected client socket.
+	for (int i = 0; i < packet_count; i++) {
+		CHECK_EQ(client_from_server->put_var(i), Error::OK);
+	}
+	wait_for_condition([&]() {
+		return client->get_available_packet_count() == packet_count;
+	});
+	REQUIRE_EQ(client->get_available_packet_count(), packet_count);
+	for (int i = 0; i < packet_count; i++) {
+		Variant received;
+		CHECK_EQ(client->get_var(received), Error::OK);
+		CHECK_EQ(int(received), i);
+	}
+
+	client->close();
+	server->stop();
+}
+
+TEST_CASE("[UDPServer] Batched datagrams keep their payload, address and port") {
+	IP::Type ip_type = IP::TYPE_ANY;
+	Ref<NetSocket> receiver = NetSocket::create();
+	REQUIRE_EQ(receiver->open(NetSocket::Family::INET, NetSocket::TYPE_UDP, ip_type), Error::OK);
+	receiver->set_blocking_enabled(false);
+	CHECK_FALSE(receiver->is_blocking_enabled());
+	REQUIRE_EQ(receiver->bind(NetSocket::Address(LOCALHOST, PORT)), Error::OK);
+
+	ip_type = IP::TYPE_ANY;
+	Ref<NetSocket> sender = NetSocket::create();
+	REQUIRE_EQ(sender->open(NetSocket::Family::INET, NetSocket::TYPE_UDP, ip_type), Error::OK);
+	REQUIRE_EQ(sender->bind(NetSocket::Address(LOCALHOST, PORT + 1)), Error::OK);
+
+	const int packet_count = 20;
+	uint8_t payloads[packet_count][4];
+	NetSocket::Datagram out[packet_count];
+	for (int i = 0; i < packet_count; i++) {
+		for (int j = 0; j < 4; j++) {
+			payloads[i][j] = i * 4 + j;
+		}
+		out[i].buffer = payloads[i];
+		out[i].size = 1 + i % 4; // Vary the length, too.
+		out[i].ip = LOCALHOST;
+		out[i].port = PORT;
+	}
+	int sent = 0;
+	REQUIRE_EQ(sender->sendto_batch(out, packet_count, sent), Error::OK);
+	REQUIRE_EQ(sent, packet_count);
+
+	uint8_t buffers[packet_count][16];
+	NetSocket::Datagram in[packet_count];
+	for (int i = 0; i < packet_count; i++) {
+		in[i].buffer = buffers[i];
+		in[i].size = 16;
+	}
+	int received = 0;
+	wait_for_condition([&]() {
+		int count = 0;
+		if (receiver->recvfrom_batch(in + received, packet_count - received, count) == Error::OK) {
+			received += count;
+		}
+		return received == packet_count;
+	});
+	REQUIRE_EQ(received, packet_count);
+	for (int i = 0; i < packet_count; i++) {
+		CHECK_EQ(in[i].ip, LOCALHOST);
+		CHECK_EQ(in[i].port, PORT + 1);
+		REQUIRE_EQ(in[i].read, 1 + i % 4);
+		for (int j = 0; j < in[i].read; j++) {
+			CHECK_EQ(in[i].buffer[j], payloads[i][j]);
+		}
+	}
+
+	// Drained: a non-blocking socket reports busy, a blocking one returns what is queued without waiting for more.
+	int count = 0;
+	CHECK_EQ(receiver->recvfrom_batch(in, packet_count, count), Error::ERR_BUSY);
+	REQUIRE_EQ(sender->sendto_batch(out, 2, sent), Error::OK);
+	wait_for_condition([&]() {
+		return receiver->poll(NetSocket::POLL_TYPE_IN, 0) == Error::OK;
+	});
+	OS::get_singleton()->delay_usec(SLEEP_DURATION); // Let the second datagram land, too.
+	receiver->set_blocking_enabled(true);
+	CHECK(receiver->is_blocking_enabled());
+	CHECK_EQ(receiver->recvfrom_batch(in, packet_count, count), Error::OK);
+	CHECK_EQ(count, 2);
+
+	sender->close();
+	receiver->close();
+}
+
 TEST_CASE("[UDPServer] Should not accept new connections after stop") {
 	Ref<UDPServer> server = create_server(LOCALHOST, PORT);
 	Ref<PacketPeerUDP> client = create_client(LOCALHOST, PORT);
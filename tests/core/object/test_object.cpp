@@ -36,6 +36,7 @@ TEST_FORCE_LINK(test_object)
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "tests/signal_watcher.h"
 
 namespace TestObject {
@@ -203,6 +204,44 @@ TEST_CASE("[Object] Construction") {
 			"The database pointer returned by the object id should reference same object.");
 }
 
+static SafeNumeric<uint32_t> objectdb_errors;
+
+static void objectdb_stress_test(void *p_userdata, uint32_t p_index) {
+	const int object_count = 1000;
+	Object *objects[object_count];
+	ObjectID ids[object_count];
+
+	for (int round = 0; round < 10; round++) {
+		for (int i = 0; i < object_count; i++) {
+			objects[i] = memnew(Object);
+			ids[i] = objects[i]->get_instance_id();
+		}
+		for (int i = 0; i < object_count; i++) {
+			if (ObjectDB::get_instance(ids[i]) != objects[i]) {
+				objectdb_errors.increment();
+			}
+		}
+		for (int i = 0; i < object_count; i++) {
+			memdelete(objects[i]);
+			if (ObjectDB::get_instance(ids[i]) != nullptr) {
+				objectdb_errors.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[Object] ObjectDB creation and lookup from several threads") {
+	const int object_count = ObjectDB::get_object_count();
+	objectdb_errors.set(0);
+
+	// Slots freed by one thread are reused by others, stale IDs must never find the new objects.
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(objectdb_stress_test, nullptr, 32, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK(objectdb_errors.get() == 0);
+	CHECK(ObjectDB::get_object_count() == object_count);
+}
+
 TEST_CASE("[Object] Script instance property setter") {
 	Object *object = memnew(Object);
 	_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
@@ -261,6 +300,62 @@ TEST_CASE("[Object] Built-in property getter") {
 			"The returned value should equal the one which was set with built-in setter.");
 }
 
+TEST_CASE("[Object] Built-in property accessor") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	_TestDerivedObject derived_object;
+
+	const PropertyAccessor accessor = ClassDB::get_property_accessor(derived_object.get_class_name(), "property");
+	CHECK(accessor.has_setter());
+	CHECK(accessor.has_getter());
+	CHECK(accessor.is_compatible(&derived_object));
+
+	bool valid = false;
+	accessor.set(&derived_object, 100, &valid);
+	CHECK(valid);
+	CHECK(derived_object.get_property() == 100);
+
+	// Values of another type are converted like with Object::set().
+	accessor.set(&derived_object, 42.0, &valid);
+	CHECK(valid);
+	CHECK(derived_object.get_property() == 42);
+
+	const Variant &actual_value = accessor.get(&derived_object, &valid);
+	CHECK(valid);
+	CHECK(actual_value == Variant(42));
+
+	// Values that can't be converted are reported, like with ClassDB::set_property().
+	bool class_db_valid = true;
+	accessor.set(&derived_object, Array(), &valid);
+	ClassDB::set_property(&derived_object, "property", Array(), &class_db_valid);
+	CHECK_FALSE(valid);
+	CHECK_FALSE(class_db_valid);
+	derived_object.set_property(42);
+
+	SUBCASE("Objects with a script instance go through Object::set()") {
+		_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
+		derived_object.set_script_instance(script_instance);
+		CHECK_FALSE(accessor.is_compatible(&derived_object));
+
+		accessor.set(&derived_object, 7, &valid);
+		CHECK(valid);
+		CHECK(derived_object.get_property() == 42);
+
+		Variant script_value;
+		CHECK(script_instance->get("property", script_value));
+		CHECK(script_value == Variant(7));
+	}
+
+	SUBCASE("Unknown properties can't be resolved") {
+		const PropertyAccessor absent = ClassDB::get_property_accessor(derived_object.get_class_name(), "absent_name");
+		CHECK_FALSE(absent.has_setter());
+		CHECK_FALSE(absent.has_getter());
+
+		valid = true;
+		absent.get(&derived_object, &valid);
+		CHECK_FALSE(valid);
+	}
+}
+
 TEST_CASE("[Object] Script property setter") {
 	Object object;
 	Variant script;
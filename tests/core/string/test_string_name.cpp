@@ -0,0 +1,137 @@
+/**************************************************************************/
+/*  test_string_name.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_string_name)
+
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName a = "test_string_name_interning";
+	const StringName b = String("test_string_name_interning");
+	CHECK(a == b);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(a == String("test_string_name_interning"));
+	CHECK(a.hash() == String("test_string_name_interning").hash());
+
+	const StringName c = "test_string_name_interning_other";
+	CHECK(a != c);
+
+	CHECK(StringName().is_empty());
+	CHECK(StringName("").is_empty());
+	CHECK(StringName(String()).is_empty());
+}
+
+TEST_CASE("[StringName] Re-interning after release") {
+	String name = "test_string_name_released";
+	{
+		StringName first = name;
+		CHECK(first == name);
+	}
+	// The entry was removed when the last reference went away; it must be recreated cleanly.
+	StringName second = name;
+	StringName third = name;
+	CHECK(second == name);
+	CHECK(second == third);
+}
+
+struct InterningTester {
+	static const int THREAD_COUNT = 4;
+	static const int NAME_COUNT = 512;
+	static const int ITERATIONS = 20;
+
+	LocalVector<String> names;
+	// The pointer each thread got for every name on its last iteration.
+	LocalVector<const void *> pointers[THREAD_COUNT];
+	StringName kept_alive[NAME_COUNT / 2];
+	SafeNumeric<uint32_t> mismatches;
+	SafeNumeric<int> next_thread_index;
+
+	static void thread_func(void *p_user) {
+		InterningTester *tester = (InterningTester *)p_user;
+		const int thread_index = tester->next_thread_index.postincrement();
+		LocalVector<const void *> &pointers = tester->pointers[thread_index];
+		pointers.resize(NAME_COUNT);
+
+		for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+			// Mix lookups of long-lived names with names that are created and freed concurrently.
+			LocalVector<StringName> held;
+			for (int i = 0; i < NAME_COUNT; i++) {
+				const int index = (i * 7 + thread_index * 13 + iteration) % NAME_COUNT;
+				StringName sname = tester->names[index];
+				if (sname != tester->names[index]) {
+					tester->mismatches.increment();
+				}
+				if (index < NAME_COUNT / 2) {
+					pointers[index] = sname.data_unique_pointer();
+				}
+				if (i % 3 == 0) {
+					held.push_back(sname);
+				}
+			}
+		}
+	}
+};
+
+TEST_CASE("[StringName] Interning from multiple threads") {
+	InterningTester tester;
+	for (int i = 0; i < InterningTester::NAME_COUNT; i++) {
+		tester.names.push_back(vformat("test_string_name_threaded_%d", i));
+	}
+	for (int i = 0; i < InterningTester::NAME_COUNT / 2; i++) {
+		tester.kept_alive[i] = tester.names[i];
+	}
+
+	Thread threads[InterningTester::THREAD_COUNT];
+	for (Thread &thread : threads) {
+		thread.start(&InterningTester::thread_func, &tester);
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK_MESSAGE(tester.mismatches.get() == 0, "Every interned name should compare equal to its source string.");
+
+	bool all_unique = true;
+	for (int t = 0; t < InterningTester::THREAD_COUNT; t++) {
+		for (int i = 0; i < InterningTester::NAME_COUNT / 2; i++) {
+			// Reduce number of check messages.
+			all_unique &= tester.pointers[t][i] == tester.kept_alive[i].data_unique_pointer();
+		}
+	}
+	CHECK_MESSAGE(all_unique, "Names alive during the whole test should resolve to a single entry in every thread.");
+}
+
+} // namespace TestStringName
@@ -0,0 +1,146 @@
+/**************************************************************************/
+/*  test_work_stealing_deque.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_work_stealing_deque)
+
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
+
+namespace TestWorkStealingDeque {
+
+TEST_CASE("[WorkStealingDeque] Owner push and pop is LIFO") {
+	WorkStealingDeque<uintptr_t, 8> deque;
+	CHECK(deque.is_empty());
+
+	for (uintptr_t i = 1; i <= 8; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK(deque.size() == 8);
+	CHECK_MESSAGE(!deque.push(9), "Pushing to a full deque should fail.");
+
+	uintptr_t value = 0;
+	for (uintptr_t i = 8; i >= 1; i--) {
+		CHECK(deque.pop(value));
+		CHECK(value == i);
+	}
+	CHECK_FALSE(deque.pop(value));
+	CHECK(deque.is_empty());
+}
+
+TEST_CASE("[WorkStealingDeque] Steal is FIFO") {
+	WorkStealingDeque<uintptr_t, 8> deque;
+	for (uintptr_t i = 1; i <= 4; i++) {
+		deque.push(i);
+	}
+
+	uintptr_t value = 0;
+	CHECK(deque.steal(value));
+	CHECK(value == 1);
+	CHECK(deque.pop(value));
+	CHECK(value == 4);
+	CHECK(deque.steal(value));
+	CHECK(value == 2);
+	CHECK(deque.pop(value));
+	CHECK(value == 3);
+	CHECK_FALSE(deque.steal(value));
+	CHECK_FALSE(deque.pop(value));
+
+	// Wrapping around the ring buffer.
+	for (uintptr_t i = 0; i < 20; i++) {
+		CHECK(deque.push(i + 100));
+		CHECK(deque.steal(value));
+		CHECK(value == i + 100);
+	}
+}
+
+struct ConcurrencyTester {
+	static const uint32_t ELEMENTS = 100000;
+	static const uint32_t THIEVES = 3;
+
+	WorkStealingDeque<uintptr_t, 64> deque;
+	LocalVector<SafeNumeric<uint32_t>> taken;
+	SafeFlag owner_done;
+
+	static void thief_func(void *p_user) {
+		ConcurrencyTester *tester = (ConcurrencyTester *)p_user;
+		uintptr_t value = 0;
+		while (true) {
+			if (tester->deque.steal(value)) {
+				tester->taken[value].increment();
+			} else if (tester->owner_done.is_set() && tester->deque.is_empty()) {
+				break;
+			}
+		}
+	}
+};
+
+TEST_CASE("[WorkStealingDeque] Every element is taken exactly once under contention") {
+	ConcurrencyTester tester;
+	tester.taken.resize(ConcurrencyTester::ELEMENTS);
+
+	Thread thieves[ConcurrencyTester::THIEVES];
+	for (Thread &thief : thieves) {
+		thief.start(&ConcurrencyTester::thief_func, &tester);
+	}
+
+	uintptr_t value = 0;
+	for (uint32_t i = 0; i < ConcurrencyTester::ELEMENTS; i++) {
+		while (!tester.deque.push(i)) {
+			// Full; help draining from the owner side.
+			if (tester.deque.pop(value)) {
+				tester.taken[value].increment();
+			}
+		}
+		if (i % 3 == 0 && tester.deque.pop(value)) {
+			tester.taken[value].increment();
+		}
+	}
+	while (tester.deque.pop(value)) {
+		tester.taken[value].increment();
+	}
+	tester.owner_done.set();
+
+	for (Thread &thief : thieves) {
+		thief.wait_to_finish();
+	}
+
+	bool all_taken_once = true;
+	for (uint32_t i = 0; i < ConcurrencyTester::ELEMENTS; i++) {
+		// Reduce number of check messages.
+		all_taken_once &= tester.taken[i].get() == 1;
+	}
+	CHECK(all_taken_once);
+}
+
+} // namespace TestWorkStealingDeque
@@ -108,6 +108,56 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static WorkerThreadPool *work_stealing_pool = nullptr;
+
+static void static_work_stealing_group_test(void *p_arg, uint32_t p_index) {
+	counter[p_index].increment();
+}
+
+static void static_work_stealing_spawner(void *p_arg) {
+	// Posting from a pool thread exercises the per-thread deques and stealing.
+	const uint32_t elements = (uint32_t)(uintptr_t)p_arg;
+	LocalVector<WorkerThreadPool::TaskID> subtasks;
+	for (uint32_t i = 0; i < elements; i++) {
+		subtasks.push_back(work_stealing_pool->add_native_task(static_test, (void *)(uintptr_t)i, i % 2));
+	}
+	WorkerThreadPool::GroupID group = work_stealing_pool->add_native_group_task(static_work_stealing_group_test, nullptr, elements, -1, true);
+	for (WorkerThreadPool::TaskID id : subtasks) {
+		work_stealing_pool->wait_for_task_completion(id);
+	}
+	work_stealing_pool->wait_for_group_task_completion(group);
+}
+
+TEST_CASE("[WorkerThreadPool] Work-stealing mode processes every task once") {
+	const int thread_counts[] = { 1, 2, 4, 8 };
+	for (int thread_count : thread_counts) {
+		WorkerThreadPool pool(false);
+		pool.init(thread_count, 0.3, true);
+		CHECK(pool.is_using_work_stealing());
+		work_stealing_pool = &pool;
+
+		for (int iterations = 0; iterations < 50; iterations++) {
+			const uint32_t count = 1 + Math::rand() % 300;
+			counter.clear();
+			counter.resize(count);
+
+			WorkerThreadPool::TaskID spawner = pool.add_native_task(static_work_stealing_spawner, (void *)(uintptr_t)count, true);
+			pool.wait_for_task_completion(spawner);
+
+			bool all_run_twice = true;
+			for (uint32_t i = 1; i < count; i++) {
+				// Once from the individual task and once from the group task.
+				// Reduce number of check messages.
+				all_run_twice &= counter[i].get() == 2;
+			}
+			CHECK(all_run_twice);
+		}
+
+		work_stealing_pool = nullptr;
+		pool.finish();
+	}
+}
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
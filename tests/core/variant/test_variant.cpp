@@ -32,8 +32,10 @@
 
 TEST_FORCE_LINK(test_variant)
 
+#include "core/os/thread.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
+#include "core/variant/variant_pools.h"
 
 namespace TestVariant {
 
@@ -2246,4 +2248,61 @@ TEST_CASE("[Variant] Operator NOT") {
 	}
 }
 
+static void variant_pools_thread_func(void *p_userdata) {
+	SafeNumeric<uint32_t> *mismatches = (SafeNumeric<uint32_t> *)p_userdata;
+	for (int iteration = 0; iteration < 200; iteration++) {
+		// Enough live values to overflow the per-thread caches both ways.
+		Vector<Variant> values;
+		for (int i = 0; i < 150; i++) {
+			switch (i % 3) {
+				case 0:
+					values.push_back(Transform2D(i, Vector2(i, iteration)));
+					break;
+				case 1:
+					values.push_back(Transform3D(Basis(), Vector3(i, iteration, 0)));
+					break;
+				case 2:
+					values.push_back(Projection(Vector4(i, 0, 0, 0), Vector4(), Vector4(), Vector4(0, 0, 0, iteration)));
+					break;
+			}
+		}
+		for (int i = 0; i < values.size(); i++) {
+			bool ok = false;
+			switch (i % 3) {
+				case 0:
+					ok = Transform2D(values[i]).get_origin() == Vector2(i, iteration);
+					break;
+				case 1:
+					ok = Transform3D(values[i]).origin == Vector3(i, iteration, 0);
+					break;
+				case 2:
+					ok = Projection(values[i]).columns[0].x == i && Projection(values[i]).columns[3].w == iteration;
+					break;
+			}
+			if (!ok) {
+				mismatches->increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[Variant] Boxed math types from multiple threads") {
+	const uint64_t transfers_before = VariantPools::get_transfer_count();
+
+	SafeNumeric<uint32_t> mismatches;
+	Thread threads[4];
+	for (Thread &thread : threads) {
+		thread.start(variant_pools_thread_func, &mismatches);
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK_MESSAGE(mismatches.get() == 0, "Boxed values should not be shared or corrupted across threads.");
+	CHECK_MESSAGE(VariantPools::get_transfer_count() > transfers_before, "Per-thread caches should have exchanged slots with the global pools.");
+
+	Variant transform = Transform3D();
+	CHECK_MESSAGE(VariantPools::get_memory_usage() >= VariantPools::BUCKET_MEDIUM, "Live boxed values should be accounted for.");
+}
+
 } // namespace TestVariant
@@ -32,8 +32,12 @@
 
 TEST_FORCE_LINK(test_packed_scene)
 
+#include "core/io/resource_loader.h"
+#include "core/io/resource_saver.h"
 #include "core/object/callable_mp.h"
+#include "scene/2d/node_2d.h"
 #include "scene/resources/packed_scene.h"
+#include "tests/test_utils.h"
 
 namespace TestPackedScene {
 
@@ -216,6 +220,119 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene Properties Repeatedly") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(10, 20));
+	child->set_z_index(3);
+	child->set_visible(false);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Store a value whose type differs from the setter argument, so it needs a conversion.
+	Ref<SceneState> state = packed_scene.get_state();
+	state->add_node_property(1, state->add_name("rotation"), state->add_value(2));
+
+	// The first instantiation prepares the scene for the following ones, which must produce the same result.
+	for (int i = 0; i < 3; i++) {
+		Node *instance = packed_scene.instantiate();
+		REQUIRE(instance != nullptr);
+		REQUIRE(instance->get_child_count() == 1);
+
+		Node2D *instance_child = Object::cast_to<Node2D>(instance->get_child(0));
+		REQUIRE(instance_child != nullptr);
+		CHECK(instance_child->get_name() == "Child");
+		CHECK(instance_child->get_owner() == instance);
+		CHECK(instance_child->get_position() == Vector2(10, 20));
+		CHECK(instance_child->get_z_index() == 3);
+		CHECK_FALSE(instance_child->is_visible());
+		CHECK(instance_child->get_rotation() == doctest::Approx(2.0));
+
+		memdelete(instance);
+	}
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][PackedScene] Recycle Instances Through the Pool") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(10, 20));
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+	memdelete(scene);
+
+	const uint64_t hits = PackedScene::get_pool_hit_count();
+	const uint64_t misses = PackedScene::get_pool_miss_count();
+
+	// The pool starts empty, so the first instance is a new one.
+	Node *instance = packed_scene.acquire_instance();
+	REQUIRE(instance != nullptr);
+	CHECK(PackedScene::get_pool_miss_count() == misses + 1);
+
+	Node2D *instance_child = Object::cast_to<Node2D>(instance->get_child(0));
+	REQUIRE(instance_child != nullptr);
+	instance_child->set_position(Vector2(50, 60));
+	instance_child->set_z_index(4);
+
+	SUBCASE("Released instances are reset and handed out again") {
+		packed_scene.release_instance(instance);
+		CHECK(packed_scene.get_pooled_instance_count() == 1);
+
+		Node *recycled = packed_scene.acquire_instance();
+		CHECK(recycled == instance);
+		CHECK(PackedScene::get_pool_hit_count() == hits + 1);
+		CHECK(packed_scene.get_pooled_instance_count() == 0);
+		CHECK(instance_child->get_position() == Vector2(10, 20));
+		CHECK(instance_child->get_z_index() == 0);
+
+		memdelete(recycled);
+	}
+
+	SUBCASE("Instances freed while pooled are skipped") {
+		packed_scene.release_instance(instance);
+		memdelete(instance);
+		CHECK(packed_scene.get_pooled_instance_count() == 0);
+
+		Node *fresh = packed_scene.acquire_instance();
+		REQUIRE(fresh != nullptr);
+		CHECK(PackedScene::get_pool_hit_count() == hits);
+		CHECK(PackedScene::get_pool_miss_count() == misses + 2);
+
+		memdelete(fresh);
+	}
+
+	SUBCASE("Instances that changed structure are not pooled") {
+		instance->add_child(memnew(Node));
+		packed_scene.release_instance(instance);
+		CHECK(packed_scene.get_pooled_instance_count() == 0);
+		CHECK(instance->is_queued_for_deletion());
+	}
+
+	SUBCASE("Instances above the pool size are not pooled") {
+		packed_scene.set_pool_size(0);
+		packed_scene.release_instance(instance);
+		CHECK(packed_scene.get_pooled_instance_count() == 0);
+		CHECK(instance->is_queued_for_deletion());
+	}
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
@@ -282,4 +399,42 @@ TEST_CASE("[PackedScene] Recreate State") {
 	memdelete(scene);
 }
 
+TEST_CASE("[PackedScene] Large Scenes Don't Fit in the Resource Cache Budget") {
+	// Create a scene holding a large buffer.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	PackedByteArray blob;
+	blob.resize(1024 * 1024);
+	blob.fill(1);
+	scene->set_meta("blob", blob);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	REQUIRE(packed_scene->pack(scene) == OK);
+	memdelete(scene);
+	CHECK_MESSAGE(
+			packed_scene->get_estimated_memory_usage() > uint64_t(blob.size()),
+			"The estimated memory usage should account for the packed variants.");
+
+	const String save_path = TestUtils::get_temp_path("large_scene.scn");
+	REQUIRE(ResourceSaver::save(packed_scene, save_path) == OK);
+	packed_scene.unref();
+
+	const uint64_t budget = ResourceCache::get_retention_budget();
+	ResourceCache::set_retention_budget(512 * 1024);
+	const uint64_t evictions = ResourceCache::get_eviction_count();
+
+	Ref<PackedScene> loaded_scene = ResourceLoader::load(save_path);
+	REQUIRE(loaded_scene.is_valid());
+	CHECK(ResourceCache::get_eviction_count() > evictions);
+	CHECK(ResourceCache::get_retained_size() <= 512 * 1024);
+
+	loaded_scene.unref();
+	CHECK_MESSAGE(
+			!ResourceCache::has(save_path),
+			"The scene should be freed once released, as it's larger than the budget.");
+
+	ResourceCache::set_retention_budget(budget);
+}
+
 } // namespace TestPackedScene
@@ -740,6 +740,33 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_NE(query_result->get_path_owner_ids().size(), 0);
 		}
 
+		SUBCASE("Batched queries should yield the same results as individual queries") {
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			LocalVector<Vector<Vector3>> single_paths;
+			for (int i = 0; i < 16; i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+				query_parameters->set_map(map);
+				query_parameters->set_start_position(Vector3(i * 0.5, 0, 0));
+				query_parameters->set_target_position(Vector3(10, 0, 10 - i * 0.5));
+				batch_parameters.push_back(query_parameters);
+				batch_results.push_back(memnew(NavigationPathQueryResult3D));
+
+				Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+				navigation_server->query_path(query_parameters, query_result);
+				single_paths.push_back(query_result->get_path());
+			}
+
+			CallableMock mock;
+			navigation_server->query_paths(batch_parameters, batch_results, callable_mp(&mock, &CallableMock::function1).bind(Variant()));
+			CHECK_EQ(mock.function1_calls, 1);
+
+			for (int i = 0; i < 16; i++) {
+				Ref<NavigationPathQueryResult3D> query_result = batch_results[i];
+				CHECK_EQ(query_result->get_path(), single_paths[i]);
+			}
+		}
+
 		SUBCASE("Elaborate query with non-matching navigation layer mask should yield empty result") {
 			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
 			query_parameters->set_map(map);
@@ -813,6 +840,87 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] 'HIERARCHICAL_ASTAR' pathfinding should match 'ASTAR' across clusters") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// A 30x30 grid of 1x1 quads, with a wall across x = 15 that leaves a gap at the far end.
+		// Going around the wall takes over 80 polygons, so start and target can't share a cluster.
+		const int grid_size = 30;
+		const int gap_start = 27;
+		Vector<Vector3> vertices;
+		for (int z = 0; z <= grid_size; z++) {
+			for (int x = 0; x <= grid_size; x++) {
+				vertices.push_back(Vector3(x, 0, z));
+			}
+		}
+		Ref<NavigationMesh> navigation_mesh;
+		navigation_mesh.instantiate();
+		navigation_mesh->set_vertices(vertices);
+		for (int z = 0; z < grid_size; z++) {
+			for (int x = 0; x < grid_size; x++) {
+				if (x == grid_size / 2 && z < gap_start) {
+					continue;
+				}
+				const int corner = z * (grid_size + 1) + x;
+				navigation_mesh->add_polygon({ corner, corner + 1, corner + grid_size + 2, corner + grid_size + 1 });
+			}
+		}
+		CHECK_GT(navigation_mesh->get_polygon_count(), NavigationDefaults3D::NAV_MESH_CLUSTER_POLYGON_COUNT);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		query_parameters.instantiate();
+		query_parameters->set_map(map);
+		query_parameters->set_start_position(Vector3(0.5, 0, 0.5));
+		query_parameters->set_target_position(Vector3(grid_size - 0.5, 0, 0.5));
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+
+		navigation_server->query_path(query_parameters, query_result);
+		const Vector<Vector3> astar_path = query_result->get_path();
+		REQUIRE_GT(astar_path.size(), 2);
+
+		query_parameters->set_pathfinding_algorithm(NavigationPathQueryParameters3D::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR);
+		navigation_server->query_path(query_parameters, query_result);
+		const Vector<Vector3> hierarchical_path = query_result->get_path();
+		REQUIRE_GT(hierarchical_path.size(), 2);
+		CHECK_EQ(query_result->get_path_types().size(), hierarchical_path.size());
+
+		CHECK_EQ(hierarchical_path[0], astar_path[0]);
+		CHECK_EQ(hierarchical_path[hierarchical_path.size() - 1], astar_path[astar_path.size() - 1]);
+
+		real_t astar_length = 0.0;
+		real_t astar_max_z = 0.0;
+		for (int i = 1; i < astar_path.size(); i++) {
+			astar_length += astar_path[i - 1].distance_to(astar_path[i]);
+			astar_max_z = MAX(astar_max_z, astar_path[i].z);
+		}
+		real_t hierarchical_length = 0.0;
+		real_t hierarchical_max_z = 0.0;
+		for (int i = 1; i < hierarchical_path.size(); i++) {
+			hierarchical_length += hierarchical_path[i - 1].distance_to(hierarchical_path[i]);
+			hierarchical_max_z = MAX(hierarchical_max_z, hierarchical_path[i].z);
+		}
+
+		// Both paths have to detour through the gap in the wall.
+		CHECK_GE(astar_max_z, gap_start);
+		CHECK_GE(hierarchical_max_z, gap_start);
+		CHECK_GT(astar_length, 2.0 * gap_start);
+		CHECK_LE(hierarchical_length, astar_length * 1.1);
+
+		navigation_server->free_rid(region);
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {
@@ -68,9 +68,16 @@ class ENetUDP : public ENetGodotSocket {
 	friend class ENetDTLSServer;
 
 private:
+	// Datagrams are received in batches, and handed to ENet one at a time.
+	static constexpr int RECV_BATCH_SIZE = 32;
+
 	Ref<NetSocket> sock;
 	IPAddress local_address;
 	bool bound = false;
+	LocalVector<uint8_t> recv_buffer;
+	NetSocket::Datagram recv_datagrams[RECV_BATCH_SIZE];
+	int recv_count = 0;
+	int recv_next = 0;
 
 public:
 	ENetUDP() {
@@ -110,11 +117,34 @@ public:
 	}
 
 	Error recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IPAddress &r_ip, uint16_t &r_port) {
-		Error err = sock->poll(NetSocket::POLL_TYPE_IN, 0);
-		if (err != OK) {
-			return err;
+		if (recv_next == recv_count) {
+			Error err = sock->poll(NetSocket::POLL_TYPE_IN, 0);
+			if (err != OK) {
+				return err;
+			}
+			if (recv_buffer.is_empty()) {
+				recv_buffer.resize(ENET_PROTOCOL_MAXIMUM_MTU * RECV_BATCH_SIZE);
+				for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+					recv_datagrams[i].buffer = recv_buffer.ptr() + i * ENET_PROTOCOL_MAXIMUM_MTU;
+					recv_datagrams[i].size = ENET_PROTOCOL_MAXIMUM_MTU;
+				}
+			}
+			recv_next = 0;
+			recv_count = 0;
+			err = sock->recvfrom_batch(recv_datagrams, RECV_BATCH_SIZE, recv_count);
+			if (err != OK) {
+				return err;
+			}
+		}
+		const NetSocket::Datagram &datagram = recv_datagrams[recv_next++];
+		if (datagram.read > p_len) {
+			return ERR_OUT_OF_MEMORY;
 		}
-		return sock->recvfrom(p_buffer, p_len, r_read, r_ip, r_port);
+		memcpy(p_buffer, datagram.buffer, datagram.read);
+		r_read = datagram.read;
+		r_ip = datagram.ip;
+		r_port = datagram.port;
+		return OK;
 	}
 
 	int set_option(ENetSocketOption p_option, int p_value) {
@@ -162,6 +192,8 @@ public:
 	void close() {
 		sock->close();
 		local_address.clear();
+		recv_count = 0;
+		recv_next = 0;
 	}
 };
 
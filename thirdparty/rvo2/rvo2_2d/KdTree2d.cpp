@@ -54,8 +54,30 @@ namespace RVO2D {
 		}
 	}
 
-	void KdTree2D::buildAgentTreeRecursive(size_t begin, size_t end, size_t node)
+	void KdTree2D::buildAgentTreeTop(std::vector<Agent2D *> agents, size_t depth, std::vector<AgentSubtree> &subtrees)
 	{
+		agents_.swap(agents);
+		subtrees.clear();
+
+		if (!agents_.empty()) {
+			agentTree_.resize(2 * agents_.size() - 1);
+			buildAgentTreeRecursive(0, agents_.size(), 0, depth, &subtrees);
+		}
+	}
+
+	void KdTree2D::buildAgentSubtree(const AgentSubtree &subtree)
+	{
+		buildAgentTreeRecursive(subtree.begin, subtree.end, subtree.node);
+	}
+
+	void KdTree2D::buildAgentTreeRecursive(size_t begin, size_t end, size_t node, size_t depth, std::vector<AgentSubtree> *subtrees)
+	{
+		if (subtrees != nullptr && depth == 0) {
+			/* Deferred subtree. */
+			subtrees->push_back({ begin, end, node });
+			return;
+		}
+
 		agentTree_[node].begin = begin;
 		agentTree_[node].end = end;
 		agentTree_[node].minX = agentTree_[node].maxX = agents_[begin]->position_.x();
@@ -100,8 +122,8 @@ namespace RVO2D {
 			agentTree_[node].left = node + 1;
 			agentTree_[node].right = node + 2 * (left - begin);
 
-			buildAgentTreeRecursive(begin, left, agentTree_[node].left);
-			buildAgentTreeRecursive(left, end, agentTree_[node].right);
+			buildAgentTreeRecursive(begin, left, agentTree_[node].left, depth - 1, subtrees);
+			buildAgentTreeRecursive(left, end, agentTree_[node].right, depth - 1, subtrees);
 		}
 	}
 
@@ -53,8 +53,30 @@ namespace RVO3D {
 		}
 	}
 
-	void KdTree3D::buildAgentTreeRecursive(size_t begin, size_t end, size_t node)
+	void KdTree3D::buildAgentTreeTop(std::vector<Agent3D *> agents, size_t depth, std::vector<AgentSubtree> &subtrees)
 	{
+		agents_.swap(agents);
+		subtrees.clear();
+
+		if (!agents_.empty()) {
+			agentTree_.resize(2 * agents_.size() - 1);
+			buildAgentTreeRecursive(0, agents_.size(), 0, depth, &subtrees);
+		}
+	}
+
+	void KdTree3D::buildAgentSubtree(const AgentSubtree &subtree)
+	{
+		buildAgentTreeRecursive(subtree.begin, subtree.end, subtree.node);
+	}
+
+	void KdTree3D::buildAgentTreeRecursive(size_t begin, size_t end, size_t node, size_t depth, std::vector<AgentSubtree> *subtrees)
+	{
+		if (subtrees != nullptr && depth == 0) {
+			/* Deferred subtree. */
+			subtrees->push_back({ begin, end, node });
+			return;
+		}
+
 		agentTree_[node].begin = begin;
 		agentTree_[node].end = end;
 		agentTree_[node].minCoord = agents_[begin]->position_;
@@ -116,8 +138,8 @@ namespace RVO3D {
 			agentTree_[node].left = node + 1;
 			agentTree_[node].right = node + 2 * leftSize;
 
-			buildAgentTreeRecursive(begin, left, agentTree_[node].left);
-			buildAgentTreeRecursive(left, end, agentTree_[node].right);
+			buildAgentTreeRecursive(begin, left, agentTree_[node].left, depth - 1, subtrees);
+			buildAgentTreeRecursive(left, end, agentTree_[node].right, depth - 1, subtrees);
 		}
 	}
 
@@ -97,7 +97,28 @@ namespace RVO3D {
 		 */
 		void buildAgentTree(std::vector<Agent3D *> agents);
 
-		void buildAgentTreeRecursive(size_t begin, size_t end, size_t node);
+		/**
+		 * \brief      A part of the agent <i>k</i>d-tree left to be built with
+		 *             buildAgentSubtree().
+		 */
+		struct AgentSubtree {
+			size_t begin;
+			size_t end;
+			size_t node;
+		};
+
+		/**
+		 * \brief      Builds the top levels of an agent <i>k</i>d-tree, down to
+		 *             the specified depth, and defers the remaining subtrees.
+		 *             The deferred subtrees use disjoint agent and node ranges,
+		 *             so they can be built in parallel. The resulting tree is
+		 *             identical to the one built by buildAgentTree().
+		 */
+		void buildAgentTreeTop(std::vector<Agent3D *> agents, size_t depth, std::vector<AgentSubtree> &subtrees);
+
+		void buildAgentSubtree(const AgentSubtree &subtree);
+
+		void buildAgentTreeRecursive(size_t begin, size_t end, size_t node, size_t depth = 0, std::vector<AgentSubtree> *subtrees = nullptr);
 
 		/**
 		 * \brief   Computes the agent neighbors of the specified agent.